@@ -222,10 +222,12 @@ void flash_attention_pto(const std::vector<float> &q, const std::vector<float> &
             ScoresPlain scores;
 
             RowReducePlain rowMax;
-            ScoresPlain scoresCentered;
-            ScoresPlain expScores;
             RowReducePlain rowSum;
             ScoresPlain probs;
+#ifndef __CPU_SIM
+            ScoresPlain scoresCentered;
+            ScoresPlain expScores;
+#endif
 
             LeftP pLeft;
             RightV vRight;
@@ -241,13 +243,17 @@ void flash_attention_pto(const std::vector<float> &q, const std::vector<float> &
 
             TMATMUL(scoresAcc, qLeft, kRight);
             TMOV(scores, scoresAcc);
+#ifdef __CPU_SIM
+            // Fused TMULS/TROWMAX/TROWEXPANDSUB/TEXP/TROWSUM/TROWEXPANDDIV: one pass per cache-resident row.
+            cpu::RowSoftmax(probs, scores, rowMax, rowSum, scale);
+#else
             TMULS(scores, scores, scale);
-
             TROWMAX(rowMax, scores, scores);
             TROWEXPANDSUB(scoresCentered, scores, rowMax);
             TEXP(expScores, scoresCentered);
             TROWSUM(rowSum, expScores, expScores);
             TROWEXPANDDIV(probs, expScores, rowSum);
+#endif
 
             TMOV(pLeft, probs);
             TMOV(vRight, vTile);
@@ -126,6 +126,17 @@ enum class ReduceOp : uint8_t
     Min = 2, // Element-wise minimum
 };
 
+// ============================================================================
+// CollectiveAlgo: Algorithm of a collective that every rank of the group calls
+// ============================================================================
+
+enum class CollectiveAlgo : uint8_t
+{
+    Direct = 0, // Root moves all data itself: O(nranks) transfers on the root
+    Ring = 1,   // Ring reduce-scatter + all-gather (TALLREDUCE)
+    Tree = 2,   // Binomial tree, pipelined chunk by chunk
+};
+
 // ============================================================================
 // DmaEngine: DMA constraints for data transfer
 // ============================================================================
@@ -247,6 +247,47 @@ PTO_INST RecordEvent TREDUCE(ParallelGroupType &parallelGroup, GlobalDstData &ds
     return {};
 }
 
+#ifdef __CPU_SIM
+// ============================================================================
+// Collective forms (CPU simulator): every rank of the group calls them, with its own rank and one signal block per
+// rank (CollectiveSignalWords(nranks) int32 words each, zeroed before first use). CollectiveAlgo picks Direct,
+// Ring or Tree; chunks are pipelined through the ping/pong tiles.
+// ============================================================================
+
+template <typename ParallelGroupType, typename GlobalSrcData, typename SignalGroup, typename TileData,
+          typename... WaitEvents>
+PTO_INST RecordEvent TBROADCAST(ParallelGroupType &parallelGroup, GlobalSrcData &srcGlobalData, SignalGroup &signals,
+                                int myRank, TileData &pingTile, TileData &pongTile, CollectiveAlgo algo,
+                                WaitEvents &... events)
+{
+    WaitAllEvents(events...);
+    ::pto::comm::TBROADCAST_IMPL(parallelGroup, srcGlobalData, signals, myRank, pingTile, pongTile, algo);
+    return {};
+}
+
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData, typename... WaitEvents>
+PTO_INST RecordEvent TREDUCE(SrcGroup &srcGroup, DstGroup &dstGroup, SignalGroup &signals, int myRank,
+                             TileData &accTileData, TileData &pingTileData, TileData &pongTileData, ReduceOp op,
+                             CollectiveAlgo algo, WaitEvents &... events)
+{
+    WaitAllEvents(events...);
+    ::pto::comm::TREDUCE_IMPL(srcGroup, dstGroup, signals, myRank, accTileData, pingTileData, pongTileData, op, algo);
+    return {};
+}
+
+// TALLREDUCE: every rank's dst receives the reduction of all ranks' src (src and dst may alias)
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData, typename... WaitEvents>
+PTO_INST RecordEvent TALLREDUCE(SrcGroup &srcGroup, DstGroup &dstGroup, SignalGroup &signals, int myRank,
+                                TileData &accTileData, TileData &pingTileData, TileData &pongTileData, ReduceOp op,
+                                CollectiveAlgo algo, WaitEvents &... events)
+{
+    WaitAllEvents(events...);
+    ::pto::comm::TALLREDUCE_IMPL(srcGroup, dstGroup, signals, myRank, accTileData, pingTileData, pongTileData, op,
+                                 algo);
+    return {};
+}
+#endif
+
 } // namespace comm
 } // namespace pto
 
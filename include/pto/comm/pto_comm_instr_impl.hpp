@@ -45,6 +45,10 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/cpu/comm/TGather.hpp"
 #include "pto/cpu/comm/TBroadcast.hpp"
 #include "pto/cpu/comm/TScatter.hpp"
+#include "pto/cpu/comm/TAllReduce.hpp"
+
+// Multi-rank runtime
+#include "pto/cpu/comm/ranks.hpp"
 #endif
 
 #endif // PTO_COMM_INSTR_IMPL_HPP
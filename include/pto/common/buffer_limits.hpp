@@ -21,8 +21,16 @@ See LICENSE in the root of the software repository for the full text of the Lice
 // the hardware reference for A2A3 / A5 / Kirin9030 / KirinX90.
 //
 // All values are in BYTES.
+//
+// The CPU simulator follows A5 unless the build selects an architecture.
 // =============================================================================
 
+#if defined(__CPU_SIM) && !defined(PTO_NPU_ARCH_A2A3) && !defined(PTO_NPU_ARCH_A5) && \
+    !defined(PTO_NPU_ARCH_KIRIN9030) && !defined(PTO_NPU_ARCH_KIRINX90)
+#define PTO_BUFFER_LIMITS_CPU_SIM_A5
+#define PTO_NPU_ARCH_A5
+#endif
+
 // ---- UB (Vec) ----
 #ifndef PTO_UBUF_ALIGN_BYTES
 #define PTO_UBUF_ALIGN_BYTES 32u
@@ -167,4 +175,9 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #endif
 #endif
 
+#ifdef PTO_BUFFER_LIMITS_CPU_SIM_A5
+#undef PTO_NPU_ARCH_A5
+#undef PTO_BUFFER_LIMITS_CPU_SIM_A5
+#endif
+
 #endif // PTO_COMMON_BUFFER_LIMITS_HPP
@@ -15,6 +15,8 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include <cstring>
 #include <cassert>
 #include <cstdio>
+#include <cstdint>
+#include <atomic>
 
 // CPU simulator assertion helper (always enabled).
 #define PTO_CPU_STUB_ASSERT(cond)                                                                                  \
@@ -49,10 +51,7 @@ const pipe_t PIPE_MTE2 = 3;
 const pipe_t PIPE_MTE3 = 4;
 const pipe_t PIPE_M = 5;
 const pipe_t PIPE_ALL = 6;
-inline void pipe_barrier(pipe_t pipe)
-{
-    (void)pipe;
-}
+const pipe_t PIPE_FIX = 7;
 
 constexpr pipe_t opPipeList[] = {};
 
@@ -82,11 +81,101 @@ static inline void aclrtMallocHost(void **p, size_t sz)
 #define aclrtDestroyStream(x)
 #define aclrtResetDevice(x)
 #define aclFinalize(x)
-#define set_flag(a, b, c)
-#define wait_flag(a, b, c)
 #define __cce_get_tile_ptr(x) x
 
 typedef int event_t;
 #define EVENT_ID0 0
+#define EVENT_ID1 1
+#define EVENT_ID2 2
+#define EVENT_ID3 3
+#define EVENT_ID4 4
+#define EVENT_ID5 5
+#define EVENT_ID6 6
+#define EVENT_ID7 7
+
+// Pipe synchronisation is a no-op unless an AsyncPipeScope is active (see pto/cpu/pipes.hpp).
+namespace pto::cpu {
+inline void PipeSetFlag(pipe_t src, pipe_t dst, event_t id);
+inline void PipeWaitFlag(pipe_t src, pipe_t dst, event_t id);
+inline void PipeBarrier(pipe_t pipe);
+inline void PipeQuiesce() noexcept;
+} // namespace pto::cpu
+
+inline void set_flag(pipe_t src, pipe_t dst, event_t id)
+{
+    pto::cpu::PipeSetFlag(src, dst, id);
+}
+
+inline void wait_flag(pipe_t src, pipe_t dst, event_t id)
+{
+    pto::cpu::PipeWaitFlag(src, dst, id);
+}
+
+inline void pipe_barrier(pipe_t pipe)
+{
+    pto::cpu::PipeBarrier(pipe);
+}
+
+namespace pto::cpu {
+class LaunchObjects;
+
+// Identity of the logical AI core run by the current host thread; set by pto::cpu::LaunchKernel.
+struct CoreContext {
+    int64_t blockIdx = 0;
+    int64_t blockNum = 1;
+    int64_t subblockId = 0;
+    int64_t subblockDim = 1;
+    bool isCube = false;
+    uint8_t vecMask = 1;              // vector subblock ids present in this block, one bit per id
+    LaunchObjects *objects = nullptr; // state shared by the cores of the running launch, see pto/cpu/launch.hpp
+};
+
+inline CoreContext &CurrentCore()
+{
+    thread_local CoreContext ctx;
+    return ctx;
+}
+
+// Host threads that may be writing global memory right now: the cores of running multi-core launches plus the
+// extra pipes of asynchronous cores. Atomic stores skip their locking while this is at most one.
+inline std::atomic<int64_t> &ConcurrentWriters()
+{
+    static std::atomic<int64_t> writers{0};
+    return writers;
+}
+
+inline bool GlobalMemoryShared()
+{
+    return ConcurrentWriters().load(std::memory_order_relaxed) > 1;
+}
+
+// Set in the forked ranks of a Process-mode pto::cpu::LaunchRanks. Other writers of global memory are then other
+// processes, which in-process locks do not exclude, so atomic stores fall back to per-element CAS.
+inline bool &GlobalMemoryCrossProcess()
+{
+    static bool crossProcess = false;
+    return crossProcess;
+}
+} // namespace pto::cpu
+
+inline int64_t get_block_idx()
+{
+    return pto::cpu::CurrentCore().blockIdx;
+}
+
+inline int64_t get_block_num()
+{
+    return pto::cpu::CurrentCore().blockNum;
+}
+
+inline int64_t get_subblockid()
+{
+    return pto::cpu::CurrentCore().subblockId;
+}
+
+inline int64_t get_subblockdim()
+{
+    return pto::cpu::CurrentCore().subblockDim;
+}
 
 #endif
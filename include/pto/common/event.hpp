@@ -14,6 +14,10 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define EVENT_ID_MAX 8
 
 #include <pto/common/type.hpp>
+#ifdef __CPU_SIM
+#include <cstdint>
+#include <memory>
+#endif
 
 namespace pto {
 enum class Op : uint16_t
@@ -104,8 +108,36 @@ enum class Op : uint16_t
     OP_COUNT, // The Total number of operations, please add new operations before OP_COUNT
 };
 
+#ifdef __CPU_SIM
+namespace cpu {
+namespace detail {
+class PipeWorker;
+}
+// Completion token of an instruction queued on a simulated pipe; empty when it ran synchronously.
+struct PipeToken {
+    std::shared_ptr<detail::PipeWorker> worker;
+    uint64_t seq = 0;
+};
+inline PipeToken LastPipeToken();
+inline void WaitPipeToken(const PipeToken &token);
+} // namespace cpu
+
+// Default construction (the "return {}" of every PTO_INST) captures the instruction this thread issued last.
+struct RecordEvent {
+    RecordEvent() : token(cpu::LastPipeToken())
+    {}
+
+    void Wait() const
+    {
+        cpu::WaitPipeToken(token);
+    }
+
+    cpu::PipeToken token;
+};
+#else
 struct RecordEvent {
 };
+#endif
 
 template <pipe_t SrcPipe, pipe_t DstPipe>
 class EventIdCounter {
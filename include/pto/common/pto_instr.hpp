@@ -17,14 +17,31 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/comm/pto_comm_inst.hpp"
 #include "pto/common/tassign_check.hpp"
 
+#define PTO_UNPAREN(...) __VA_ARGS__
+#ifdef __CPU_SIM
+// The CPU simulator routes every instruction through cpu::IssueInstr so it can run on a simulated pipe and be
+// profiled by name.
+#define MAP_INSTR_IMPL(API, ...) \
+    ::pto::cpu::IssueInstr(#API, [](auto &&...implArgs) { API##_IMPL(implArgs...); }, __VA_ARGS__)
+// MAP_INSTR_IMPL for implementations taking explicit template arguments, given as a parenthesized list.
+#define MAP_INSTR_IMPL_T(API, TARGS, ...) \
+    ::pto::cpu::IssueInstr(#API, [](auto &&...implArgs) { API##_IMPL<PTO_UNPAREN TARGS>(implArgs...); }, __VA_ARGS__)
+#else
 #define MAP_INSTR_IMPL(API, ...) API##_IMPL(__VA_ARGS__)
+#define MAP_INSTR_IMPL_T(API, TARGS, ...) API##_IMPL<PTO_UNPAREN TARGS>(__VA_ARGS__)
+#endif
 
 namespace pto {
 
 template <typename T, typename AddrType>
 PTO_INST void TASSIGN(T &obj, AddrType addr)
 {
+#ifdef __CPU_SIM
+    // Binding storage is scalar work: it takes effect in program order, never on a simulated pipe.
+    TASSIGN_IMPL(obj, addr);
+#else
     MAP_INSTR_IMPL(TASSIGN, obj, addr);
+#endif
 }
 
 // Compile-time address overload: TASSIGN<Addr>(tile)
@@ -160,7 +177,7 @@ template <typename TileData, typename GlobalData, typename... WaitEvents>
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, AtomicType::AtomicNone>(dst, src);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, AtomicType::AtomicNone), dst, src);
     return {};
 }
 
@@ -169,7 +186,7 @@ template <STPhase Phase, typename TileData, typename GlobalData, typename... Wai
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, AtomicType::AtomicNone, Phase>(dst, src);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, AtomicType::AtomicNone, Phase), dst, src);
     return {};
 }
 
@@ -177,7 +194,7 @@ template <typename TileData, typename GlobalData, AtomicType atomicType, typenam
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, atomicType>(dst, src);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, atomicType), dst, src);
     return {};
 }
 
@@ -185,7 +202,7 @@ template <STPhase Phase, typename TileData, typename GlobalData, AtomicType atom
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, atomicType, Phase>(dst, src);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, atomicType, Phase), dst, src);
     return {};
 }
 
@@ -194,7 +211,7 @@ template <typename TileData, typename GlobalData, AtomicType atomicType = Atomic
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, atomicType, reluPreMode>(dst, src);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, atomicType, reluPreMode), dst, src);
     return {};
 }
 
@@ -203,7 +220,7 @@ template <STPhase Phase, typename TileData, typename GlobalData, AtomicType atom
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, atomicType, reluPreMode, Phase>(dst, src);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, atomicType, reluPreMode, Phase), dst, src);
     return {};
 }
 
@@ -212,7 +229,7 @@ template <typename TileData, typename GlobalData, AtomicType atomicType = Atomic
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, uint64_t preQuantScalar, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, atomicType, reluPreMode>(dst, src, preQuantScalar);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, atomicType, reluPreMode), dst, src, preQuantScalar);
     return {};
 }
 
@@ -221,7 +238,7 @@ template <STPhase Phase, typename TileData, typename GlobalData, AtomicType atom
 PTO_INST RecordEvent TSTORE(GlobalData &dst, TileData &src, uint64_t preQuantScalar, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, atomicType, reluPreMode, Phase>(dst, src, preQuantScalar);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, atomicType, reluPreMode, Phase), dst, src, preQuantScalar);
     return {};
 }
 
@@ -230,7 +247,7 @@ template <typename TileData, typename GlobalData, typename FpTileData, AtomicTyp
 PTO_INST RecordEvent TSTORE_FP(GlobalData &dst, TileData &src, FpTileData &fp, WaitEvents &... events)
 {
     TSYNC(events...);
-    TSTORE_IMPL<TileData, GlobalData, FpTileData, atomicType, reluPreMode>(dst, src, fp);
+    MAP_INSTR_IMPL_T(TSTORE, (TileData, GlobalData, FpTileData, atomicType, reluPreMode), dst, src, fp);
     return {};
 }
 
@@ -337,7 +354,7 @@ PTO_INST RecordEvent TSUBC(TileData &dst, TileData &src0, TileData &src1, TileDa
     return {};
 }
 
-#ifdef PTO_NPU_ARCH_A5
+#if defined(PTO_NPU_ARCH_A5) || defined(__CPU_SIM)
 template <typename TileRes, typename TileLeft, typename TileLeftScale, typename TileRight, typename TileRightScale,
           typename... WaitEvents>
 PTO_INST RecordEvent TGEMV_MX(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale &aScaleMatrix, TileRight &bMatrix,
@@ -354,7 +371,7 @@ PTO_INST RecordEvent TGEMV_MX(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale
                               TileRightScale &bScaleMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TGEMV_MX_IMPL<Phase>(cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
+    MAP_INSTR_IMPL_T(TGEMV_MX, (Phase), cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
     return {};
 }
 
@@ -374,7 +391,7 @@ PTO_INST RecordEvent TGEMV_MX(TileRes &cOutMatrix, TileRes &cInMatrix, TileLeft
                               TileRight &bMatrix, TileRightScale &bScaleMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TGEMV_MX_IMPL<Phase>(cOutMatrix, cInMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
+    MAP_INSTR_IMPL_T(TGEMV_MX, (Phase), cOutMatrix, cInMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
     return {};
 }
 
@@ -394,7 +411,7 @@ PTO_INST RecordEvent TGEMV_MX(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale
                               TileRightScale &bScaleMatrix, TileBias &biasData, WaitEvents &... events)
 {
     TSYNC(events...);
-    TGEMV_MX_IMPL<Phase>(cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, biasData);
+    MAP_INSTR_IMPL_T(TGEMV_MX, (Phase), cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, biasData);
     return {};
 }
 
@@ -415,7 +432,7 @@ PTO_INST RecordEvent TMATMUL_MX(TileRes &cMatrix, TileLeft &aMatrix, TileLeftSca
                                 TileRightScale &bScaleMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_MX_IMPL<Phase>(cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
+    MAP_INSTR_IMPL_T(TMATMUL_MX, (Phase), cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
     return {};
 }
 
@@ -435,7 +452,7 @@ PTO_INST RecordEvent TMATMUL_MX(TileRes &cOutMatrix, TileRes &cInMatrix, TileLef
                                 TileRight &bMatrix, TileRightScale &bScaleMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_MX_IMPL<Phase>(cOutMatrix, cInMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
+    MAP_INSTR_IMPL_T(TMATMUL_MX, (Phase), cOutMatrix, cInMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix);
     return {};
 }
 
@@ -455,7 +472,7 @@ PTO_INST RecordEvent TMATMUL_MX(TileRes &cMatrix, TileLeft &aMatrix, TileLeftSca
                                 TileRightScale &bScaleMatrix, TileBias &biasData, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_MX_IMPL<Phase>(cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, biasData);
+    MAP_INSTR_IMPL_T(TMATMUL_MX, (Phase), cMatrix, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, biasData);
     return {};
 }
 
@@ -474,7 +491,7 @@ template <AccPhase Phase, typename TileRes, typename TileLeft, typename TileRigh
 PTO_INST RecordEvent TMATMUL(TileRes &cMatrix, TileLeft &aMatrix, TileRight &bMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_IMPL<Phase>(cMatrix, aMatrix, bMatrix);
+    MAP_INSTR_IMPL_T(TMATMUL, (Phase), cMatrix, aMatrix, bMatrix);
     return {};
 }
 
@@ -493,7 +510,7 @@ PTO_INST RecordEvent TMATMUL_ACC(TileRes &cOutMatrix, TileRes &cInMatrix, TileLe
                                  WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_ACC_IMPL<Phase>(cOutMatrix, cInMatrix, aMatrix, bMatrix);
+    MAP_INSTR_IMPL_T(TMATMUL_ACC, (Phase), cOutMatrix, cInMatrix, aMatrix, bMatrix);
     return {};
 }
 
@@ -502,7 +519,7 @@ template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename Til
 PTO_INST RecordEvent TMATMUL_ACC(TileRes &cMatrix, TileLeft &aMatrix, TileRight &bMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_ACC_IMPL<Phase>(cMatrix, aMatrix, bMatrix);
+    MAP_INSTR_IMPL_T(TMATMUL_ACC, (Phase), cMatrix, aMatrix, bMatrix);
     return {};
 }
 
@@ -522,7 +539,7 @@ PTO_INST RecordEvent TMATMUL_BIAS(TileRes &cMatrix, TileLeft &aMatrix, TileRight
                                   WaitEvents &... events)
 {
     TSYNC(events...);
-    TMATMUL_BIAS_IMPL<Phase>(cMatrix, aMatrix, bMatrix, biasData);
+    MAP_INSTR_IMPL_T(TMATMUL_BIAS, (Phase), cMatrix, aMatrix, bMatrix, biasData);
     return {};
 }
 
@@ -538,7 +555,7 @@ template <AccPhase Phase, typename TileRes, typename TileLeft, typename TileRigh
 PTO_INST RecordEvent TGEMV(TileRes &cMatrix, TileLeft &aMatrix, TileRight &bMatrix, WaitEvents &... events)
 {
     TSYNC(events...);
-    TGEMV_IMPL<Phase>(cMatrix, aMatrix, bMatrix);
+    MAP_INSTR_IMPL_T(TGEMV, (Phase), cMatrix, aMatrix, bMatrix);
     return {};
 }
 
@@ -556,7 +573,7 @@ PTO_INST RecordEvent TGEMV_ACC(TileRes &cOutMatrix, TileRes &cInMatrix, TileLeft
                                WaitEvents &... events)
 {
     TSYNC(events...);
-    TGEMV_ACC_IMPL<Phase>(cOutMatrix, cInMatrix, aMatrix, bMatrix);
+    MAP_INSTR_IMPL_T(TGEMV_ACC, (Phase), cOutMatrix, cInMatrix, aMatrix, bMatrix);
     return {};
 }
 
@@ -575,7 +592,7 @@ PTO_INST RecordEvent TGEMV_BIAS(TileRes &cMatrix, TileLeft &aMatrix, TileRight &
                                 WaitEvents &... events)
 {
     TSYNC(events...);
-    TGEMV_BIAS_IMPL<Phase>(cMatrix, aMatrix, bMatrix, biasData);
+    MAP_INSTR_IMPL_T(TGEMV_BIAS, (Phase), cMatrix, aMatrix, bMatrix, biasData);
     return {};
 }
 
@@ -586,8 +603,9 @@ PTO_INST RecordEvent TMRGSORT(DstTileData &dst, MrgSortExecutedNumList &executed
                               WaitEvents &... events)
 {
     TSYNC(events...);
-    TMRGSORT_IMPL<DstTileData, TmpTileData, Src0TileData, Src1TileData, Src2TileData, Src3TileData, exhausted>(
-        dst, executedNumList, tmp, src0, src1, src2, src3);
+    MAP_INSTR_IMPL_T(TMRGSORT,
+                     (DstTileData, TmpTileData, Src0TileData, Src1TileData, Src2TileData, Src3TileData, exhausted),
+                     dst, executedNumList, tmp, src0, src1, src2, src3);
     return {};
 }
 
@@ -597,8 +615,8 @@ PTO_INST RecordEvent TMRGSORT(DstTileData &dst, MrgSortExecutedNumList &executed
                               Src0TileData &src0, Src1TileData &src1, Src2TileData &src2, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMRGSORT_IMPL<DstTileData, TmpTileData, Src0TileData, Src1TileData, Src2TileData, exhausted>(dst, executedNumList,
-                                                                                                 tmp, src0, src1, src2);
+    MAP_INSTR_IMPL_T(TMRGSORT, (DstTileData, TmpTileData, Src0TileData, Src1TileData, Src2TileData, exhausted),
+                     dst, executedNumList, tmp, src0, src1, src2);
     return {};
 }
 
@@ -608,8 +626,8 @@ PTO_INST RecordEvent TMRGSORT(DstTileData &dst, MrgSortExecutedNumList &executed
                               Src0TileData &src0, Src1TileData &src1, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMRGSORT_IMPL<DstTileData, TmpTileData, Src0TileData, Src1TileData, exhausted>(dst, executedNumList, tmp, src0,
-                                                                                   src1);
+    MAP_INSTR_IMPL_T(TMRGSORT, (DstTileData, TmpTileData, Src0TileData, Src1TileData, exhausted),
+                     dst, executedNumList, tmp, src0, src1);
     return {};
 }
 
@@ -635,7 +653,7 @@ PTO_INST RecordEvent TEXTRACT(DstTileData &dst, SrcTileData &src, uint16_t index
                               WaitEvents &... events)
 {
     TSYNC(events...);
-    TEXTRACT_IMPL<DstTileData, SrcTileData, reluMode>(dst, src, indexRow, indexCol);
+    MAP_INSTR_IMPL_T(TEXTRACT, (DstTileData, SrcTileData, reluMode), dst, src, indexRow, indexCol);
     return {};
 }
 
@@ -645,7 +663,7 @@ PTO_INST RecordEvent TEXTRACT(DstTileData &dst, SrcTileData &src, uint64_t preQu
                               uint16_t indexCol, WaitEvents &... events)
 {
     TSYNC(events...);
-    TEXTRACT_IMPL<DstTileData, SrcTileData, reluMode>(dst, src, preQuantScalar, indexRow, indexCol);
+    MAP_INSTR_IMPL_T(TEXTRACT, (DstTileData, SrcTileData, reluMode), dst, src, preQuantScalar, indexRow, indexCol);
     return {};
 }
 
@@ -655,7 +673,7 @@ PTO_INST RecordEvent TEXTRACT_FP(DstTileData &dst, SrcTileData &src, FpTileData
                                  uint16_t indexCol, WaitEvents &... events)
 {
     TSYNC(events...);
-    TEXTRACT_IMPL<DstTileData, SrcTileData, FpTileData, reluMode>(dst, src, fp, indexRow, indexCol);
+    MAP_INSTR_IMPL_T(TEXTRACT, (DstTileData, SrcTileData, FpTileData, reluMode), dst, src, fp, indexRow, indexCol);
     return {};
 }
 
@@ -665,7 +683,7 @@ PTO_INST RecordEvent TIMG2COL(TileData &dst, ConvTileData &src, uint16_t posM =
                               WaitEvents &... events)
 {
     TSYNC(events...);
-    TIMG2COL_IMPL<TileData, ConvTileData, FmatrixMode>(dst, src, posM, posK);
+    MAP_INSTR_IMPL_T(TIMG2COL, (TileData, ConvTileData, FmatrixMode), dst, src, posM, posK);
     return {};
 }
 
@@ -726,7 +744,7 @@ PTO_INST RecordEvent TINSERT(DstTileData &dst, SrcTileData &src, uint16_t indexR
                              WaitEvents &... events)
 {
     TSYNC(events...);
-    TINSERT_IMPL<DstTileData, SrcTileData, reluMode>(dst, src, indexRow, indexCol);
+    MAP_INSTR_IMPL_T(TINSERT, (DstTileData, SrcTileData, reluMode), dst, src, indexRow, indexCol);
     return {};
 }
 
@@ -736,7 +754,7 @@ PTO_INST RecordEvent TINSERT(DstTileData &dst, SrcTileData &src, uint64_t preQua
                              uint16_t indexCol, WaitEvents &... events)
 {
     TSYNC(events...);
-    TINSERT_IMPL<DstTileData, SrcTileData, reluMode>(dst, src, preQuantScalar, indexRow, indexCol);
+    MAP_INSTR_IMPL_T(TINSERT, (DstTileData, SrcTileData, reluMode), dst, src, preQuantScalar, indexRow, indexCol);
     return {};
 }
 
@@ -746,7 +764,7 @@ PTO_INST RecordEvent TINSERT_FP(DstTileData &dst, SrcTileData &src, FpTileData &
                                 uint16_t indexCol, WaitEvents &... events)
 {
     TSYNC(events...);
-    TINSERT_IMPL<DstTileData, SrcTileData, FpTileData, reluMode>(dst, src, fp, indexRow, indexCol);
+    MAP_INSTR_IMPL_T(TINSERT, (DstTileData, SrcTileData, FpTileData, reluMode), dst, src, fp, indexRow, indexCol);
     return {};
 }
 
@@ -754,7 +772,7 @@ template <typename TileData, PadValue PadVal = PadValue::Zero, typename... WaitE
 PTO_INST RecordEvent TFILLPAD(TileData &dst, TileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TFILLPAD_IMPL<TileData, PadVal>(dst, src);
+    MAP_INSTR_IMPL_T(TFILLPAD, (TileData, PadVal), dst, src);
     return {};
 }
 
@@ -809,7 +827,7 @@ template <typename TileData, typename T, int descending, typename... WaitEvents>
 PTO_INST RecordEvent TCI(TileData &dst, T start, WaitEvents &... events)
 {
     TSYNC(events...);
-    TCI_IMPL<TileData, T, descending>(dst, start);
+    MAP_INSTR_IMPL_T(TCI, (TileData, T, descending), dst, start);
     return {};
 }
 
@@ -817,7 +835,7 @@ template <typename TileData, int isUpperOrLower, typename... WaitEvents>
 PTO_INST RecordEvent TTRI(TileData &dst, int diagonal, WaitEvents &... events)
 {
     TSYNC(events...);
-    TTRI_IMPL<TileData, isUpperOrLower>(dst, diagonal);
+    MAP_INSTR_IMPL_T(TTRI, (TileData, isUpperOrLower), dst, diagonal);
     return {};
 }
 
@@ -825,7 +843,7 @@ template <typename DstTileData, typename SrcTileData, MaskPattern maskPattern, t
 PTO_INST RecordEvent TGATHER(DstTileData &dst, SrcTileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TGATHER_IMPL<DstTileData, SrcTileData, maskPattern>(dst, src);
+    MAP_INSTR_IMPL_T(TGATHER, (DstTileData, SrcTileData, maskPattern), dst, src);
     return {};
 }
 
@@ -890,7 +908,7 @@ template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode, type
 PTO_INST RecordEvent TMOV(DstTileData &dst, SrcTileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src);
+    MAP_INSTR_IMPL_T(TMOV, (DstTileData, SrcTileData, reluMode), dst, src);
     return {};
 }
 
@@ -899,7 +917,7 @@ template <typename DstTileData, typename SrcTileData, AccToVecMode mode, ReluPre
 PTO_INST RecordEvent TMOV(DstTileData &dst, SrcTileData &src, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMOV_IMPL<DstTileData, SrcTileData, mode, reluMode>(dst, src);
+    MAP_INSTR_IMPL_T(TMOV, (DstTileData, SrcTileData, mode, reluMode), dst, src);
     return {};
 }
 
@@ -908,7 +926,7 @@ template <typename DstTileData, typename SrcTileData, typename FpTileData, ReluP
 PTO_INST RecordEvent TMOV_FP(DstTileData &dst, SrcTileData &src, FpTileData &fp, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMOV_IMPL<DstTileData, SrcTileData, FpTileData, reluMode>(dst, src, fp);
+    MAP_INSTR_IMPL_T(TMOV, (DstTileData, SrcTileData, FpTileData, reluMode), dst, src, fp);
     return {};
 }
 
@@ -917,7 +935,7 @@ template <typename DstTileData, typename SrcTileData, typename FpTileData, AccTo
 PTO_INST RecordEvent TMOV(DstTileData &dst, SrcTileData &src, FpTileData &fp, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMOV_IMPL<DstTileData, SrcTileData, FpTileData, mode, reluMode>(dst, src, fp);
+    MAP_INSTR_IMPL_T(TMOV, (DstTileData, SrcTileData, FpTileData, mode, reluMode), dst, src, fp);
     return {};
 }
 
@@ -926,7 +944,7 @@ template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode = Rel
 PTO_INST RecordEvent TMOV(DstTileData &dst, SrcTileData &src, uint64_t preQuantScalar, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src, preQuantScalar);
+    MAP_INSTR_IMPL_T(TMOV, (DstTileData, SrcTileData, reluMode), dst, src, preQuantScalar);
     return {};
 }
 
@@ -935,7 +953,7 @@ template <typename DstTileData, typename SrcTileData, AccToVecMode mode, ReluPre
 PTO_INST RecordEvent TMOV(DstTileData &dst, SrcTileData &src, uint64_t preQuantScalar, WaitEvents &... events)
 {
     TSYNC(events...);
-    TMOV_IMPL<DstTileData, SrcTileData, mode, reluMode>(dst, src, preQuantScalar);
+    MAP_INSTR_IMPL_T(TMOV, (DstTileData, SrcTileData, mode, reluMode), dst, src, preQuantScalar);
     return {};
 }
 
@@ -999,7 +1017,12 @@ template <typename TileDataOut, typename TileDataIn, typename... WaitEvents>
 PTO_INST RecordEvent TRESHAPE(TileDataOut &dst, TileDataIn &src, WaitEvents &... events)
 {
     TSYNC(events...);
+#ifdef __CPU_SIM
+    // Like TASSIGN, a reshape only rebinds dst's storage: it takes effect in program order, never on a simulated pipe.
+    TRESHAPE_IMPL(dst, src);
+#else
     MAP_INSTR_IMPL(TRESHAPE, dst, src);
+#endif
     return {};
 }
 
@@ -1485,7 +1508,8 @@ PTO_INST RecordEvent TQUANT(TileDataOut &dst, TileDataSrc &src, TileDataExp *exp
                             TileDataSrc *scaling, WaitEvents &... events)
 {
     TSYNC(events...);
-    TQUANT_IMPL<quant_type, TileDataOut, TileDataSrc, TileDataExp, TileDataMax>(dst, src, exp, max, scaling);
+    MAP_INSTR_IMPL_T(TQUANT, (quant_type, TileDataOut, TileDataSrc, TileDataExp, TileDataMax),
+                     dst, src, exp, max, scaling);
     return {};
 }
 
@@ -1495,8 +1519,8 @@ PTO_INST RecordEvent TQUANT(TileDataOut &dst, TileDataSrc &src, TileDataExp *exp
                             TileDataSrc *scaling, TileDataExp *exp_zz, TileDataIdx *vgather_idx, WaitEvents &... events)
 {
     TSYNC(events...);
-    TQUANT_IMPL<quant_type, store_mode, TileDataOut, TileDataSrc, TileDataExp, TileDataMax, TileDataIdx>(
-        dst, src, exp, max, scaling, exp_zz, vgather_idx);
+    MAP_INSTR_IMPL_T(TQUANT, (quant_type, store_mode, TileDataOut, TileDataSrc, TileDataExp, TileDataMax, TileDataIdx),
+                     dst, src, exp, max, scaling, exp_zz, vgather_idx);
     return {};
 }
 #endif
@@ -1506,7 +1530,7 @@ PTO_INST RecordEvent TQUANT(TileDataOut &dst, TileDataSrc &src, TileDataPara &sc
                             WaitEvents &... events)
 {
     TSYNC(events...);
-    TQUANT_IMPL<quant_type, TileDataOut, TileDataSrc, TileDataPara>(dst, src, scale, offset);
+    MAP_INSTR_IMPL_T(TQUANT, (quant_type, TileDataOut, TileDataSrc, TileDataPara), dst, src, scale, offset);
     return {};
 }
 } // namespace pto
@@ -236,6 +236,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/cpu/TMrgSort.hpp"
 #include "pto/cpu/TMov.hpp"
 #include "pto/cpu/TExtract.hpp"
+#include "pto/cpu/TInsert.hpp"
 #include "pto/cpu/TSqrt.hpp"
 #include "pto/cpu/TReshape.hpp"
 #include "pto/cpu/TRowSum.hpp"
@@ -255,6 +256,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/cpu/TPartMin.hpp"
 #include "pto/cpu/TRowExpand.hpp"
 #include "pto/cpu/TRowExpandOp.hpp"
+#include "pto/cpu/TRowSoftmax.hpp"
 #include "pto/cpu/TRSqrt.hpp"
 #include "pto/cpu/TPrefetch.hpp"
 #include "pto/cpu/TCvt.hpp"
@@ -268,6 +270,8 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/cpu/TSync.hpp"
 #include "pto/cpu/TPush.hpp"
 #include "pto/cpu/TPop.hpp"
+#include "pto/cpu/pipes.hpp"
+#include "pto/cpu/launch.hpp"
 #include "pto/cpu/comm/TBroadcast.hpp"
 #include "pto/cpu/comm/TTest.hpp"
 #include "pto/cpu/comm/TGet.hpp"
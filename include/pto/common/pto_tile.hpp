@@ -17,6 +17,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/common/debug.h"
 #ifdef __CPU_SIM
 #include <iomanip>
+#include "pto/cpu/tile_storage.hpp"
 #endif
 
 namespace pto {
@@ -1322,7 +1323,18 @@ public:
                   "SFractalSize_ illegal");
 
 #ifdef __CPU_SIM
-    using TileDType = Tile::DType[Rows * Cols];
+    using TileDType = Tile::DType *;
+
+    // Storage may be owned by the tile on CPU: let queued pipe work finish before it goes away. The destructor must
+    // not hide the copy and move operations, or every move of a tile would become a deep copy.
+    ~Tile()
+    {
+        cpu::PipeQuiesce();
+    }
+    Tile(const Tile &) = default;
+    Tile(Tile &&) = default;
+    Tile &operator=(const Tile &) = default;
+    Tile &operator=(Tile &&) = default;
 #else
 #ifdef __PTO_AUTO__
     using TileDType = typename MemoryQualifier<Loc, DType>::type tile_size(Rows *Cols);
@@ -1369,6 +1381,10 @@ public:
 
     template <typename T, typename AddrType>
     friend AICORE void TASSIGN_IMPL(T &tile, AddrType addr);
+#ifdef __CPU_SIM
+    template <typename TileDataOut, typename TileDataIn>
+    friend AICORE void TRESHAPE_IMPL(TileDataOut &dst, TileDataIn &src);
+#endif
 
     PTO_INTERNAL bool GetKAligned() const
     {
@@ -1405,7 +1421,12 @@ private:
     {
         data_ = data;
     }
+#ifdef __CPU_SIM
+    // Heap elements until TASSIGN makes it a view of the core's simulated buffer (see pto/cpu/core_buffers.hpp).
+    cpu::TileStorage<DType, Rows * Cols> data_;
+#else
     TileDType data_;
+#endif
     bool isKAligned_; // K-Alignedment for A3
 };
 
@@ -12,25 +12,9 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define PTO_COMMON_TASSIGN_CHECK_HPP
 
 #include <cstddef>
-#include <pto/common/pto_tile.hpp>
-
-// CPUSIM does not model on-chip buffer capacities, so skip all static checks.
-#ifdef __CPU_SIM
-
-namespace pto {
-namespace detail {
-
-template <typename TileT, std::size_t Addr>
-struct tassign_static_check {
-};
-
-} // namespace detail
-} // namespace pto
-
-#else // NPU targets — full static checks
-
 #include <pto/common/buffer_limits.hpp>
 #include <pto/common/memory.hpp>
+#include <pto/common/pto_tile.hpp>
 
 namespace pto {
 namespace detail {
@@ -180,6 +164,4 @@ struct tassign_static_check {
 } // namespace detail
 } // namespace pto
 
-#endif // __CPU_SIM
-
 #endif // PTO_COMMON_TASSIGN_CHECK_HPP
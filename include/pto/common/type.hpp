@@ -266,6 +266,27 @@ typedef std::bfloat16_t bfloat16_t;
 // For CPU simulation, a best-effort 16-bit float type is sufficient.
 typedef _Float16 bfloat16_t;
 #endif
+
+// 8-bit and packed 4-bit float formats of the MX matmul, kept as raw bits; pto/cpu/mx_formats.hpp decodes them.
+// A float4 byte holds two elements, the lower tile offset in the low nibble.
+struct float8_e4m3_t {
+    unsigned char bits;
+};
+struct float8_e5m2_t {
+    unsigned char bits;
+};
+struct float8_e8m0_t {
+    unsigned char bits;
+};
+struct hifloat8_t {
+    unsigned char bits;
+};
+struct float4_e2m1x2_t {
+    unsigned char bits;
+};
+struct float4_e1m2x2_t {
+    unsigned char bits;
+};
 #endif
 
 #endif
@@ -42,21 +42,12 @@ void BinaryElementTileOp_Impl(typename tile_shape::TileDType dst, typename tile_
             });
         }
     } else {
-        if constexpr (tile_shape::isRowMajor) {
-            cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
-                for (std::size_t c = 0; c < validCol; ++c) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src0[idx], src1[idx], extra);
-                }
-            });
-        } else {
-            cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
-                for (std::size_t r = 0; r < validRow; ++r) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src0[idx], src1[idx], extra);
-                }
-            });
-        }
+        ParallelForTileSpans<tile_shape>(validRow, validCol, [&](std::size_t offset, std::size_t len) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t idx = offset; idx < offset + len; ++idx) {
+                ElementOpCal<DType, op>::apply(dst[idx], src0[idx], src1[idx], extra);
+            }
+        });
     }
 }
 
@@ -86,21 +77,12 @@ void UnaryElementTileOp_Impl(typename tile_shape::TileDType dst, typename tile_s
             });
         }
     } else {
-        if constexpr (tile_shape::isRowMajor) {
-            cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
-                for (std::size_t c = 0; c < validCol; ++c) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src[idx]);
-                }
-            });
-        } else {
-            cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
-                for (std::size_t r = 0; r < validRow; ++r) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src[idx]);
-                }
-            });
-        }
+        ParallelForTileSpans<tile_shape>(validRow, validCol, [&](std::size_t offset, std::size_t len) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t idx = offset; idx < offset + len; ++idx) {
+                ElementOpCal<DType, op>::apply(dst[idx], src[idx]);
+            }
+        });
     }
 }
 
@@ -265,21 +247,12 @@ void ElementTileOpWithCarry_Impl(typename tile_shape::TileDType dst, typename ti
             });
         }
     } else {
-        if constexpr (tile_shape::isRowMajor) {
-            cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
-                for (std::size_t c = 0; c < validCol; ++c) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src0[idx], src1[idx], src2[idx]);
-                }
-            });
-        } else {
-            cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
-                for (std::size_t r = 0; r < validRow; ++r) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src0[idx], src1[idx], src2[idx]);
-                }
-            });
-        }
+        ParallelForTileSpans<tile_shape>(validRow, validCol, [&](std::size_t offset, std::size_t len) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t idx = offset; idx < offset + len; ++idx) {
+                ElementOpCal<DType, op>::apply(dst[idx], src0[idx], src1[idx], src2[idx]);
+            }
+        });
     }
 }
 
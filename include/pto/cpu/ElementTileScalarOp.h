@@ -39,21 +39,12 @@ void ZeroTileScalarOp_Impl(typename tile_shape::TileDType dst, typename tile_sha
             });
         }
     } else {
-        if constexpr (tile_shape::isRowMajor) {
-            cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
-                for (std::size_t c = 0; c < validCol; ++c) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], scalar);
-                }
-            });
-        } else {
-            cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
-                for (std::size_t r = 0; r < validRow; ++r) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], scalar);
-                }
-            });
-        }
+        ParallelForTileSpans<tile_shape>(validRow, validCol, [&](std::size_t offset, std::size_t len) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t idx = offset; idx < offset + len; ++idx) {
+                ElementOpCal<DType, op>::apply(dst[idx], scalar);
+            }
+        });
     }
 }
 
@@ -83,21 +74,12 @@ void UnaryTileScalarOpImpl(typename tile_shape::TileDType dst, typename tile_sha
             });
         }
     } else {
-        if constexpr (tile_shape::isRowMajor) {
-            cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
-                for (std::size_t c = 0; c < validCol; ++c) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src[idx], scalar, extra);
-                }
-            });
-        } else {
-            cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
-                for (std::size_t r = 0; r < validRow; ++r) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src[idx], scalar, extra);
-                }
-            });
-        }
+        ParallelForTileSpans<tile_shape>(validRow, validCol, [&](std::size_t offset, std::size_t len) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t idx = offset; idx < offset + len; ++idx) {
+                ElementOpCal<DType, op>::apply(dst[idx], src[idx], scalar, extra);
+            }
+        });
     }
 }
 
@@ -191,21 +173,12 @@ void ElementTileScalarOpWithCarry_Impl(typename tile_shape::TileDType dst, typen
             });
         }
     } else {
-        if constexpr (tile_shape::isRowMajor) {
-            cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
-                for (std::size_t c = 0; c < validCol; ++c) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src0[idx], scalar, src1[idx]);
-                }
-            });
-        } else {
-            cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
-                for (std::size_t r = 0; r < validRow; ++r) {
-                    const std::size_t idx = GetTileElementOffset<tile_shape>(r, c);
-                    ElementOpCal<DType, op>::apply(dst[idx], src0[idx], scalar, src1[idx]);
-                }
-            });
-        }
+        ParallelForTileSpans<tile_shape>(validRow, validCol, [&](std::size_t offset, std::size_t len) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t idx = offset; idx < offset + len; ++idx) {
+                ElementOpCal<DType, op>::apply(dst[idx], src0[idx], scalar, src1[idx]);
+            }
+        });
     }
 }
 
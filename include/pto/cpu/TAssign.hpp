@@ -12,13 +12,21 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TTILE_ASSIGN
 #include <cstdint>
 #include <pto/common/pto_tile.hpp>
+#include "pto/cpu/core_buffers.hpp"
+#include "pto/cpu/pipes.hpp"
 
 namespace pto {
+// Tiles become views of the calling core's simulated buffer at addr. Queued pipe work reaches a tile's storage
+// through the tile itself, so it is drained before the tile moves.
 template <typename T, typename AddrType>
 PTO_INTERNAL void TASSIGN_IMPL(T &obj, AddrType addr)
 {
     if constexpr (is_tile_data_v<T>) {
-        return;
+        typename T::DType *view = cpu::TileAddress<T>(static_cast<std::size_t>(addr));
+        if (obj.data() != view) {
+            cpu::PipeDrainAll();
+            obj.assignData(view);
+        }
     } else {
         static_assert(is_global_data_v<T>, "Only Tile and GlobalTensor data types are supported.");
         static_assert(std::is_pointer_v<AddrType>, "GlobalTensor can only be assigned with address of pointer type.");
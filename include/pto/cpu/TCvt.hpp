@@ -14,81 +14,265 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include <pto/common/constants.hpp>
 #include <pto/common/pto_tile.hpp>
 #include "pto/cpu/tile_offsets.hpp"
+#include "pto/cpu/parallel.hpp"
 #include "pto/common/debug.h"
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 namespace pto {
-constexpr double CAST_ODD_THRESHHOLD = 0.5;
+template <typename T>
+constexpr bool is_float_like_v = std::is_floating_point_v<T> || std::is_same_v<T, half> ||
+                                 std::is_same_v<T, aclFloat16> || std::is_same_v<T, bfloat16_t>;
 
+// 16-bit IEEE-style formats (fp16, bf16) that float narrows into with an explicit rounding mode.
 template <typename T>
-constexpr bool is_float_like_v =
-    std::is_floating_point_v<T> || std::is_same_v<T, half> || std::is_same_v<T, aclFloat16>;
+constexpr bool is_narrow_float_v = is_float_like_v<T> && sizeof(T) == sizeof(uint16_t);
 
-inline double applyRoundingToIntegral(double v, RoundMode mode)
+// Rounds to an integral value in float. Float holds every integer its inputs can round to, so no double detour.
+// CAST_NONE keeps the historical truncating behaviour; CAST_ODD is round-to-odd: truncate, and if that was
+// inexact move an even result one step away from zero.
+template <RoundMode mode>
+PTO_INTERNAL float CvtRoundIntegral(float v)
 {
-    switch (mode) {
-        case RoundMode::CAST_RINT:
-            return std::rint(v);
+    if constexpr (mode == RoundMode::CAST_RINT) {
+        return std::nearbyint(v);
+    } else if constexpr (mode == RoundMode::CAST_ROUND) {
+        return std::round(v);
+    } else if constexpr (mode == RoundMode::CAST_FLOOR) {
+        return std::floor(v);
+    } else if constexpr (mode == RoundMode::CAST_CEIL) {
+        return std::ceil(v);
+    } else if constexpr (mode == RoundMode::CAST_ODD) {
+        const float t = std::trunc(v);
+        if (t != v && std::fmod(t, 2.0f) == 0.0f) {
+            return v > 0.0f ? t + 1.0f : t - 1.0f;
+        }
+        return t;
+    } else {
+        return std::trunc(v);
+    }
+}
 
-        case RoundMode::CAST_ROUND:
-            return std::round(v);
+// Saturation ON clamps to the destination range (NaN becomes 0); OFF keeps the low bits of the int64 value.
+template <typename D, SaturationMode sat>
+PTO_INTERNAL D CvtFloatToInt(float r)
+{
+    using Lim = std::numeric_limits<D>;
+    if constexpr (sat == SaturationMode::ON) {
+        if (r != r) {
+            return D(0);
+        }
+        if (r <= static_cast<float>(Lim::lowest())) {
+            return Lim::lowest();
+        }
+        if (r >= static_cast<float>(Lim::max())) {
+            return Lim::max();
+        }
+        return static_cast<D>(r);
+    } else {
+        using I64 = std::numeric_limits<int64_t>;
+        if (r != r) {
+            return D(0);
+        }
+        if (r <= static_cast<float>(I64::lowest())) {
+            return static_cast<D>(I64::lowest());
+        }
+        if (r >= static_cast<float>(I64::max())) {
+            return static_cast<D>(I64::max());
+        }
+        return static_cast<D>(static_cast<int64_t>(r));
+    }
+}
 
-        case RoundMode::CAST_FLOOR:
-            return std::floor(v);
+template <typename D, SaturationMode sat, typename S>
+PTO_INTERNAL D CvtIntToInt(S v)
+{
+    if constexpr (sat == SaturationMode::ON) {
+        using Lim = std::numeric_limits<D>;
+        if (std::cmp_less(v, Lim::lowest())) {
+            return Lim::lowest();
+        }
+        if (std::cmp_greater(v, Lim::max())) {
+            return Lim::max();
+        }
+    }
+    return static_cast<D>(v);
+}
 
-        case RoundMode::CAST_CEIL:
-            return std::ceil(v);
+template <typename T>
+PTO_INTERNAL uint16_t NarrowFloatBits(T v)
+{
+    uint16_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
 
-        case RoundMode::CAST_TRUNC:
-            return std::trunc(v);
+template <typename T>
+PTO_INTERNAL T NarrowFloatFromBits(uint16_t bits)
+{
+    T v;
+    std::memcpy(&v, &bits, sizeof(bits));
+    return v;
+}
 
-        case RoundMode::CAST_ODD: {
-            const double f = std::floor(v);
-            const double frac = v - f;
+// Neighbouring representable values by stepping the sign-magnitude encoding.
+PTO_INTERNAL uint16_t NarrowFloatNextUp(uint16_t bits)
+{
+    constexpr uint16_t signBit = 0x8000;
+    if ((bits & signBit) == 0) {
+        return static_cast<uint16_t>(bits + 1);
+    }
+    return bits == signBit ? uint16_t(1) : static_cast<uint16_t>(bits - 1);
+}
 
-            if (frac > CAST_ODD_THRESHHOLD)
-                return f + 1;
-            if (frac < CAST_ODD_THRESHHOLD)
-                return f;
+PTO_INTERNAL uint16_t NarrowFloatNextDown(uint16_t bits)
+{
+    constexpr uint16_t signBit = 0x8000;
+    return static_cast<uint16_t>(NarrowFloatNextUp(static_cast<uint16_t>(bits ^ signBit)) ^ signBit);
+}
 
-            // tie (.5) → round to odd
-            const auto i = static_cast<long long>(f);
-            return (i & 1) ? f : f + 1;
+// float -> fp16/bf16. The hardware rounding of the host cast (ties to even) is the common case; other modes pick
+// between the two neighbours bracketing v. Saturation ON clamps overflow (and infinities) to the largest finite.
+template <typename D, RoundMode mode, SaturationMode sat>
+PTO_INTERNAL D CvtFloatToNarrow(float v)
+{
+    D h = static_cast<D>(v);
+    if constexpr (mode != RoundMode::CAST_RINT && mode != RoundMode::CAST_NONE) {
+        const float back = static_cast<float>(h);
+        if (back != v && v == v) {
+            const uint16_t bits = NarrowFloatBits(h);
+            const uint16_t loBits = back > v ? NarrowFloatNextDown(bits) : bits;
+            const uint16_t hiBits = back > v ? bits : NarrowFloatNextUp(bits);
+            const D lo = NarrowFloatFromBits<D>(loBits);
+            const D hi = NarrowFloatFromBits<D>(hiBits);
+            if constexpr (mode == RoundMode::CAST_FLOOR) {
+                h = lo;
+            } else if constexpr (mode == RoundMode::CAST_CEIL) {
+                h = hi;
+            } else if constexpr (mode == RoundMode::CAST_TRUNC) {
+                h = v > 0.0f ? lo : hi;
+            } else if constexpr (mode == RoundMode::CAST_ODD) {
+                h = (loBits & 1) ? lo : hi;
+            } else {
+                const double dLo = static_cast<double>(v) - static_cast<double>(static_cast<float>(lo));
+                const double dHi = static_cast<double>(static_cast<float>(hi)) - static_cast<double>(v);
+                h = (dLo < dHi || (dLo == dHi && v < 0.0f)) ? lo : hi;
+            }
+        }
+    }
+    if constexpr (sat == SaturationMode::ON) {
+        const uint16_t bits = NarrowFloatBits(h);
+        constexpr uint16_t magMask = 0x7FFF;
+        const uint16_t infBits = NarrowFloatBits(static_cast<D>(std::numeric_limits<float>::infinity()));
+        if ((bits & magMask) == infBits) {
+            h = NarrowFloatFromBits<D>(static_cast<uint16_t>(bits - 1));
         }
+    }
+    return h;
+}
 
-        default:
-            return v;
+template <typename D, typename S, RoundMode mode, SaturationMode sat>
+PTO_INTERNAL D CvtElement(S v)
+{
+    if constexpr (is_float_like_v<S> && std::is_integral_v<D>) {
+        return CvtFloatToInt<D, sat>(CvtRoundIntegral<mode>(static_cast<float>(v)));
+    } else if constexpr (std::is_integral_v<S> && std::is_integral_v<D>) {
+        return CvtIntToInt<D, sat>(v);
+    } else if constexpr (is_narrow_float_v<D> && std::is_same_v<S, float>) {
+        return CvtFloatToNarrow<D, mode, sat>(v);
+    } else {
+        return static_cast<D>(v);
+    }
+}
+
+template <typename D, typename S, RoundMode mode, SaturationMode sat>
+PTO_INTERNAL void CvtRun(D *dst, const S *src, std::size_t count)
+{
+    PTO_CPU_VECTORIZE_LOOP
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = CvtElement<D, S, mode, sat>(src[i]);
+    }
+}
+
+template <typename TileDataD, typename TileDataS, RoundMode mode, SaturationMode sat>
+void TCvtTile(typename TileDataD::DType *dst, const typename TileDataS::DType *src, unsigned validRow,
+              unsigned validCol)
+{
+    using D = typename TileDataD::DType;
+    using S = typename TileDataS::DType;
+    constexpr bool plain = TileDataD::SFractal == SLayout::NoneBox && TileDataS::SFractal == SLayout::NoneBox;
+    if constexpr (plain && TileDataD::isRowMajor && TileDataS::isRowMajor) {
+        cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
+            CvtRun<D, S, mode, sat>(dst + r * TileDataD::Cols, src + r * TileDataS::Cols, validCol);
+        });
+    } else if constexpr (plain && !TileDataD::isRowMajor && !TileDataS::isRowMajor) {
+        cpu::parallel_for_rows(validCol, validRow, [&](std::size_t c) {
+            CvtRun<D, S, mode, sat>(dst + c * TileDataD::Rows, src + c * TileDataS::Rows, validRow);
+        });
+    } else {
+        cpu::parallel_for_rows(validRow, validCol, [&](std::size_t r) {
+            for (std::size_t c = 0; c < validCol; ++c) {
+                dst[GetTileElementOffset<TileDataD>(r, c)] =
+                    CvtElement<D, S, mode, sat>(src[GetTileElementOffset<TileDataS>(r, c)]);
+            }
+        });
     }
 }
 
+template <typename TileDataD, typename TileDataS>
+using TCvtTileFn = void (*)(typename TileDataD::DType *, const typename TileDataS::DType *, unsigned, unsigned);
+
+// One specialised converter per RoundMode, indexed by the runtime mode.
+template <typename TileDataD, typename TileDataS, SaturationMode sat, std::size_t... modes>
+constexpr std::array<TCvtTileFn<TileDataD, TileDataS>, sizeof...(modes)> MakeTCvtTable(
+    std::index_sequence<modes...>)
+{
+    return {&TCvtTile<TileDataD, TileDataS, static_cast<RoundMode>(modes), sat>...};
+}
+
 template <typename TileDataD, typename TileDataS>
 PTO_INTERNAL void TCvt_Impl(typename TileDataD::TileDType dst, typename TileDataS::TileDType src, unsigned validRow,
-                            unsigned validCol, RoundMode mode)
+                            unsigned validCol, RoundMode mode, SaturationMode satMode)
 {
-    for (int i = 0; i < validRow; ++i) {
-        for (int j = 0; j < validCol; ++j) {
-            size_t dstIdx = GetTileElementOffset<TileDataD>(i, j);
-            size_t srcIdx = GetTileElementOffset<TileDataS>(i, j);
-            using D = typename TileDataD::DType;
-            using S = typename TileDataS::DType;
-
-            if constexpr (is_float_like_v<S> && std::is_integral_v<D>) {
-                const double dv = static_cast<double>(src[srcIdx]);
-                dst[dstIdx] = static_cast<D>(applyRoundingToIntegral(dv, mode));
-            } else {
-                dst[dstIdx] = static_cast<D>(src[srcIdx]);
-            }
-        }
+    constexpr std::size_t modeNum = static_cast<std::size_t>(RoundMode::CAST_ODD) + 1;
+    static constexpr auto satOn =
+        MakeTCvtTable<TileDataD, TileDataS, SaturationMode::ON>(std::make_index_sequence<modeNum>{});
+    static constexpr auto satOff =
+        MakeTCvtTable<TileDataD, TileDataS, SaturationMode::OFF>(std::make_index_sequence<modeNum>{});
+    std::size_t idx = static_cast<std::size_t>(mode);
+    if (idx >= modeNum) {
+        idx = static_cast<std::size_t>(RoundMode::CAST_RINT);
     }
+    (satMode == SaturationMode::OFF ? satOff : satOn)[idx](dst, src, validRow, validCol);
 }
 
 template <typename TileDataD, typename TileDataS>
-PTO_INTERNAL void TCVT_IMPL(TileDataD &dst, TileDataS &src, RoundMode mode)
+PTO_INTERNAL void TCVT_IMPL(TileDataD &dst, TileDataS &src, RoundMode mode, SaturationMode satMode)
 {
     uint16_t rows = src.GetValidRow();
     uint16_t cols = src.GetValidCol();
-    TCvt_Impl<TileDataD, TileDataS>(dst.data(), src.data(), rows, cols, mode);
+    TCvt_Impl<TileDataD, TileDataS>(dst.data(), src.data(), rows, cols, mode, satMode);
+}
+
+// Same per-conversion defaults as the device: the narrowing pairs below truncate (saturation OFF), the rest clamp.
+template <typename TileDataD, typename TileDataS>
+PTO_INTERNAL void TCVT_IMPL(TileDataD &dst, TileDataS &src, RoundMode mode)
+{
+    using D = typename TileDataD::DType;
+    using S = typename TileDataS::DType;
+    constexpr bool satOffByDefault =
+        (std::is_same_v<D, uint8_t> && std::is_same_v<S, half>) ||
+        (std::is_same_v<D, int8_t> && std::is_same_v<S, half>) ||
+        (std::is_same_v<D, int16_t> && std::is_same_v<S, float>) ||
+        (std::is_same_v<D, int16_t> && std::is_same_v<S, half>) ||
+        (std::is_same_v<D, int32_t> && std::is_same_v<S, int64_t>) ||
+        (std::is_same_v<D, int16_t> && std::is_same_v<S, int32_t>);
+    TCVT_IMPL(dst, src, mode, satOffByDefault ? SaturationMode::OFF : SaturationMode::ON);
 }
 
 } // namespace pto
@@ -12,41 +12,68 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TEXTRACT_HPP
 
 #include <cassert>
+#include "pto/cpu/TMov.hpp"
+#include "pto/cpu/tile_convert.hpp"
 
 namespace pto {
+// dst receives the window of src that starts at (idxRow, idxCol) and spans dst's valid shape.
 template <typename DstTileData, typename SrcTileData>
-PTO_INTERNAL void TEXTRACT_IMPL(DstTileData &dst, SrcTileData &src, uint32_t idxRow = 0, uint32_t idxCol = 0)
+PTO_INTERNAL TileWindow TExtractWindow(DstTileData &dst, SrcTileData &src, uint32_t idxRow, uint32_t idxCol)
 {
-    assert(src.GetValidRow() - idxRow == dst.GetValidRow() && src.GetValidCol() - idxCol == dst.GetValidCol());
-    for (size_t c = idxCol; c < src.GetValidCol(); c++) {
-        const size_t subTileSrcC = c / SrcTileData::InnerCols;
-        const size_t innerSrcC = c % SrcTileData::InnerCols;
-        const size_t cDst = c - idxCol;
-        const size_t subTileDstC = cDst / DstTileData::InnerCols;
-        const size_t innerDstC = cDst % DstTileData::InnerCols;
+    const TileWindow window{idxRow, idxCol, 0, 0, static_cast<size_t>(dst.GetValidRow()),
+                            static_cast<size_t>(dst.GetValidCol())};
+    (void)src;
+    assert(idxRow + window.rows <= static_cast<size_t>(src.GetValidRow()) &&
+           idxCol + window.cols <= static_cast<size_t>(src.GetValidCol()));
+    return window;
+}
 
-        for (size_t r = idxRow; r < src.GetValidRow(); r++) {
-            size_t srcTileIdx;
-            size_t dstTileIdx;
-            if constexpr (SrcTileData::SFractal == SLayout::NoneBox) {
-                srcTileIdx = GetTileElementOffsetPlain<SrcTileData>(r, c);
-            } else {
-                const size_t subTileR = r / SrcTileData::InnerRows;
-                const size_t innerR = r % SrcTileData::InnerRows;
-                srcTileIdx = GetTileElementOffsetSubfractals<SrcTileData>(subTileR, innerR, subTileSrcC, innerSrcC);
-            }
-            const size_t rDst = r - idxRow;
+template <typename DstTileData, typename SrcTileData>
+PTO_INTERNAL void TEXTRACT_IMPL(DstTileData &dst, SrcTileData &src, uint32_t idxRow = 0, uint32_t idxCol = 0)
+{
+    const TileWindow window = TExtractWindow(dst, src, idxRow, idxCol);
+    if constexpr (SrcTileData::Loc == TileType::Acc) {
+        TMovAccWindow<DstTileData, SrcTileData, ReluPreMode::NoRelu, false>(
+            dst, src, window, [](std::size_t) { return FixpipeQuant{}; });
+    } else {
+        MoveTileWindow<DstTileData, SrcTileData>(dst.data(), src.data(), window);
+    }
+}
 
-            if constexpr (DstTileData::SFractal == SLayout::NoneBox) {
-                dstTileIdx = GetTileElementOffsetPlain<DstTileData>(rDst, cDst);
-            } else {
-                const size_t subTileR = rDst / DstTileData::InnerRows;
-                const size_t innerR = rDst % DstTileData::InnerRows;
-                dstTileIdx = GetTileElementOffsetSubfractals<DstTileData>(subTileR, innerR, subTileDstC, innerDstC);
-            }
-            dst.data()[dstTileIdx] = src.data()[srcTileIdx];
+template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode>
+PTO_INTERNAL void TEXTRACT_IMPL(DstTileData &dst, SrcTileData &src, uint32_t idxRow, uint32_t idxCol)
+{
+    const TileWindow window = TExtractWindow(dst, src, idxRow, idxCol);
+    if constexpr (SrcTileData::Loc == TileType::Acc) {
+        TMovAccWindow<DstTileData, SrcTileData, reluMode, false>(dst, src, window,
+                                                                 [](std::size_t) { return FixpipeQuant{}; });
+    } else {
+        MoveTileWindow<DstTileData, SrcTileData>(dst.data(), src.data(), window);
+        if constexpr (reluMode == ReluPreMode::NormalRelu) {
+            TMovRelu(dst, 0, 0, window.rows, window.cols);
         }
     }
 }
+
+template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode = ReluPreMode::NoRelu>
+PTO_INTERNAL void TEXTRACT_IMPL(DstTileData &dst, SrcTileData &src, uint64_t preQuantScalar, uint32_t idxRow,
+                                uint32_t idxCol)
+{
+    const FixpipeQuant quant = DecodeQuantPre(preQuantScalar);
+    TMovAccWindow<DstTileData, SrcTileData, reluMode, true>(dst, src, TExtractWindow(dst, src, idxRow, idxCol),
+                                                            [&quant](std::size_t) { return quant; });
+}
+
+// The fp tile holds one quant word per dst column.
+template <typename DstTileData, typename SrcTileData, typename FpTileData, ReluPreMode reluMode = ReluPreMode::NoRelu>
+PTO_INTERNAL void TEXTRACT_IMPL(DstTileData &dst, SrcTileData &src, FpTileData &fp, uint32_t idxRow, uint32_t idxCol)
+{
+    static_assert(sizeof(typename FpTileData::DType) == sizeof(uint64_t), "Fp tile must hold 64-bit quant words");
+    const typename FpTileData::DType *words = fp.data();
+    TMovAccWindow<DstTileData, SrcTileData, reluMode, true>(
+        dst, src, TExtractWindow(dst, src, idxRow, idxCol), [words, idxCol](std::size_t c) {
+            return DecodeQuantPre(static_cast<uint64_t>(words[GetTileElementOffset<FpTileData>(0, c - idxCol)]));
+        });
+}
 } // namespace pto
 #endif // TEXTRACT_HPP
@@ -51,7 +51,7 @@ PTO_INTERNAL void TGATHERB_IMPL(TileDataDst &dst, TileDataSrc &src, TileDataOffs
     static_assert(TileDataDst::isRowMajor, "TGATHERB: not supported Layout type.");
     unsigned validRow = dst.GetValidRow();
     unsigned validCol = dst.GetValidCol();
-    assert(validCol * sizeof(typename TileDataDst::TileDType) % 32 == 0);
+    assert(validCol * sizeof(typename TileDataDst::DType) % 32 == 0);
     TGatherB<TileDataDst, TileDataSrc, TileDataOffset>(dst.data(), src.data(), offset.data(), validRow, validCol);
 }
 } // namespace pto
@@ -0,0 +1,79 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef TINSERT_HPP
+#define TINSERT_HPP
+
+#include <cassert>
+#include "pto/cpu/TMov.hpp"
+#include "pto/cpu/tile_convert.hpp"
+
+namespace pto {
+// src's valid shape lands in dst at (idxRow, idxCol).
+template <typename DstTileData, typename SrcTileData>
+PTO_INTERNAL TileWindow TInsertWindow(DstTileData &dst, SrcTileData &src, uint32_t idxRow, uint32_t idxCol)
+{
+    const TileWindow window{0, 0, idxRow, idxCol, static_cast<size_t>(src.GetValidRow()),
+                            static_cast<size_t>(src.GetValidCol())};
+    (void)dst;
+    assert(idxRow + window.rows <= static_cast<size_t>(dst.GetValidRow()) &&
+           idxCol + window.cols <= static_cast<size_t>(dst.GetValidCol()));
+    return window;
+}
+
+template <typename DstTileData, typename SrcTileData>
+PTO_INTERNAL void TINSERT_IMPL(DstTileData &dst, SrcTileData &src, uint32_t idxRow = 0, uint32_t idxCol = 0)
+{
+    const TileWindow window = TInsertWindow(dst, src, idxRow, idxCol);
+    if constexpr (SrcTileData::Loc == TileType::Acc) {
+        TMovAccWindow<DstTileData, SrcTileData, ReluPreMode::NoRelu, false>(
+            dst, src, window, [](std::size_t) { return FixpipeQuant{}; });
+    } else {
+        MoveTileWindow<DstTileData, SrcTileData>(dst.data(), src.data(), window);
+    }
+}
+
+template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode>
+PTO_INTERNAL void TINSERT_IMPL(DstTileData &dst, SrcTileData &src, uint32_t idxRow, uint32_t idxCol)
+{
+    const TileWindow window = TInsertWindow(dst, src, idxRow, idxCol);
+    if constexpr (SrcTileData::Loc == TileType::Acc) {
+        TMovAccWindow<DstTileData, SrcTileData, reluMode, false>(dst, src, window,
+                                                                 [](std::size_t) { return FixpipeQuant{}; });
+    } else {
+        MoveTileWindow<DstTileData, SrcTileData>(dst.data(), src.data(), window);
+        if constexpr (reluMode == ReluPreMode::NormalRelu) {
+            TMovRelu(dst, idxRow, idxCol, window.rows, window.cols);
+        }
+    }
+}
+
+template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode = ReluPreMode::NoRelu>
+PTO_INTERNAL void TINSERT_IMPL(DstTileData &dst, SrcTileData &src, uint64_t preQuantScalar, uint32_t idxRow,
+                                uint32_t idxCol)
+{
+    const FixpipeQuant quant = DecodeQuantPre(preQuantScalar);
+    TMovAccWindow<DstTileData, SrcTileData, reluMode, true>(dst, src, TInsertWindow(dst, src, idxRow, idxCol),
+                                                            [&quant](std::size_t) { return quant; });
+}
+
+// The fp tile holds one quant word per src column.
+template <typename DstTileData, typename SrcTileData, typename FpTileData, ReluPreMode reluMode = ReluPreMode::NoRelu>
+PTO_INTERNAL void TINSERT_IMPL(DstTileData &dst, SrcTileData &src, FpTileData &fp, uint32_t idxRow, uint32_t idxCol)
+{
+    static_assert(sizeof(typename FpTileData::DType) == sizeof(uint64_t), "Fp tile must hold 64-bit quant words");
+    const typename FpTileData::DType *words = fp.data();
+    TMovAccWindow<DstTileData, SrcTileData, reluMode, true>(
+        dst, src, TInsertWindow(dst, src, idxRow, idxCol), [words](std::size_t c) {
+            return DecodeQuantPre(static_cast<uint64_t>(words[GetTileElementOffset<FpTileData>(0, c)]));
+        });
+}
+} // namespace pto
+#endif // TINSERT_HPP
@@ -13,7 +13,10 @@ See LICENSE in the root of the software repository for the full text of the Lice
 
 #include <unistd.h>
 #include <cassert>
+#include "pto/cpu/mx_formats.hpp"
 #include "pto/cpu/parallel.hpp"
+#include "pto/cpu/strided_copy.hpp"
+#include "pto/cpu/tile_offsets.hpp"
 
 namespace pto {
 template <typename TileData>
@@ -36,7 +39,7 @@ AICORE constexpr typename TileData::DType getPadValue()
                 return std::numeric_limits<typename TileData::DType>::max();
             }
     }
-    return 0;
+    return typename TileData::DType(0);
 }
 
 template <typename GlobalData, typename TileData, std::enable_if_t<TileData::isRowMajor, int> = 0>
@@ -45,14 +48,14 @@ __tf__ PTO_INLINE void LoadPlainMatrix(typename GlobalData::DType __out__ *dst,
                                        size_t idx3)
 {
     size_t offsetDstBase = idx3 * gShape3 * TileData::Cols;
+    const std::size_t cols = static_cast<std::size_t>(gShape4);
+    const typename GlobalData::DType padValue = getPadValue<TileData>();
     cpu::parallel_for_1d(0, static_cast<std::size_t>(gShape3), static_cast<std::size_t>(gShape3) * gShape4,
                          [&](std::size_t r) {
-                             const std::size_t dstBase = offsetDstBase + r * TileData::Cols;
-                             const std::size_t srcBase = r * static_cast<std::size_t>(gStride3);
-                             PTO_CPU_VECTORIZE_LOOP
-                             for (std::size_t c = 0; c < static_cast<std::size_t>(gShape4); c++) {
-                                 dst[dstBase + c] = src[srcBase + c * static_cast<std::size_t>(gStride4)];
-                             }
+                             typename GlobalData::DType *dstRow = dst + offsetDstBase + r * TileData::Cols;
+                             cpu::CopyRun(dstRow, src + r * static_cast<std::size_t>(gStride3), cols, 1,
+                                          static_cast<std::size_t>(gStride4));
+                             cpu::FillRun(dstRow + cols, TileData::Cols - cols, padValue);
                          });
 }
 template <typename GlobalData, typename TileData, std::enable_if_t<!TileData::isRowMajor, int> = 0>
@@ -61,13 +64,14 @@ __tf__ PTO_INLINE void LoadPlainMatrix(typename GlobalData::DType __out__ *dst,
                                        size_t idx3)
 {
     size_t offsetDstBase = idx3 * gShape4 * TileData::Rows;
+    const std::size_t rows = static_cast<std::size_t>(gShape3);
+    const typename GlobalData::DType padValue = getPadValue<TileData>();
     cpu::parallel_for_1d(0, static_cast<std::size_t>(gShape4), static_cast<std::size_t>(gShape3) * gShape4,
                          [&](std::size_t c) {
-                             const std::size_t dstBase = offsetDstBase + c * TileData::Rows;
-                             const std::size_t srcStride4 = static_cast<std::size_t>(gStride4);
-                             for (std::size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
-                                 dst[dstBase + r] = src[r * static_cast<std::size_t>(gStride3) + c * srcStride4];
-                             }
+                             typename GlobalData::DType *dstCol = dst + offsetDstBase + c * TileData::Rows;
+                             cpu::CopyRun(dstCol, src + c * static_cast<std::size_t>(gStride4), rows, 1,
+                                          static_cast<std::size_t>(gStride3));
+                             cpu::FillRun(dstCol + rows, TileData::Rows - rows, padValue);
                          });
 }
 
@@ -99,22 +103,25 @@ __tf__ PTO_INLINE void LoadSubfractalMatrix(typename GlobalData::DType __out__ *
                                             typename TileData::TileDType __in__ src, int gShape3, int gShape4,
                                             int gStride3, int gStride4, int validRow, int validCol)
 {
-    // Zn layout
-    cpu::parallel_for_1d(
-        0, static_cast<std::size_t>(gShape4), static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t c) {
-            size_t subTileC = c / TileData::InnerCols;
-            size_t innerC = c % TileData::InnerCols;
-            for (size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
-                size_t subTileR = r / TileData::InnerRows;
-                size_t innerR = r % TileData::InnerRows;
-
-                size_t tile_idx = subTileR * TileData::Cols * TileData::InnerRows + subTileC * TileData::InnerNumel +
-                                  innerC * TileData::InnerRows + innerR;
-
-                size_t gd_idx = r * static_cast<std::size_t>(gStride3) + c * static_cast<std::size_t>(gStride4);
-                dst[tile_idx] = src[gd_idx];
+    // Zn layout: each block row is a column-major InnerRows x Cols strip, so every strip column is one run.
+    constexpr std::size_t innerRows = TileData::InnerRows;
+    constexpr std::size_t blocks = (TileData::Rows + innerRows - 1) / innerRows;
+    const typename GlobalData::DType padValue = getPadValue<TileData>();
+    cpu::parallel_for_1d(0, blocks, static_cast<std::size_t>(TileData::Numel), [&](std::size_t subTileR) {
+        const std::size_t r0 = subTileR * innerRows;
+        const std::size_t height = std::min(innerRows, TileData::Rows - r0);
+        const std::size_t validHeight =
+            r0 < static_cast<std::size_t>(gShape3) ? std::min(height, gShape3 - r0) : std::size_t(0);
+        typename GlobalData::DType *strip = dst + subTileR * TileData::Cols * innerRows;
+        for (std::size_t c = 0; c < static_cast<std::size_t>(TileData::Cols); c++) {
+            typename GlobalData::DType *column = strip + c * innerRows;
+            const std::size_t n = c < static_cast<std::size_t>(gShape4) ? validHeight : 0;
+            if (n != 0) {
+                cpu::CopyRun(column, src + r0 * gStride3 + c * gStride4, n, 1, static_cast<std::size_t>(gStride3));
             }
-        });
+            cpu::FillRun(column + n, height - n, padValue);
+        }
+    });
 }
 
 template <typename GlobalData, typename TileData, std::enable_if_t<!TileData::isRowMajor, int> = 0>
@@ -122,22 +129,25 @@ __tf__ PTO_INLINE void LoadSubfractalMatrix(typename GlobalData::DType __out__ *
                                             typename TileData::TileDType __in__ src, int gShape3, int gShape4,
                                             int gStride3, int gStride4, int validRow, int validCol)
 {
-    // Nz layout
-    cpu::parallel_for_1d(
-        0, static_cast<std::size_t>(gShape4), static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t c) {
-            size_t subTileC = c / TileData::InnerCols;
-            size_t innerC = c % TileData::InnerCols;
-            for (size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
-                size_t subTileR = r / TileData::InnerRows;
-                size_t innerR = r % TileData::InnerRows;
-
-                size_t tile_idx = subTileC * TileData::Rows * TileData::InnerCols + subTileR * TileData::InnerNumel +
-                                  innerR * TileData::InnerCols + innerC;
-                size_t gd_idx = r * static_cast<std::size_t>(gStride3) + c * static_cast<std::size_t>(gStride4);
-
-                dst[tile_idx] = src[gd_idx];
+    // Nz layout: each block column is a row-major Rows x InnerCols strip, so every strip row is one run.
+    constexpr std::size_t innerCols = TileData::InnerCols;
+    constexpr std::size_t blocks = (TileData::Cols + innerCols - 1) / innerCols;
+    const typename GlobalData::DType padValue = getPadValue<TileData>();
+    cpu::parallel_for_1d(0, blocks, static_cast<std::size_t>(TileData::Numel), [&](std::size_t subTileC) {
+        const std::size_t c0 = subTileC * innerCols;
+        const std::size_t width = std::min(innerCols, TileData::Cols - c0);
+        const std::size_t validWidth =
+            c0 < static_cast<std::size_t>(gShape4) ? std::min(width, gShape4 - c0) : std::size_t(0);
+        typename GlobalData::DType *strip = dst + subTileC * TileData::Rows * innerCols;
+        for (std::size_t r = 0; r < static_cast<std::size_t>(TileData::Rows); r++) {
+            typename GlobalData::DType *row = strip + r * innerCols;
+            const std::size_t n = r < static_cast<std::size_t>(gShape3) ? validWidth : 0;
+            if (n != 0) {
+                cpu::CopyRun(row, src + r * gStride3 + c0 * gStride4, n, 1, static_cast<std::size_t>(gStride4));
             }
-        });
+            cpu::FillRun(row + n, width - n, padValue);
+        }
+    });
 }
 
 template <typename TileData, typename GlobalData>
@@ -148,19 +158,41 @@ __tf__ AICORE void TLoad(typename TileData::TileDType __out__ dst, typename Glob
     assert((gShape0 * gShape1 * gShape2 * gShape3 == validRow && gShape4 == validCol && TileData::isRowMajor) ||
            (gShape0 * gShape1 * gShape2 * gShape4 == validCol && gShape3 == validRow && !TileData::isRowMajor));
 
-    // Filling padding
-    std::fill(dst, dst + (TileData::Cols * TileData::Rows), getPadValue<TileData>());
-
-    // Filling data
-    if (TileData::SFractal == SLayout::NoneBox) {
+    // Every path below writes each tile element exactly once, padding the invalid region as it goes.
+    if constexpr (TileData::SFractal == SLayout::NoneBox) {
         LoadPlain<GlobalData, TileData>(dst, src, gShape0, gShape1, gShape2, gShape3, gShape4, gStride0, gStride1,
                                         gStride2, gStride3, gStride4, validRow, validCol);
+        // Valid lines padded their own tails; only the lines past the valid region remain.
+        if constexpr (TileData::isRowMajor) {
+            cpu::FillRun(dst + static_cast<std::size_t>(validRow) * TileData::Cols,
+                         static_cast<std::size_t>(TileData::Rows - validRow) * TileData::Cols,
+                         getPadValue<TileData>());
+        } else {
+            cpu::FillRun(dst + static_cast<std::size_t>(validCol) * TileData::Rows,
+                         static_cast<std::size_t>(TileData::Cols - validCol) * TileData::Rows,
+                         getPadValue<TileData>());
+        }
     } else {
         assert(gShape0 == 1 && gShape1 == 1 && gShape2 == 1 && "ND,DN -> Nz,Zn convertion does support only 2D GMs");
         LoadSubfractalMatrix<GlobalData, TileData>(dst, src, gShape3, gShape4, gStride3, gStride4, validRow, validCol);
     }
 }
 
+// float4 GM and tiles hold two elements per byte and shapes and strides count elements, so every element moves as a
+// nibble, serially since neighbours share a byte. Elements outside the GM shape are zero.
+template <typename TileData, typename GlobalData>
+PTO_INTERNAL void TLoadFp4(typename TileData::TileDType dst, typename GlobalData::DType *src, int gShape3, int gShape4,
+                           int gStride3, int gStride4)
+{
+    for (std::size_t r = 0; r < static_cast<std::size_t>(TileData::Rows); ++r) {
+        for (std::size_t c = 0; c < static_cast<std::size_t>(TileData::Cols); ++c) {
+            const bool valid = r < static_cast<std::size_t>(gShape3) && c < static_cast<std::size_t>(gShape4);
+            MxSetNibble(dst, GetTileElementOffset<TileData>(r, c),
+                        valid ? MxNibble(src, r * gStride3 + c * gStride4) : 0u);
+        }
+    }
+}
+
 template <typename TileData, typename GlobalData>
 PTO_INTERNAL void TLOAD_TILE_IMPL(TileData &dst, GlobalData &src)
 {
@@ -168,6 +200,15 @@ PTO_INTERNAL void TLOAD_TILE_IMPL(TileData &dst, GlobalData &src)
                   "Source dtype must be same with dst dtype");
     static_assert(GlobalData::layout == pto::Layout::ND || GlobalData::layout == pto::Layout::DN,
                   "Only ND and DN GLobal Tensors are currently supported");
+    if constexpr (IsMxFp4<typename TileData::DType>) {
+        assert(src.GetShape(pto::GlobalTensorDim::DIM_0) == 1 && src.GetShape(pto::GlobalTensorDim::DIM_1) == 1 &&
+               src.GetShape(pto::GlobalTensorDim::DIM_2) == 1 && "float4 loads support only 2D GMs");
+        TLoadFp4<TileData, GlobalData>(dst.data(), src.data(), src.GetShape(pto::GlobalTensorDim::DIM_3),
+                                       src.GetShape(pto::GlobalTensorDim::DIM_4),
+                                       src.GetStride(pto::GlobalTensorDim::DIM_3),
+                                       src.GetStride(pto::GlobalTensorDim::DIM_4));
+        return;
+    }
     TLoad<TileData, GlobalData>(dst.data(), src.data(), src.GetShape(pto::GlobalTensorDim::DIM_0),
                                 src.GetShape(pto::GlobalTensorDim::DIM_1), src.GetShape(pto::GlobalTensorDim::DIM_2),
                                 src.GetShape(pto::GlobalTensorDim::DIM_3), src.GetShape(pto::GlobalTensorDim::DIM_4),
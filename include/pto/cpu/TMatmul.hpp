@@ -11,30 +11,165 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #ifndef TMATMUL_HPP
 #define TMATMUL_HPP
 
+#include "pto/cpu/mx_formats.hpp"
 #include "pto/cpu/tile_offsets.hpp"
 #include "pto/cpu/parallel.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace pto {
-template <typename TileAcc, typename TileLeft, typename TileRight>
-void TMatmulNzZn(typename TileAcc::TileDType dst, typename TileAcc::TileDType acc, typename TileLeft::TileDType src0,
-                 typename TileRight::TileDType src1, uint16_t M, uint16_t N, uint16_t K)
+// Register block of the GEMM micro-kernel: MR rows of A by NR columns of B.
+constexpr std::size_t MATMUL_MR = 4;
+constexpr std::size_t MATMUL_NR = 16;
+
+// Packs the Nz left operand into MR-row panels laid out as [k][MR]. load(offset, i, k) returns element (i, k),
+// stored at tile offset `offset`, as an AccT.
+template <typename AccT, typename TileLeft, typename Load>
+PTO_INTERNAL void PackMatmulLeft(std::vector<AccT> &packed, uint16_t M, uint16_t K, Load &&load)
 {
-    cpu::parallel_for_1d(0, M, static_cast<std::size_t>(M) * N * K, [&](std::size_t i) {
-        for (uint16_t j = 0; j < N; j++) {
-            typename TileAcc::DType mul_acc = 0;
+    const std::size_t panels = (M + MATMUL_MR - 1) / MATMUL_MR;
+    packed.assign(panels * MATMUL_MR * K, AccT(0));
+    for (std::size_t i = 0; i < M; i++) {
+        AccT *panel = packed.data() + (i / MATMUL_MR) * MATMUL_MR * K + (i % MATMUL_MR);
+        const std::size_t row = GetTileRowOffset<TileLeft>(i);
+        for (std::size_t k = 0; k < K; k++) {
+            panel[k * MATMUL_MR] = load(row + GetTileColOffset<TileLeft>(k), i, k);
+        }
+    }
+}
 
+// Packs the Zn right operand into NR-column panels laid out as [k][NR]. load(offset, k, j) returns element (k, j).
+template <typename AccT, typename TileRight, typename Load>
+PTO_INTERNAL void PackMatmulRight(std::vector<AccT> &packed, uint16_t N, uint16_t K, Load &&load)
+{
+    const std::size_t panels = (N + MATMUL_NR - 1) / MATMUL_NR;
+    packed.assign(panels * MATMUL_NR * K, AccT(0));
+    for (std::size_t j = 0; j < N; j++) {
+        AccT *panel = packed.data() + (j / MATMUL_NR) * MATMUL_NR * K + (j % MATMUL_NR);
+        const std::size_t col = GetTileColOffset<TileRight>(j);
+        for (std::size_t k = 0; k < K; k++) {
+            panel[k * MATMUL_NR] = load(col + GetTileRowOffset<TileRight>(k), k, j);
+        }
+    }
+}
+
+// c[MR][NR] = sum over k of a[k][:] x b[k][:], accumulated in k order like the scalar reference.
+template <typename AccT>
+PTO_INTERNAL void MatmulMicroKernel(AccT (&c)[MATMUL_MR][MATMUL_NR], const AccT *a, const AccT *b, uint16_t K)
+{
+    for (std::size_t r = 0; r < MATMUL_MR; r++) {
+        PTO_CPU_VECTORIZE_LOOP
+        for (std::size_t j = 0; j < MATMUL_NR; j++) {
+            c[r][j] = 0;
+        }
+    }
+    for (std::size_t k = 0; k < K; k++) {
+        const AccT *ak = a + k * MATMUL_MR;
+        const AccT *bk = b + k * MATMUL_NR;
+        for (std::size_t r = 0; r < MATMUL_MR; r++) {
+            const AccT ar = ak[r];
             PTO_CPU_VECTORIZE_LOOP
-            for (uint16_t k = 0; k < K; k++) {
-                size_t src0Idx = GetTileElementOffset<TileLeft>(i, k);
-                size_t src1Idx = GetTileElementOffset<TileRight>(k, j);
-                mul_acc += static_cast<typename TileAcc::DType>(src0[src0Idx]) *
-                           static_cast<typename TileAcc::DType>(src1[src1Idx]);
+            for (std::size_t j = 0; j < MATMUL_NR; j++) {
+                c[r][j] += ar * bk[j];
+            }
+        }
+    }
+}
+
+// dst = [acc +] A * B [+ bias] from operands packed by PackMatmulLeft/PackMatmulRight. acc may alias dst; bias is
+// indexed by column and may be null.
+template <typename TileAcc>
+void TMatmulPacked(typename TileAcc::TileDType dst, typename TileAcc::TileDType acc,
+                   const typename TileAcc::DType *aBase, const typename TileAcc::DType *bBase, uint16_t M, uint16_t N,
+                   uint16_t K, const typename TileAcc::DType *bias)
+{
+    using AccT = typename TileAcc::DType;
+    const std::size_t mPanels = (M + MATMUL_MR - 1) / MATMUL_MR;
+    const std::size_t nPanels = (N + MATMUL_NR - 1) / MATMUL_NR;
+    cpu::parallel_for_1d(0, mPanels * nPanels, static_cast<std::size_t>(M) * N * K, [&](std::size_t p) {
+        const std::size_t mp = p / nPanels;
+        const std::size_t np = p % nPanels;
+        AccT c[MATMUL_MR][MATMUL_NR];
+        MatmulMicroKernel<AccT>(c, aBase + mp * MATMUL_MR * K, bBase + np * MATMUL_NR * K, K);
+
+        const std::size_t i0 = mp * MATMUL_MR;
+        const std::size_t j0 = np * MATMUL_NR;
+        const std::size_t rows = std::min<std::size_t>(MATMUL_MR, M - i0);
+        const std::size_t cols = std::min<std::size_t>(MATMUL_NR, N - j0);
+        for (std::size_t r = 0; r < rows; r++) {
+            const std::size_t dstRow = GetTileRowOffset<TileAcc>(i0 + r);
+            for (std::size_t j = 0; j < cols; j++) {
+                AccT v = c[r][j];
+                if (bias != nullptr) {
+                    v += bias[j0 + j];
+                }
+                const std::size_t dstIdx = dstRow + GetTileColOffset<TileAcc>(j0 + j);
+                dst[dstIdx] = acc ? acc[dstIdx] + v : v;
             }
+        }
+    });
+}
 
-            size_t dstIdx = GetTileElementOffset<TileAcc>(i, j);
-            dst[dstIdx] = acc ? acc[dstIdx] + mul_acc : mul_acc;
+// dst = [acc +] A * B [+ bias]. acc may alias dst; bias is indexed by column and may be null.
+template <typename TileAcc, typename TileLeft, typename TileRight>
+void TMatmulNzZn(typename TileAcc::TileDType dst, typename TileAcc::TileDType acc, typename TileLeft::TileDType src0,
+                 typename TileRight::TileDType src1, uint16_t M, uint16_t N, uint16_t K,
+                 const typename TileAcc::DType *bias = nullptr)
+{
+    using AccT = typename TileAcc::DType;
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    thread_local std::vector<AccT> packedA;
+    thread_local std::vector<AccT> packedB;
+    PackMatmulLeft<AccT, TileLeft>(
+        packedA, M, K, [src0](std::size_t o, std::size_t, std::size_t) { return static_cast<AccT>(src0[o]); });
+    PackMatmulRight<AccT, TileRight>(
+        packedB, N, K, [src1](std::size_t o, std::size_t, std::size_t) { return static_cast<AccT>(src1[o]); });
+    TMatmulPacked<TileAcc>(dst, acc, packedA.data(), packedB.data(), M, N, K, bias);
+}
+
+// MX matmul: dst = [acc +] (scaleA x A) * (scaleB x B) [+ bias], where A(i, k) is scaled by scaleA(i, k / 32) and
+// B(k, j) by scaleB(k / 32, j). Elements decode through the format tables and the block scales are folded in while
+// packing, so the product runs on the float micro-kernel.
+template <typename TileAcc, typename TileLeft, typename TileLeftScale, typename TileRight, typename TileRightScale>
+void TMatmulMx(typename TileAcc::TileDType dst, typename TileAcc::TileDType acc, typename TileLeft::TileDType src0,
+               typename TileLeftScale::TileDType scale0, typename TileRight::TileDType src1,
+               typename TileRightScale::TileDType scale1, uint16_t M, uint16_t N, uint16_t K,
+               const float *bias = nullptr)
+{
+    if (M == 0 || N == 0) {
+        return;
+    }
+    const std::size_t blocks = (K + MX_SCALE_BLOCK - 1) / MX_SCALE_BLOCK;
+    thread_local std::vector<float> scaleA;
+    thread_local std::vector<float> scaleB;
+    scaleA.resize(M * blocks);
+    scaleB.resize(blocks * N);
+    for (std::size_t i = 0; i < M; i++) {
+        for (std::size_t b = 0; b < blocks; b++) {
+            scaleA[i * blocks + b] = MxDecode(scale0, GetTileElementOffset<TileLeftScale>(i, b));
         }
+    }
+    for (std::size_t b = 0; b < blocks; b++) {
+        for (std::size_t j = 0; j < N; j++) {
+            scaleB[j * blocks + b] = MxDecode(scale1, GetTileElementOffset<TileRightScale>(b, j));
+        }
+    }
+
+    thread_local std::vector<float> packedA;
+    thread_local std::vector<float> packedB;
+    const float *sA = scaleA.data();
+    const float *sB = scaleB.data();
+    PackMatmulLeft<float, TileLeft>(packedA, M, K, [&](std::size_t o, std::size_t i, std::size_t k) {
+        return MxDecode(src0, o) * sA[i * blocks + k / MX_SCALE_BLOCK];
     });
+    PackMatmulRight<float, TileRight>(packedB, N, K, [&](std::size_t o, std::size_t k, std::size_t j) {
+        return MxDecode(src1, o) * sB[j * blocks + k / MX_SCALE_BLOCK];
+    });
+    TMatmulPacked<TileAcc>(dst, acc, packedA.data(), packedB.data(), M, N, K, bias);
 }
 
 template <typename TileAcc, typename TileLeft, typename TileRight>
@@ -105,14 +240,117 @@ PTO_INTERNAL void TMATMUL_BIAS_IMPL(TileAcc &cMatrix, TileLeft &aMatrix, TileRig
     uint16_t k = aMatrix.GetValidCol();
     uint16_t n = bMatrix.GetValidCol();
 
-    TMatmulNzZn<TileAcc, TileLeft, TileRight>(cMatrix.data(), nullptr, aMatrix.data(), bMatrix.data(), m, n, k);
+    thread_local std::vector<typename TileAcc::DType> bias;
+    bias.resize(n);
     for (size_t c = 0; c < n; c++) {
-        for (size_t r = 0; r < m; r++) {
-            size_t out_idx = GetTileElementOffset<TileAcc>(r, c);
-            size_t bias_idx = GetTileElementOffset<TileBias>(0, c);
-            cMatrix.data()[out_idx] += biasMatrix.data()[bias_idx];
-        }
+        bias[c] = biasMatrix.data()[GetTileElementOffset<TileBias>(0, c)];
+    }
+    TMatmulNzZn<TileAcc, TileLeft, TileRight>(cMatrix.data(), nullptr, aMatrix.data(), bMatrix.data(), m, n, k,
+                                              bias.data());
+}
+
+template <typename A, typename B>
+constexpr bool IsMxMatmulCombo = (IsMxFp8<A> && IsMxFp8<B>) || (IsMxFp4<A> && IsMxFp4<B>);
+
+template <typename TileAcc, typename TileLeft, typename TileLeftScale, typename TileRight, typename TileRightScale>
+PTO_INTERNAL void CheckMadMxValid()
+{
+    static_assert(IsMxMatmulCombo<typename TileLeft::DType, typename TileRight::DType> &&
+                      std::is_same_v<typename TileAcc::DType, float>,
+                  "TMatmulMX:No supported data type combination.");
+    static_assert(std::is_same_v<typename TileLeftScale::DType, float8_e8m0_t> &&
+                      std::is_same_v<typename TileRightScale::DType, float8_e8m0_t>,
+                  "TMatmulMX:Scales must be float8_e8m0_t.");
+    static_assert(TileLeft::Cols % 64 == 0, "TMatmulMX: aMatrixCol must be a multiple of 64.");
+    static_assert(
+        ((TileLeft::Loc == TileType::Left) && (!TileLeft::isRowMajor) && (TileLeft::SFractal == SLayout::RowMajor)) &&
+            ((TileRight::Loc == TileType::Right) && (TileRight::isRowMajor) &&
+             (TileRight::SFractal == SLayout::ColMajor)) &&
+            ((TileAcc::Loc == TileType::Acc) && (!TileAcc::isRowMajor) && (TileAcc::SFractal == SLayout::RowMajor)),
+        "TMatmulMX:Non-conforming matrix fractal");
+    static_assert(TileLeftScale::Loc == TileType::ScaleLeft && TileRightScale::Loc == TileType::ScaleRight,
+                  "TMatmulMX:Non-conforming scale tile");
+}
+
+// Runs one MX product of m rows; the scale tiles must cover every 32-element block of k.
+template <typename TileAcc, typename TileLeft, typename TileLeftScale, typename TileRight, typename TileRightScale>
+PTO_INTERNAL void TMatmulMxTiles(TileAcc &cOut, typename TileAcc::TileDType cIn, TileLeft &a, TileLeftScale &aScale,
+                                 TileRight &b, TileRightScale &bScale, uint16_t m, const float *bias = nullptr)
+{
+    CheckMadMxValid<TileAcc, TileLeft, TileLeftScale, TileRight, TileRightScale>();
+    const uint16_t k = a.GetValidCol();
+    const uint16_t n = b.GetValidCol();
+    PTO_ASSERT((k + MX_SCALE_BLOCK - 1) / MX_SCALE_BLOCK <= TileLeftScale::Cols &&
+                   (k + MX_SCALE_BLOCK - 1) / MX_SCALE_BLOCK <= TileRightScale::Rows && m <= TileLeftScale::Rows &&
+                   n <= TileRightScale::Cols,
+               "TMatmulMX: scale tiles do not cover the operands.");
+    TMatmulMx<TileAcc, TileLeft, TileLeftScale, TileRight, TileRightScale>(
+        cOut.data(), cIn, a.data(), aScale.data(), b.data(), bScale.data(), m, n, k, bias);
+}
+
+template <typename TileBias>
+PTO_INTERNAL const float *TMatmulMxBias(TileBias &biasMatrix, uint16_t n)
+{
+    static_assert(std::is_same_v<typename TileBias::DType, float>, "TMatmulMX:No supported bias data type.");
+    static_assert((TileBias::Loc == TileType::Bias) && (TileBias::Rows == 1), "TMatmulMX:TileBias must be single row.");
+    thread_local std::vector<float> bias;
+    bias.resize(n);
+    for (size_t c = 0; c < n; c++) {
+        bias[c] = biasMatrix.data()[GetTileElementOffset<TileBias>(0, c)];
     }
+    return bias.data();
+}
+
+// The accumulation phase only schedules the device pipeline, so the CPU ignores it.
+template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename TileLeft, typename TileLeftScale,
+          typename TileRight, typename TileRightScale>
+PTO_INTERNAL void TMATMUL_MX_IMPL(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale &aScaleMatrix, TileRight &bMatrix,
+                                  TileRightScale &bScaleMatrix)
+{
+    TMatmulMxTiles(cMatrix, nullptr, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, aMatrix.GetValidRow());
+}
+
+template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename TileLeft, typename TileLeftScale,
+          typename TileRight, typename TileRightScale>
+PTO_INTERNAL void TMATMUL_MX_IMPL(TileRes &cOutMatrix, TileRes &cInMatrix, TileLeft &aMatrix,
+                                  TileLeftScale &aScaleMatrix, TileRight &bMatrix, TileRightScale &bScaleMatrix)
+{
+    TMatmulMxTiles(cOutMatrix, cInMatrix.data(), aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, aMatrix.GetValidRow());
+}
+
+template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename TileLeft, typename TileLeftScale,
+          typename TileRight, typename TileRightScale, typename TileBias>
+PTO_INTERNAL void TMATMUL_MX_IMPL(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale &aScaleMatrix, TileRight &bMatrix,
+                                  TileRightScale &bScaleMatrix, TileBias &biasData)
+{
+    TMatmulMxTiles(cMatrix, nullptr, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, aMatrix.GetValidRow(),
+                   TMatmulMxBias(biasData, bMatrix.GetValidCol()));
+}
+
+// GEMV forms: only the first row of the left operand takes part.
+template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename TileLeft, typename TileLeftScale,
+          typename TileRight, typename TileRightScale>
+PTO_INTERNAL void TGEMV_MX_IMPL(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale &aScaleMatrix, TileRight &bMatrix,
+                                TileRightScale &bScaleMatrix)
+{
+    TMatmulMxTiles(cMatrix, nullptr, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, 1);
+}
+
+template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename TileLeft, typename TileLeftScale,
+          typename TileRight, typename TileRightScale>
+PTO_INTERNAL void TGEMV_MX_IMPL(TileRes &cOutMatrix, TileRes &cInMatrix, TileLeft &aMatrix, TileLeftScale &aScaleMatrix,
+                                TileRight &bMatrix, TileRightScale &bScaleMatrix)
+{
+    TMatmulMxTiles(cOutMatrix, cInMatrix.data(), aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, 1);
+}
+
+template <AccPhase Phase = AccPhase::Unspecified, typename TileRes, typename TileLeft, typename TileLeftScale,
+          typename TileRight, typename TileRightScale, typename TileBias>
+PTO_INTERNAL void TGEMV_MX_IMPL(TileRes &cMatrix, TileLeft &aMatrix, TileLeftScale &aScaleMatrix, TileRight &bMatrix,
+                                TileRightScale &bScaleMatrix, TileBias &biasData)
+{
+    TMatmulMxTiles(cMatrix, nullptr, aMatrix, aScaleMatrix, bMatrix, bScaleMatrix, 1,
+                   TMatmulMxBias(biasData, bMatrix.GetValidCol()));
 }
 } // namespace pto
 #endif
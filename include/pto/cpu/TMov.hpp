@@ -14,56 +14,95 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include <cassert>
 #include <algorithm>
 #include <pto/common/constants.hpp>
-#include "pto/cpu/tile_offsets.hpp"
+#include <vector>
+#include "pto/cpu/fixpipe.hpp"
+#include "pto/cpu/tile_convert.hpp"
 
 namespace pto {
 template <typename DstTileData, typename SrcTileData>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src)
 {
-    assert(src.GetValidRow() == dst.GetValidRow() && src.GetValidRow() == dst.GetValidRow());
-    for (size_t c = 0; c < src.GetValidCol(); c++) {
-        size_t subTileSrcC = c / SrcTileData::InnerCols;
-        size_t innerSrcC = c % SrcTileData::InnerCols;
-        size_t subTileDstC = c / DstTileData::InnerCols;
-        size_t innerDstC = c % DstTileData::InnerCols;
+    assert(src.GetValidRow() == dst.GetValidRow() && src.GetValidCol() == dst.GetValidCol());
+    MoveTileWindow<DstTileData, SrcTileData>(dst.data(), src.data(),
+                                             {0, 0, 0, 0, static_cast<size_t>(src.GetValidRow()),
+                                              static_cast<size_t>(src.GetValidCol())});
+}
 
-        for (size_t r = 0; r < src.GetValidRow(); r++) {
-            size_t srcTileIdx;
-            size_t dstTileIdx;
-            if constexpr (SrcTileData::SFractal == SLayout::NoneBox) {
-                srcTileIdx = GetTileElementOffsetPlain<SrcTileData>(r, c);
-            } else {
-                size_t subTileR = r / SrcTileData::InnerRows;
-                size_t innerR = r % SrcTileData::InnerRows;
-                srcTileIdx = GetTileElementOffsetSubfractals<SrcTileData>(subTileR, innerR, subTileSrcC, innerSrcC);
-            }
+// Acc -> Vec/Mat move of a window through the fixpipe; quantOf(c) gives the quant parameters of source column c.
+template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode, bool withQuant, typename QuantFn>
+PTO_INTERNAL void TMovAccWindow(DstTileData &dst, SrcTileData &src, const TileWindow &window, QuantFn quantOf)
+{
+    static_assert(SrcTileData::Loc == TileType::Acc, "Source TileType only suport Acc!");
+    using DstT = typename DstTileData::DType;
+    assert(window.srcRow0 + window.rows <= static_cast<std::size_t>(src.GetValidRow()) &&
+           window.srcCol0 + window.cols <= static_cast<std::size_t>(src.GetValidCol()));
+    std::vector<FixpipeQuant> quants(withQuant ? window.cols : 0);
+    for (std::size_t c = 0; c < quants.size(); c++) {
+        quants[c] = quantOf(window.srcCol0 + c);
+    }
+    const FixpipeQuant none{};
+    typename DstTileData::TileDType out = dst.data();
+    typename SrcTileData::TileDType in = src.data();
+    ForEachTileMoveElement<DstTileData, SrcTileData>(window, [&](size_t d, size_t s, size_t, size_t c) {
+        const FixpipeQuant &quant = withQuant ? quants[c - window.srcCol0] : none;
+        out[d] = FixpipeConvert<DstT, reluMode, withQuant>(in[s], quant);
+    });
+}
 
-            if constexpr (DstTileData::SFractal == SLayout::NoneBox) {
-                dstTileIdx = GetTileElementOffsetPlain<DstTileData>(r, c);
-            } else {
-                size_t subTileR = r / DstTileData::InnerRows;
-                size_t innerR = r % DstTileData::InnerRows;
-                dstTileIdx = GetTileElementOffsetSubfractals<DstTileData>(subTileR, innerR, subTileDstC, innerDstC);
-            }
-            dst.data()[dstTileIdx] = src.data()[srcTileIdx];
-        }
+// Acc -> Vec/Mat move through the fixpipe. dst receives the window of src that starts at (row0, col0) and spans
+// dst's valid shape.
+template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode, bool withQuant, typename QuantFn>
+PTO_INTERNAL void TMovAcc(DstTileData &dst, SrcTileData &src, std::size_t row0, std::size_t col0, QuantFn quantOf)
+{
+    TMovAccWindow<DstTileData, SrcTileData, reluMode, withQuant>(
+        dst, src,
+        {row0, col0, 0, 0, static_cast<std::size_t>(dst.GetValidRow()), static_cast<std::size_t>(dst.GetValidCol())},
+        quantOf);
+}
+
+// Pre-stage ReLU of a Vec/Mat -> Vec/Mat move, applied to the rows x cols window of dst at (row0, col0).
+template <typename DstTileData>
+PTO_INTERNAL void TMovRelu(DstTileData &dst, std::size_t row0, std::size_t col0, std::size_t rows, std::size_t cols)
+{
+    using DstT = typename DstTileData::DType;
+    typename DstTileData::TileDType out = dst.data();
+    ForEachTileMoveElement<DstTileData, DstTileData>({row0, col0, row0, col0, rows, cols},
+                                                     [&](size_t d, size_t, size_t, size_t) {
+                                                         if (out[d] < static_cast<DstT>(0)) {
+                                                             out[d] = static_cast<DstT>(0);
+                                                         }
+                                                     });
+}
+
+// In the dual modes the Acc tile is split between the two vector subblocks; on CPU the calling core receives the
+// half selected by its own subblock id.
+template <typename DstTileData, typename SrcTileData, AccToVecMode mode, ReluPreMode reluMode, bool withQuant,
+          typename QuantFn>
+PTO_INTERNAL void TMovAccToVec(DstTileData &dst, SrcTileData &src, QuantFn quantOf)
+{
+    static_assert(DstTileData::Loc == TileType::Vec, "Destination location only support Vec.");
+    static_assert(!withQuant || mode == AccToVecMode::SingleModeVec0 || mode == AccToVecMode::SingleModeVec1,
+                  "Quant is not support in dual Dst Mode.");
+    const std::size_t subblockId = static_cast<std::size_t>(cpu::CurrentCore().subblockId);
+    std::size_t row0 = 0;
+    std::size_t col0 = 0;
+    if constexpr (mode == AccToVecMode::DualModeSplitM) {
+        row0 = subblockId * static_cast<std::size_t>(dst.GetValidRow());
+    } else if constexpr (mode == AccToVecMode::DualModeSplitN) {
+        col0 = subblockId * static_cast<std::size_t>(dst.GetValidCol());
     }
+    TMovAcc<DstTileData, SrcTileData, reluMode, withQuant>(dst, src, row0, col0, quantOf);
 }
 
 template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src)
 {
-    TMOV_IMPL(dst, src);
-    if constexpr (reluMode == ReluPreMode::NormalRelu) {
-        const std::size_t rows = static_cast<std::size_t>(dst.GetValidRow());
-        const std::size_t cols = static_cast<std::size_t>(dst.GetValidCol());
-        for (std::size_t r = 0; r < rows; ++r) {
-            for (std::size_t c = 0; c < cols; ++c) {
-                auto &v = dst.data()[GetTileElementOffset<DstTileData>(r, c)];
-                if (v < static_cast<typename DstTileData::DType>(0)) {
-                    v = static_cast<typename DstTileData::DType>(0);
-                }
-            }
+    if constexpr (SrcTileData::Loc == TileType::Acc) {
+        TMovAcc<DstTileData, SrcTileData, reluMode, false>(dst, src, 0, 0, [](std::size_t) { return FixpipeQuant{}; });
+    } else {
+        TMOV_IMPL(dst, src);
+        if constexpr (reluMode == ReluPreMode::NormalRelu) {
+            TMovRelu(dst, 0, 0, dst.GetValidRow(), dst.GetValidCol());
         }
     }
 }
@@ -71,39 +110,43 @@ PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src)
 template <typename DstTileData, typename SrcTileData, AccToVecMode mode, ReluPreMode reluMode = ReluPreMode::NoRelu>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src)
 {
-    (void)mode;
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src);
+    TMovAccToVec<DstTileData, SrcTileData, mode, reluMode, false>(dst, src,
+                                                                  [](std::size_t) { return FixpipeQuant{}; });
 }
 
 template <typename DstTileData, typename SrcTileData, typename FpTileData, ReluPreMode reluMode = ReluPreMode::NoRelu>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src, FpTileData &fp)
 {
-    (void)fp;
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src);
+    static_assert(sizeof(typename FpTileData::DType) == sizeof(uint64_t), "Fp tile must hold 64-bit quant words");
+    const typename FpTileData::DType *words = fp.data();
+    TMovAcc<DstTileData, SrcTileData, reluMode, true>(dst, src, 0, 0, [words](std::size_t c) {
+        return DecodeQuantPre(static_cast<uint64_t>(words[GetTileElementOffset<FpTileData>(0, c)]));
+    });
 }
 
 template <typename DstTileData, typename SrcTileData, typename FpTileData, AccToVecMode mode,
           ReluPreMode reluMode = ReluPreMode::NoRelu>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src, FpTileData &fp)
 {
-    (void)mode;
-    (void)fp;
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src);
+    static_assert(sizeof(typename FpTileData::DType) == sizeof(uint64_t), "Fp tile must hold 64-bit quant words");
+    const typename FpTileData::DType *words = fp.data();
+    TMovAccToVec<DstTileData, SrcTileData, mode, reluMode, true>(dst, src, [words](std::size_t c) {
+        return DecodeQuantPre(static_cast<uint64_t>(words[GetTileElementOffset<FpTileData>(0, c)]));
+    });
 }
 
 template <typename DstTileData, typename SrcTileData, ReluPreMode reluMode = ReluPreMode::NoRelu>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src, uint64_t preQuantScalar)
 {
-    (void)preQuantScalar;
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src);
+    const FixpipeQuant quant = DecodeQuantPre(preQuantScalar);
+    TMovAcc<DstTileData, SrcTileData, reluMode, true>(dst, src, 0, 0, [&quant](std::size_t) { return quant; });
 }
 
 template <typename DstTileData, typename SrcTileData, AccToVecMode mode, ReluPreMode reluMode = ReluPreMode::NoRelu>
 PTO_INTERNAL void TMOV_IMPL(DstTileData &dst, SrcTileData &src, uint64_t preQuantScalar)
 {
-    (void)mode;
-    (void)preQuantScalar;
-    TMOV_IMPL<DstTileData, SrcTileData, reluMode>(dst, src);
+    const FixpipeQuant quant = DecodeQuantPre(preQuantScalar);
+    TMovAccToVec<DstTileData, SrcTileData, mode, reluMode, true>(dst, src, [&quant](std::size_t) { return quant; });
 }
 } // namespace pto
 #endif // TMOV_HPP
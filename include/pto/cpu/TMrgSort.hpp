@@ -12,11 +12,13 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TMRGSORT_HPP
 
 #include <algorithm>
-#include <array>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include <pto/common/pto_tile.hpp>
 #include "pto/cpu/tile_offsets.hpp"
+#include "pto/cpu/parallel.hpp"
+#include "pto/cpu/TSort32.hpp"
 
 namespace pto {
 
@@ -50,71 +52,151 @@ PTO_INTERNAL constexpr void CheckMrgSortTileConstraints()
     static_assert(TileData::Loc == TileType::Vec, "TMRGSORT: tile type must be Vec.");
     static_assert(TileData::Rows == 1, "TMRGSORT: tile rows must be 1.");
     static_assert(TileData::isRowMajor, "TMRGSORT: BLayout must be RowMajor.");
+    static_assert(TileData::SFractal == SLayout::NoneBox, "TMRGSORT: only NoneBox tiles are supported in CPU sim");
 }
 
-template <typename TileData, size_t N>
-PTO_INTERNAL std::array<typename TileData::DType, N> ReadStruct(const typename TileData::TileDType tile, unsigned r,
-                                                                unsigned cBase)
-{
-    std::array<typename TileData::DType, N> out{};
-    for (size_t i = 0; i < N; i++) {
-        const size_t idx = GetTileElementOffset<TileData>(r, cBase + static_cast<unsigned>(i));
-        out[i] = tile[idx];
+// Merges up to four descending (score, index) struct streams. Ties go to the lower-numbered list, and within a list
+// the input order is kept.
+template <typename DType, unsigned kElemsPerStruct>
+struct MrgSortLists {
+    const DType *base[LIST_NUM_4] = {nullptr, nullptr, nullptr, nullptr};
+    unsigned len[LIST_NUM_4] = {0, 0, 0, 0};
+
+    // Key of a list head: the smallest key wins the next output slot; UINT64_MAX marks an exhausted list.
+    uint64_t HeadKey(unsigned list, unsigned pos) const
+    {
+        if (pos >= len[list]) {
+            return ~uint64_t(0);
+        }
+        return (static_cast<uint64_t>(~SortOrderedScore(base[list][pos * kElemsPerStruct])) << 2) | list;
     }
-    return out;
-}
 
-template <typename TileData, size_t N>
-PTO_INTERNAL void WriteStruct(typename TileData::TileDType tile, unsigned r, unsigned cBase,
-                              const std::array<typename TileData::DType, N> &v)
-{
-    for (size_t i = 0; i < N; i++) {
-        const size_t idx = GetTileElementOffset<TileData>(r, cBase + static_cast<unsigned>(i));
-        tile[idx] = v[i];
+    // Total merge order of element pos of a list: descending score, then list, then position.
+    uint64_t OrderKey(unsigned list, unsigned pos) const
+    {
+        constexpr unsigned posBits = 24;
+        return (static_cast<uint64_t>(~SortOrderedScore(base[list][pos * kElemsPerStruct])) << 32) |
+               (static_cast<uint64_t>(list) << posBits) | pos;
     }
-}
 
-PTO_INTERNAL bool ReachExhaused(unsigned i0, unsigned i1, unsigned i2, unsigned i3, unsigned s0Structs,
-                                unsigned s1Structs, unsigned s2Structs, unsigned s3Structs, unsigned listNum)
-{
-    if (i0 == s0Structs || i1 == s1Structs || (listNum >= LIST_NUM_3 && i2 == s2Structs) ||
-        (listNum >= LIST_NUM_4 && i3 == s3Structs)) {
-        return true;
+    // Number of elements of a list that precede key in the merged order.
+    unsigned CountBefore(unsigned list, uint64_t key) const
+    {
+        unsigned lo = 0;
+        unsigned hi = len[list];
+        while (lo < hi) {
+            const unsigned mid = lo + (hi - lo) / 2;
+            if (OrderKey(list, mid) < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
     }
-    return false;
-}
 
-PTO_INTERNAL void UpdateIndex(int pick, unsigned &i0, unsigned &i1, unsigned &i2, unsigned &i3)
-{
-    if (pick == LIST_INDEX_0) {
-        i0++;
-    } else if (pick == LIST_INDEX_1) {
-        i1++;
-    } else if (pick == LIST_INDEX_2) {
-        i2++;
-    } else {
-        i3++;
+    uint64_t RankOf(uint64_t key) const
+    {
+        uint64_t rank = 0;
+        for (unsigned l = 0; l < LIST_NUM_4; l++) {
+            rank += CountBefore(l, key);
+        }
+        return rank;
     }
-}
 
-PTO_INTERNAL void WriteExhaused(unsigned i0, unsigned i1, unsigned i2, unsigned i3, uint16_t &mrgSortList0,
-                                uint16_t &mrgSortList1, uint16_t &mrgSortList2, uint16_t &mrgSortList3)
-{
-    mrgSortList0 = static_cast<uint16_t>(i0);
-    mrgSortList1 = static_cast<uint16_t>(i1);
-    mrgSortList2 = static_cast<uint16_t>(i2);
-    mrgSortList3 = static_cast<uint16_t>(i3);
-}
+    // Merge path: how many structs each list contributes to the first `out` outputs.
+    void Split(unsigned out, unsigned (&pos)[LIST_NUM_4]) const
+    {
+        if (out == 0) {
+            // The search below settles on order key 0, which list 0 reaches when it leads with the top score.
+            std::fill(pos, pos + LIST_NUM_4, 0u);
+            return;
+        }
+        uint64_t lo = 0;
+        uint64_t hi = ~uint64_t(0);
+        while (lo < hi) {
+            const uint64_t mid = lo + (hi - lo) / 2;
+            if (RankOf(mid + 1) < out) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        for (unsigned l = 0; l < LIST_NUM_4; l++) {
+            pos[l] = CountBefore(l, lo + 1);
+        }
+    }
+
+    // Emits up to outCount structs from pos onwards with a branchless min over the four head keys.
+    template <bool exhausted>
+    unsigned Merge(DType *dst, unsigned (&pos)[LIST_NUM_4], unsigned outCount) const
+    {
+        uint64_t head[LIST_NUM_4];
+        for (unsigned l = 0; l < LIST_NUM_4; l++) {
+            head[l] = HeadKey(l, pos[l]);
+        }
+        unsigned out = 0;
+        while (out < outCount) {
+            const uint64_t m01 = std::min(head[0], head[1]);
+            const uint64_t m23 = std::min(head[2], head[3]);
+            const uint64_t m = std::min(m01, m23);
+            if (m == ~uint64_t(0)) {
+                break;
+            }
+            const unsigned l = static_cast<unsigned>(m & 0x3);
+            std::memcpy(dst + out * kElemsPerStruct, base[l] + pos[l] * kElemsPerStruct, STRUCT_BYTES);
+            out++;
+            pos[l]++;
+            head[l] = HeadKey(l, pos[l]);
+            if constexpr (exhausted) {
+                if (pos[l] == len[l]) {
+                    break;
+                }
+            }
+        }
+        return out;
+    }
+};
 
-template <typename Dtype, typename SrcTileData, size_t N, unsigned LIST_INDEX>
-PTO_INTERNAL void CompareAndPick(int &pick, std::array<Dtype, N> &vPick, typename SrcTileData::TileDType src,
-                                 unsigned index)
+// Merges longer than this are cut along the merge path and the pieces run on pool threads.
+constexpr unsigned MRGSORT_CHUNK_STRUCTS = 1024;
+
+template <bool exhausted, unsigned listNum, typename DType, unsigned kElemsPerStruct>
+PTO_INTERNAL void MrgsortLists(DType *dst, const MrgSortLists<DType, kElemsPerStruct> &lists, unsigned outStructs,
+                               unsigned (&pos)[LIST_NUM_4])
 {
-    const auto v = ReadStruct<SrcTileData, N>(src, 0, index * N);
-    if (pick < 0 || v[0] > vPick[0]) {
-        vPick = v;
-        pick = LIST_INDEX;
+    unsigned total = 0;
+    bool anyEmpty = false;
+    for (unsigned l = 0; l < listNum; l++) {
+        total += lists.len[l];
+        anyEmpty = anyEmpty || lists.len[l] == 0;
+    }
+    unsigned outCount = std::min(outStructs, total);
+    if constexpr (exhausted) {
+        // The merge stops right after the first list runs dry; an empty list stops it after one struct.
+        if (anyEmpty) {
+            outCount = std::min(outCount, 1u);
+        }
     }
+    if (outCount <= MRGSORT_CHUNK_STRUCTS) {
+        lists.template Merge<exhausted>(dst, pos, outCount);
+        return;
+    }
+    if constexpr (exhausted) {
+        for (unsigned l = 0; l < listNum; l++) {
+            const uint64_t lastKey = lists.OrderKey(l, lists.len[l] - 1);
+            outCount = static_cast<unsigned>(std::min<uint64_t>(outCount, lists.RankOf(lastKey + 1)));
+        }
+    }
+    const unsigned chunks = (outCount + MRGSORT_CHUNK_STRUCTS - 1) / MRGSORT_CHUNK_STRUCTS;
+    cpu::parallel_for_1d(0, chunks, static_cast<std::size_t>(outCount) * kElemsPerStruct, [&](std::size_t c) {
+        const unsigned begin = static_cast<unsigned>(c) * MRGSORT_CHUNK_STRUCTS;
+        const unsigned count = std::min(MRGSORT_CHUNK_STRUCTS, outCount - begin);
+        unsigned chunkPos[LIST_NUM_4];
+        lists.Split(begin, chunkPos);
+        lists.template Merge<false>(dst + begin * kElemsPerStruct, chunkPos, count);
+    });
+    lists.Split(outCount, pos);
 }
 
 template <typename DstTileData, typename TmpTileData, typename Src0TileData, typename Src1TileData,
@@ -129,56 +211,31 @@ PTO_INTERNAL void TMrgsort(typename DstTileData::TileDType dst, typename TmpTile
     (void)tmp;
     using DType = typename DstTileData::DType;
 
-    unsigned i0 = 0;
-    unsigned i1 = 0;
-    unsigned i2 = 0;
-    unsigned i3 = 0;
-    unsigned out = 0;
-
-    using StructT = std::array<DType, kElemsPerStruct>;
-    while (out < outStructs) {
-        int pick = -1;
-        StructT vPick{};
-
-        if (i0 < s0Structs) {
-            vPick = ReadStruct<Src0TileData, kElemsPerStruct>(src0, 0, i0 * kElemsPerStruct);
-            pick = 0;
-        }
-        if (i1 < s1Structs) {
-            CompareAndPick<DType, Src1TileData, kElemsPerStruct, LIST_INDEX_1>(pick, vPick, src1, i1);
-        }
-        if constexpr (listNum >= LIST_NUM_3) {
-            if (i2 < s2Structs) {
-                CompareAndPick<DType, Src2TileData, kElemsPerStruct, LIST_INDEX_2>(pick, vPick, src2, i2);
-            }
-        }
-
-        if constexpr (listNum == LIST_NUM_4) {
-            if (i3 < s3Structs) {
-                CompareAndPick<DType, Src3TileData, kElemsPerStruct, LIST_INDEX_3>(pick, vPick, src3, i3);
-            }
-        }
-
-        if (pick < 0) {
-            break;
-        }
-
-        WriteStruct<DstTileData, kElemsPerStruct>(dst, 0, out * kElemsPerStruct, vPick);
-        out++;
-
-        UpdateIndex(pick, i0, i1, i2, i3);
-
-        if constexpr (exhausted) {
-            if (ReachExhaused(i0, i1, i2, i3, s0Structs, s1Structs, s2Structs, s3Structs, listNum)) {
-                break;
-            }
-        }
+    MrgSortLists<DType, kElemsPerStruct> lists;
+    lists.base[LIST_INDEX_0] = src0;
+    lists.len[LIST_INDEX_0] = s0Structs;
+    lists.base[LIST_INDEX_1] = src1;
+    lists.len[LIST_INDEX_1] = s1Structs;
+    if constexpr (listNum >= LIST_NUM_3) {
+        lists.base[LIST_INDEX_2] = src2;
+        lists.len[LIST_INDEX_2] = s2Structs;
     }
+    if constexpr (listNum == LIST_NUM_4) {
+        lists.base[LIST_INDEX_3] = src3;
+        lists.len[LIST_INDEX_3] = s3Structs;
+    }
+
+    unsigned pos[LIST_NUM_4] = {0, 0, 0, 0};
+    MrgsortLists<exhausted, listNum>(dst, lists, outStructs, pos);
 
-    WriteExhaused(i0, i1, i2, i3, mrgSortList0, mrgSortList1, mrgSortList2, mrgSortList3);
+    mrgSortList0 = static_cast<uint16_t>(pos[LIST_INDEX_0]);
+    mrgSortList1 = static_cast<uint16_t>(pos[LIST_INDEX_1]);
+    mrgSortList2 = static_cast<uint16_t>(pos[LIST_INDEX_2]);
+    mrgSortList3 = static_cast<uint16_t>(pos[LIST_INDEX_3]);
 }
 
 // blockLen includes values + indexes/payload, e.g. 32 (value,idx) pairs -> blockLen=64 for float.
+// Every group of four consecutive blocks is merged independently; a trailing partial group is left untouched.
 template <typename DstTileData, typename SrcTileData>
 PTO_INTERNAL void TMrgsort(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, uint32_t maxCols,
                            uint32_t blockLen)
@@ -197,36 +254,18 @@ PTO_INTERNAL void TMrgsort(typename DstTileData::TileDType dst, typename SrcTile
     const unsigned structsPerBlock = blockElems / kElemsPerStruct;
     constexpr unsigned kBlocksPerGroup = 4;
     const unsigned groupElems = blockElems * kBlocksPerGroup;
-
-    using StructT = std::array<DType, kElemsPerStruct>;
-    for (unsigned cBase = 0; cBase + groupElems <= maxCols; cBase += groupElems) {
-        std::array<unsigned, kBlocksPerGroup> idx{};
-        for (unsigned i = 0; i < kBlocksPerGroup; i++) {
-            idx[i] = 0;
+    const unsigned groups = maxCols / groupElems;
+
+    cpu::parallel_for_1d(0, groups, static_cast<std::size_t>(groups) * groupElems, [&](std::size_t g) {
+        const unsigned cBase = static_cast<unsigned>(g) * groupElems;
+        MrgSortLists<DType, kElemsPerStruct> lists;
+        for (unsigned b = 0; b < kBlocksPerGroup; b++) {
+            lists.base[b] = src + cBase + b * blockElems;
+            lists.len[b] = structsPerBlock;
         }
-
-        for (unsigned out = 0; out < structsPerBlock * kBlocksPerGroup; out++) {
-            int pick = -1;
-            StructT vPick{};
-            for (unsigned b = 0; b < kBlocksPerGroup; b++) {
-                if (idx[b] >= structsPerBlock) {
-                    continue;
-                }
-                const unsigned srcC = cBase + b * blockElems + idx[b] * kElemsPerStruct;
-                const auto v = ReadStruct<SrcTileData, kElemsPerStruct>(src, 0, srcC);
-                if (pick < 0 || v[0] > vPick[0]) {
-                    vPick = v;
-                    pick = static_cast<int>(b);
-                }
-            }
-            if (pick < 0) {
-                break;
-            }
-            const unsigned dstC = cBase + out * kElemsPerStruct;
-            WriteStruct<DstTileData, kElemsPerStruct>(dst, 0, dstC, vPick);
-            idx[static_cast<unsigned>(pick)]++;
-        }
-    }
+        unsigned pos[LIST_NUM_4] = {0, 0, 0, 0};
+        lists.template Merge<false>(dst + cBase, pos, structsPerBlock * kBlocksPerGroup);
+    });
 }
 
 template <typename DstTileData, typename TmpTileData, typename Src0TileData, typename Src1TileData,
@@ -12,7 +12,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TPOP_HPP
 
 #include <pto/common/fifo.hpp>
-#include <pto/cpu/TStore.hpp>
+#include <pto/cpu/TLoad.hpp>
 #include <pto/cpu/TPush.hpp>
 
 namespace pto {
@@ -26,7 +26,7 @@ namespace pto {
 template <typename PipeCons, typename TileData, typename DataFiFo>
 PTO_INTERNAL void TPOP_IMPL(PipeCons &cons, TileData &tile, DataFiFo &fifo)
 {
-    // // 1. Cross-Core: Wait for Data
+    // 1. Cross-Core: Wait for Data
     cons.wait();
 
     // 2. Address Calculation & Load
@@ -37,7 +37,7 @@ PTO_INTERNAL void TPOP_IMPL(PipeCons &cons, TileData &tile, DataFiFo &fifo)
     GlobalTensor<typename DataFiFo::DType, Shape<1, 1, 1, rows, cols>,
                  Stride<rows * cols, rows * cols, rows * cols, cols, 1>>
         gt(addr);
-    TSTORE(gt, tile);
+    TLOAD(tile, gt);
 
     // 3. Cross-Core: Free Space
     cons.free();
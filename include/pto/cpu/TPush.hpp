@@ -11,9 +11,13 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #ifndef TPUSH_HPP
 #define TPUSH_HPP
 
+#include <atomic>
+#include <thread>
+
 #include <pto/common/fifo.hpp>
 #include <pto/cpu/TStore.hpp>
 #include <pto/cpu/TLoad.hpp>
+#include <pto/cpu/launch.hpp>
 
 namespace pto {
 
@@ -50,25 +54,81 @@ struct TSyncTraits {
                   "Producer must be TSTORE_C2GM, TMOV_C2UB (Cube) or TSTORE_V2GM, TINSERT_V2L1 (Vector)");
 };
 
+// Shared state of one FIFO between the Cube core and the Vec cores of a block. Every core side keeps a running
+// count of the tiles it has recorded (producer) or freed (consumer); the Cube side uses slot 0, Vec cores use
+// their subblock id.
+struct TFIFOChannel {
+    static constexpr int maxSlots = 2;
+    std::atomic<uint64_t> produced[maxSlots] = {};
+    std::atomic<uint64_t> consumed[maxSlots] = {};
+};
+
+// Blocks until ready(counter) holds: a short yield spin for the overlapped steady state, then a futex-style wait.
+template <typename Ready>
+PTO_INTERNAL void TFIFOWaitCounter(std::atomic<uint64_t> &counter, Ready ready)
+{
+    constexpr int spinLimit = 64;
+    uint64_t value = counter.load(std::memory_order_acquire);
+    for (int spin = 0; !ready(value); spin++) {
+        if (spin < spinLimit) {
+            std::this_thread::yield();
+        } else {
+            counter.wait(value, std::memory_order_acquire);
+        }
+        value = counter.load(std::memory_order_acquire);
+    }
+}
+
+PTO_INTERNAL void TFIFOPublish(std::atomic<uint64_t> &counter, uint64_t count)
+{
+    counter.fetch_add(count, std::memory_order_release);
+    counter.notify_all();
+}
+
 template <uint16_t FlagID, typename DataFIFO, TSyncOpType ProducerOp, TSyncOpType ConsumerOp>
 struct TFIFOSync {
     using Traits = TSyncTraits<ProducerOp, ConsumerOp>;
-    // static constexpr bool is_c2v = Traits::is_cube_to_vec;
-    // static constexpr bool is_c2v_gm = Traits::is_cube_to_vec_gm;
-    // static constexpr bool is_c2v_ub = Traits::is_cube_to_vec_ub;
-    // static constexpr bool is_v2c = Traits::is_vec_to_cube;
-    // static constexpr bool is_v2c_gm = Traits::is_vec_to_cube_gm;
-    // static constexpr bool is_v2c_ub = Traits::is_vec_to_cube_ub;
-    // static constexpr int VEC_CORE_ID_OFFSET = 16;
+    static constexpr bool is_c2v = Traits::is_cube_to_vec;
 
     static constexpr int fifoSize = DataFIFO::fifoDepth;
     static constexpr int syncPeriod = DataFIFO::fifoPeriod;
+    // Frees are signalled in batches of syncPeriod; never batch more than the FIFO can hold.
+    static constexpr int freeBatch = (syncPeriod < 1) ? 1 : ((syncPeriod > fifoSize) ? fifoSize : syncPeriod);
+    static_assert(fifoSize > 0, "FIFO depth must be positive");
+
+    // One channel per block and launch, shared by all the Producer/Consumer objects of this FIFO type.
+    static constexpr char channelKey = 0;
+    static TFIFOChannel &Channel()
+    {
+        return cpu::CurrentLaunchObjects().Get<TFIFOChannel>(&channelKey, get_block_idx());
+    }
+
+    static int CubeSlot()
+    {
+        return 0;
+    }
+
+    static int VecSlot()
+    {
+        return static_cast<int>(get_subblockid()) % TFIFOChannel::maxSlots;
+    }
+
+    static uint8_t CubeMask()
+    {
+        return 1;
+    }
+
+    static uint8_t VecMask()
+    {
+        return cpu::CurrentCore().vecMask;
+    }
 
     // -------------------------------------------------------------------------
     // Producer Interface
     // -------------------------------------------------------------------------
     struct Producer {
         volatile int tile_id;
+        TFIFOChannel *channel = nullptr;
 
         PTO_INTERNAL Producer()
         {
@@ -85,15 +145,31 @@ struct TFIFOSync {
             return tile_id;
         }
 
+        PTO_INTERNAL TFIFOChannel &GetChannel()
+        {
+            if (channel == nullptr) {
+                channel = &Channel();
+            }
+            return *channel;
+        }
+
+        // Blocks until every consumer has freed enough entries for one more tile.
         PTO_INTERNAL void allocate()
         {
-            // For multithreaded operations code locking data block of fifo buffer should be added here
+            TFIFOChannel &ch = GetChannel();
+            const uint64_t produced = ch.produced[is_c2v ? CubeSlot() : VecSlot()].load(std::memory_order_relaxed);
+            const uint8_t consumers = is_c2v ? VecMask() : CubeMask();
+            for (int slot = 0; slot < TFIFOChannel::maxSlots; slot++) {
+                if ((consumers >> slot) & 1u) {
+                    TFIFOWaitCounter(ch.consumed[slot], [&](uint64_t freed) { return produced - freed < fifoSize; });
+                }
+            }
         }
 
         PTO_INTERNAL void record()
         {
             tile_id = (tile_id + 1) % fifoSize;
-            // Add notification routine from producer to notifier for multithreaded scenario
+            TFIFOPublish(GetChannel().produced[is_c2v ? CubeSlot() : VecSlot()], 1);
         }
     };
 
@@ -103,12 +179,25 @@ struct TFIFOSync {
     struct Consumer {
         volatile int tile_id;
         volatile int sub_tile_id;
+        TFIFOChannel *channel = nullptr;
+        int pendingFree = 0;
 
         PTO_INTERNAL Consumer()
         {
             tile_id = 0;
         }
 
+        Consumer(const Consumer &) = delete;
+        Consumer &operator=(const Consumer &) = delete;
+
+        ~Consumer()
+        {
+            // Hand back entries still held by an unfinished free batch.
+            if (pendingFree > 0) {
+                TFIFOPublish(GetChannel().consumed[is_c2v ? VecSlot() : CubeSlot()], pendingFree);
+            }
+        }
+
         PTO_INTERNAL void set_tile_id(int tid, int sub_tid)
         {
             tile_id = tid;
@@ -119,15 +208,35 @@ struct TFIFOSync {
             return tile_id;
         }
 
+        PTO_INTERNAL TFIFOChannel &GetChannel()
+        {
+            if (channel == nullptr) {
+                channel = &Channel();
+            }
+            return *channel;
+        }
+
+        // Blocks until every producer has recorded the tile this consumer pops next.
         PTO_INTERNAL void wait()
         {
-            // Add wait routine if fifo buffer is empty.
+            TFIFOChannel &ch = GetChannel();
+            const uint64_t consumed =
+                ch.consumed[is_c2v ? VecSlot() : CubeSlot()].load(std::memory_order_relaxed) + pendingFree;
+            const uint8_t producers = is_c2v ? CubeMask() : VecMask();
+            for (int slot = 0; slot < TFIFOChannel::maxSlots; slot++) {
+                if ((producers >> slot) & 1u) {
+                    TFIFOWaitCounter(ch.produced[slot], [&](uint64_t recorded) { return recorded > consumed; });
+                }
+            }
         }
 
         PTO_INTERNAL void free()
         {
             tile_id = (tile_id + 1) % fifoSize;
-            // Add notification to producer that will notify that particular block in FIFO is free now
+            if (++pendingFree >= freeBatch) {
+                TFIFOPublish(GetChannel().consumed[is_c2v ? VecSlot() : CubeSlot()], pendingFree);
+                pendingFree = 0;
+            }
         }
     };
 };
@@ -138,14 +247,14 @@ PTO_INTERNAL void TPUSH_IMPL(PipeProd &prod, TileData &tile, DataFiFo &fifo)
     // 1. Cross-Core: Wait for space
     prod.allocate();
 
-    // 2. Address Calculation
+    // 2. Address Calculation & Store
     __gm__ typename DataFiFo::DType *addr = fifo.getBasePtr() + TileData::Numel * (prod.get_tile_id() % fifo.fifoDepth);
     constexpr unsigned int cols = TileData::Cols;
     constexpr unsigned int rows = TileData::Rows;
     GlobalTensor<typename TileData::DType, Shape<1, 1, 1, rows, cols>,
                  Stride<rows * cols, rows * cols, rows * cols, cols, 1>>
         gt(addr);
-    TLOAD(tile, gt);
+    TSTORE(gt, tile);
 
     // 3. Cross-Core: Commit & Signal
     prod.record();
@@ -14,6 +14,7 @@ full text of the License.
 #define __PTO_RESHAPE__
 
 #include "pto/common/pto_tile.hpp"
+#include "pto/cpu/pipes.hpp"
 #include <type_traits>
 
 namespace pto {
@@ -47,12 +48,10 @@ PTO_INTERNAL void TRESHAPE_IMPL(TileDataOut &dst, TileDataIn &src)
                       (SFractal != SLayout::NoneBox && NewSFractal != SLayout::NoneBox),
                   "TRESHAPE: Cannot reshape between boxed and non-boxed layouts.");
 
-    constexpr size_t N = sizeof(ElemType) * ElemNum;
-    const std::byte *src_bytes = reinterpret_cast<const std::byte *>(src.data());
-    std::byte *dst_bytes = reinterpret_cast<std::byte *>(dst.data());
-
-    for (size_t i = 0; i < N; ++i) {
-        dst_bytes[i] = src_bytes[i];
+    // dst becomes a view of src's elements, as the device rebinds dst to src's address; nothing is copied.
+    if (static_cast<const void *>(dst.data()) != static_cast<const void *>(src.data())) {
+        cpu::PipeDrainAll();
+        dst.data_.Alias(src.data_);
     }
 }
 } // namespace pto
@@ -0,0 +1,154 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef TROWSOFTMAX_HPP
+#define TROWSOFTMAX_HPP
+
+#include <pto/common/pto_tile.hpp>
+#include "pto/cpu/tile_offsets.hpp"
+#include "pto/cpu/parallel.hpp"
+#include "pto/cpu/pipes.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Fused row softmax for the CPU simulator. It replaces the TMULS -> TROWMAX -> TROWEXPANDSUB -> TEXP -> TROWSUM
+// -> TROWEXPANDDIV sequence with one fork/join: each row is reduced, exponentiated and normalised while it is still
+// in cache. It is not an instruction: kernels reach it as pto::cpu::RowSoftmax under __CPU_SIM and keep the
+// instruction sequence for the device.
+namespace pto {
+namespace cpu {
+// Branch-free expf (Cephes polynomial, ~1 ulp) that the compiler can vectorise, unlike the libm call.
+// Arguments below the float range flush to 0, so masked -inf entries vanish from the sum.
+PTO_INTERNAL float ExpPoly(float x)
+{
+    constexpr float expHi = 88.0f;
+    constexpr float expLo = -87.33f;
+    constexpr float log2e = 1.44269504088896341f;
+    constexpr float ln2Hi = 0.693359375f;
+    constexpr float ln2Lo = -2.12194440e-4f;
+    constexpr float roundMagic = 12582912.0f; // 1.5 * 2^23: adding it rounds to an integer in the low bits
+    const float clamped = std::min(std::max(x, expLo), expHi);
+    const float shifted = clamped * log2e + roundMagic;
+    const float n = shifted - roundMagic;
+    int32_t shiftedBits;
+    std::memcpy(&shiftedBits, &shifted, sizeof(shiftedBits));
+    constexpr int32_t magicBits = 0x4B400000;
+    const int32_t ni = shiftedBits - magicBits;
+
+    const float r = clamped - n * ln2Hi - n * ln2Lo;
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    p = p * r * r + r + 1.0f;
+
+    const int32_t powBits = (ni + 127) << 23;
+    float pow2n;
+    std::memcpy(&pow2n, &powBits, sizeof(pow2n));
+    return x < expLo ? 0.0f : p * pow2n;
+}
+} // namespace cpu
+
+// One row: m = max(scale * x), e = exp(scale * x - m), out = e / sum(e). e is staged in out when that is fp32,
+// otherwise in a float scratch row so a half output is rounded once.
+template <typename LoadFn, typename StoreFn>
+PTO_INTERNAL void RowSoftmaxLine(LoadFn load, StoreFn store, float *stage, unsigned validCol, float scale,
+                                 float &rowMax, float &rowSum)
+{
+    float m = -std::numeric_limits<float>::infinity();
+    for (std::size_t c = 0; c < validCol; ++c) {
+        m = std::max(m, load(c) * scale);
+    }
+    PTO_CPU_VECTORIZE_LOOP
+    for (std::size_t c = 0; c < validCol; ++c) {
+        stage[c] = cpu::ExpPoly(load(c) * scale - m);
+    }
+    float sum = 0.0f;
+    for (std::size_t c = 0; c < validCol; ++c) {
+        sum += stage[c];
+    }
+    const float inv = 1.0f / sum;
+    PTO_CPU_VECTORIZE_LOOP
+    for (std::size_t c = 0; c < validCol; ++c) {
+        store(c, stage[c] * inv);
+    }
+    rowMax = m;
+    rowSum = sum;
+}
+
+template <typename TileDataDst, typename TileDataSrc, typename TileDataRed>
+void TRowSoftmax_Impl(typename TileDataDst::TileDType dst, typename TileDataSrc::TileDType src,
+                      typename TileDataRed::TileDType rowMax, typename TileDataRed::TileDType rowSum,
+                      unsigned validRow, unsigned validCol, float scale)
+{
+    using D = typename TileDataDst::DType;
+    using R = typename TileDataRed::DType;
+    constexpr bool plainRows = TileDataDst::SFractal == SLayout::NoneBox && TileDataDst::isRowMajor &&
+                               TileDataSrc::SFractal == SLayout::NoneBox && TileDataSrc::isRowMajor;
+    // exp and the normalisation cost several flops per element; weight the split accordingly.
+    constexpr std::size_t workPerElem = 8;
+    const std::size_t work = static_cast<std::size_t>(validRow) * validCol * workPerElem;
+    cpu::parallel_for_1d(0, validRow, work, [&](std::size_t r) {
+        float scratch[TileDataSrc::Cols];
+        float *stage = scratch;
+        float m = 0.0f;
+        float sum = 0.0f;
+        if constexpr (plainRows) {
+            const auto *in = src + r * TileDataSrc::Cols;
+            D *out = dst + r * TileDataDst::Cols;
+            if constexpr (std::is_same_v<D, float>) {
+                stage = out;
+            }
+            RowSoftmaxLine([in](std::size_t c) { return static_cast<float>(in[c]); },
+                           [out](std::size_t c, float v) { out[c] = static_cast<D>(v); }, stage, validCol, scale, m,
+                           sum);
+        } else {
+            RowSoftmaxLine(
+                [&](std::size_t c) { return static_cast<float>(src[GetTileElementOffset<TileDataSrc>(r, c)]); },
+                [&](std::size_t c, float v) { dst[GetTileElementOffset<TileDataDst>(r, c)] = static_cast<D>(v); },
+                stage, validCol, scale, m, sum);
+        }
+        rowMax[GetTileElementOffset<TileDataRed>(r, 0)] = static_cast<R>(m);
+        rowSum[GetTileElementOffset<TileDataRed>(r, 0)] = static_cast<R>(sum);
+    });
+}
+
+template <typename TileDataDst, typename TileDataSrc, typename TileDataRed>
+PTO_INTERNAL void TRowSoftmaxTiles(TileDataDst &dst, TileDataSrc &src, TileDataRed &rowMax, TileDataRed &rowSum,
+                                   float scale)
+{
+    static_assert(TileDataDst::Rows == TileDataSrc::Rows && TileDataDst::Cols == TileDataSrc::Cols,
+                  "RowSoftmax: dst and src must have the same shape");
+    static_assert(TileDataRed::Rows >= TileDataSrc::Rows, "RowSoftmax: reduce tiles need one entry per row");
+    unsigned row = src.GetValidRow();
+    unsigned col = src.GetValidCol();
+    TRowSoftmax_Impl<TileDataDst, TileDataSrc, TileDataRed>(dst.data(), src.data(), rowMax.data(), rowSum.data(),
+                                                            row, col, scale);
+}
+
+namespace cpu {
+// dst = softmax(scale * src) along each row. rowMax/rowSum receive the scaled row maximum and the sum of
+// exponentials, the running state a streaming (flash) attention kernel carries between tiles. Issued like an
+// instruction, so it runs on the vector pipe of an asynchronous core and is profiled as ROWSOFTMAX.
+template <typename TileDataDst, typename TileDataSrc, typename TileDataRed>
+void RowSoftmax(TileDataDst &dst, TileDataSrc &src, TileDataRed &rowMax, TileDataRed &rowSum, float scale)
+{
+    IssueInstr(
+        "ROWSOFTMAX", [](auto &&... implArgs) { TRowSoftmaxTiles(implArgs...); }, dst, src, rowMax, rowSum, scale);
+}
+} // namespace cpu
+} // namespace pto
+
+#endif
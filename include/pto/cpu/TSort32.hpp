@@ -11,10 +11,12 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TSORT32_HPP
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
-#include <vector>
 #include <pto/common/pto_tile.hpp>
 #include "pto/cpu/tile_offsets.hpp"
+#include "pto/cpu/parallel.hpp"
 
 namespace pto {
 constexpr const int sortNum = 32;
@@ -23,69 +25,101 @@ constexpr const int halfStride = 2;
 constexpr const int halfOffset = 16;
 constexpr const int totalByte = 8;
 
+// Order-preserving unsigned encoding of a score, shared by the CPU sort and merge. -0 and +0 encode alike.
 template <typename T>
-struct ScoreIndexPair {
-    T score;
-    uint32_t index;
+PTO_INTERNAL uint32_t SortOrderedScore(T score)
+{
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<uint32_t>(static_cast<int32_t>(score)) ^ 0x80000000u;
+    } else {
+        float f = static_cast<float>(score);
+        f = (f == 0.0f) ? 0.0f : f;
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+}
+
+// Sort key for one (score, index) pair: ascending key order is descending score, then ascending index. Zero
+// scores come back as +0.
+template <typename T>
+PTO_INTERNAL uint64_t Sort32Key(T score, uint32_t index)
+{
+    return (static_cast<uint64_t>(~SortOrderedScore(score)) << 32) | index;
+}
+
+template <typename T>
+PTO_INTERNAL T Sort32Score(uint64_t key)
+{
+    const uint32_t ordered = ~static_cast<uint32_t>(key >> 32);
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(static_cast<int32_t>(ordered ^ 0x80000000u));
+    } else {
+        const uint32_t bits = (ordered & 0x80000000u) ? (ordered & 0x7FFFFFFFu) : ~ordered;
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return static_cast<T>(f);
+    }
+}
 
-    // 用于降序排序的比较函数（稳定排序）
-    bool operator<(const ScoreIndexPair &other) const
-    {
-        // 降序排序：分数大的在前
-        if (score != other.score) {
-            return score > other.score; // 降序
+// Bitonic sorting network over 32 keys. Within one (k, j) stage every block of j compare-exchanges runs in the
+// same direction on contiguous keys, so the min/max pairs vectorise.
+PTO_INTERNAL void Sort32Network(uint64_t (&keys)[sortNum])
+{
+    for (int k = 2; k <= sortNum; k <<= 1) {
+        for (int j = k >> 1; j > 0; j >>= 1) {
+            for (int base = 0; base < sortNum; base += 2 * j) {
+                uint64_t *lo = keys + base;
+                uint64_t *hi = keys + base + j;
+                const bool ascending = (base & k) == 0;
+                PTO_CPU_VECTORIZE_LOOP
+                for (int t = 0; t < j; t++) {
+                    const uint64_t a = lo[t];
+                    const uint64_t b = hi[t];
+                    const uint64_t mn = a < b ? a : b;
+                    const uint64_t mx = a < b ? b : a;
+                    lo[t] = ascending ? mn : mx;
+                    hi[t] = ascending ? mx : mn;
+                }
+            }
         }
-        // 分数相同时，按原始索引升序（i<j时优先存储i）
-        return index < other.index;
     }
-};
+}
 
 template <typename T, typename TileDataDst, typename TileDataSrc, typename TileDataIdx>
 PTO_INTERNAL void TSort32(typename TileDataDst::TileDType dst, typename TileDataSrc::TileDType src,
                           typename TileDataIdx::TileDType idx, int validRow, int validCol)
 {
-    for (int i = 0; i < validRow; i++) {
+    cpu::parallel_for_rows(validRow, validCol, [&](std::size_t i) {
         for (int j = 0; j < validCol; j += sortNum) {
             const size_t dstOffset = GetTileElementOffset<TileDataDst>(i, 2 * j);
             const size_t srcOffset = GetTileElementOffset<TileDataSrc>(i, j);
             const size_t idxOffset = GetTileElementOffset<TileDataIdx>(i, j);
-            int validNum = std::min(sortNum, validCol - j);
-            // 收集当前分段的分数-索引对
-            std::vector<ScoreIndexPair<T>> segment(validNum);
-            for (int k = 0; k < validNum; k++) {
-                segment[k].score = src[srcOffset + k];
-                segment[k].index = (uint32_t)(idx[idxOffset + k]);
+            const int validNum = std::min(sortNum, validCol - j);
+            // A short tail segment is padded with keys that sort after every real one.
+            uint64_t keys[sortNum];
+            for (int k = 0; k < sortNum; k++) {
+                keys[k] = k < validNum ? Sort32Key<T>(src[srcOffset + k], static_cast<uint32_t>(idx[idxOffset + k]))
+                                       : ~uint64_t(0);
             }
+            Sort32Network(keys);
 
-            // 对当前分段进行稳定排序（降序）
-            // 使用稳定排序以保持相同分数的原始顺序
-            std::stable_sort(segment.begin(), segment.end(),
-                             [](const ScoreIndexPair<T> &a, const ScoreIndexPair<T> &b) {
-                                 // 主要按分数降序排序
-                                 if (a.score != b.score) {
-                                     return a.score > b.score; // 降序
-                                 }
-                                 // 分数相同时，按原始索引升序（i<j时优先存储i）
-                                 return a.index < b.index;
-                             });
-
-            int num = 0;
             int t = 0;
-            while (num < validNum) {
+            for (int num = 0; num < validNum; num++) {
+                const uint32_t index = static_cast<uint32_t>(keys[num]);
                 if constexpr (sizeof(T) == sizeof(half)) {
-                    dst[dstOffset + t] = segment[num].score;
+                    dst[dstOffset + t] = Sort32Score<T>(keys[num]);
                     dst[dstOffset + t + 1] = 0;
-                    dst[dstOffset + t + halfStride] = segment[num].index;
-                    dst[dstOffset + t + halfStride + 1] = segment[num].index >> halfOffset;
+                    dst[dstOffset + t + halfStride] = index;
+                    dst[dstOffset + t + halfStride + 1] = index >> halfOffset;
                 } else {
-                    dst[dstOffset + t] = segment[num].score;
-                    dst[dstOffset + t + 1] = segment[num].index;
+                    dst[dstOffset + t] = Sort32Score<T>(keys[num]);
+                    dst[dstOffset + t + 1] = index;
                 }
-                num++;
                 t += totalByte / sizeof(T);
             }
         }
-    }
+    });
 }
 
 template <typename TileDataDst, typename TileDataSrc, typename TileDataIdx>
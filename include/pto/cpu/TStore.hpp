@@ -14,10 +14,25 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include <pto/common/constants.hpp>
 #include <cassert>
 #include "pto/cpu/parallel.hpp"
+#include "pto/cpu/strided_copy.hpp"
+#include "pto/cpu/fixpipe.hpp"
+#include "pto/cpu/mx_formats.hpp"
+#include "pto/cpu/tile_offsets.hpp"
 
 namespace pto {
+// Writes one run of tile elements to global memory, accumulating into it for AtomicAdd.
+template <AtomicType atomicType, typename DstT, typename SrcT>
+PTO_INTERNAL void StoreRun(DstT *dst, const SrcT *src, std::size_t count, std::size_t dstStride)
+{
+    if constexpr (atomicType == AtomicType::AtomicAdd) {
+        cpu::AddRun(dst, src, count, dstStride);
+    } else {
+        cpu::CopyRun(dst, src, count, dstStride);
+    }
+}
 
-template <typename GlobalData, typename TileData, std::enable_if_t<TileData::isRowMajor, int> = 0>
+template <typename GlobalData, typename TileData, AtomicType atomicType,
+          std::enable_if_t<TileData::isRowMajor, int> = 0>
 __tf__ PTO_INLINE void StorePlainMatrix(typename GlobalData::DType __out__ *dst,
                                         typename TileData::TileDType __in__ src, int gShape3, int gShape4, int gStride3,
                                         int gStride4, int validRow, int validCol, size_t idx3)
@@ -25,15 +40,13 @@ __tf__ PTO_INLINE void StorePlainMatrix(typename GlobalData::DType __out__ *dst,
     size_t offsetSrcBase = idx3 * gShape3 * TileData::Cols;
     cpu::parallel_for_1d(0, static_cast<std::size_t>(gShape3), static_cast<std::size_t>(gShape3) * gShape4,
                          [&](std::size_t r) {
-                             const std::size_t srcBase = offsetSrcBase + r * TileData::Cols;
-                             const std::size_t dstBase = r * static_cast<std::size_t>(gStride3);
-                             PTO_CPU_VECTORIZE_LOOP
-                             for (std::size_t c = 0; c < static_cast<std::size_t>(gShape4); c++) {
-                                 dst[dstBase + c * static_cast<std::size_t>(gStride4)] = src[srcBase + c];
-                             }
+                             StoreRun<atomicType>(dst + r * static_cast<std::size_t>(gStride3),
+                                          src + offsetSrcBase + r * TileData::Cols, static_cast<std::size_t>(gShape4),
+                                          static_cast<std::size_t>(gStride4));
                          });
 }
-template <typename GlobalData, typename TileData, std::enable_if_t<!TileData::isRowMajor, int> = 0>
+template <typename GlobalData, typename TileData, AtomicType atomicType,
+          std::enable_if_t<!TileData::isRowMajor, int> = 0>
 __tf__ PTO_INLINE void StorePlainMatrix(typename GlobalData::DType __out__ *dst,
                                         typename TileData::TileDType __in__ src, int gShape3, int gShape4, int gStride3,
                                         int gStride4, int validRow, int validCol, size_t idx3)
@@ -41,16 +54,13 @@ __tf__ PTO_INLINE void StorePlainMatrix(typename GlobalData::DType __out__ *dst,
     size_t offsetSrcBase = idx3 * gShape4 * TileData::Rows;
     cpu::parallel_for_1d(0, static_cast<std::size_t>(gShape4), static_cast<std::size_t>(gShape3) * gShape4,
                          [&](std::size_t c) {
-                             const std::size_t srcBase = offsetSrcBase + c * TileData::Rows;
-                             const std::size_t dstStride4 = static_cast<std::size_t>(gStride4);
-                             PTO_CPU_VECTORIZE_LOOP
-                             for (std::size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
-                                 dst[r * static_cast<std::size_t>(gStride3) + c * dstStride4] = src[srcBase + r];
-                             }
+                             StoreRun<atomicType>(dst + c * static_cast<std::size_t>(gStride4),
+                                          src + offsetSrcBase + c * TileData::Rows, static_cast<std::size_t>(gShape3),
+                                          static_cast<std::size_t>(gStride3));
                          });
 }
 
-template <typename GlobalData, typename TileData>
+template <typename GlobalData, typename TileData, AtomicType atomicType>
 __tf__ PTO_INLINE void StorePlain(typename GlobalData::DType __out__ *dst, typename TileData::TileDType __in__ src,
                                   int gShape0, int gShape1, int gShape2, int gShape3, int gShape4, int gStride0,
                                   int gStride1, int gStride2, int gStride3, int gStride4, int validRow, int validCol)
@@ -65,102 +75,170 @@ __tf__ PTO_INLINE void StorePlain(typename GlobalData::DType __out__ *dst, typen
             int64_t dstAddr1 = j * gStride1;
             for (uint32_t k = 0; k < gShape2; k++) {
                 size_t offsetDstBase = dstAddr0 + dstAddr1 + k * gStride2;
-                StorePlainMatrix<GlobalData, TileData>(dst + offsetDstBase, src, gShape3, gShape4, gStride3, gStride4,
-                                                       validRow, validCol, srcAddr0 + srcAddr1 + k);
+                StorePlainMatrix<GlobalData, TileData, atomicType>(dst + offsetDstBase, src, gShape3, gShape4, gStride3,
+                                                                   gStride4, validRow, validCol,
+                                                                   srcAddr0 + srcAddr1 + k);
             }
         }
     }
 }
 
-template <typename GlobalData, typename TileData, std::enable_if_t<TileData::isRowMajor, int> = 0>
+template <typename GlobalData, typename TileData, AtomicType atomicType,
+          std::enable_if_t<TileData::isRowMajor, int> = 0>
 __tf__ PTO_INLINE void StoreSubfractalMatrix(typename GlobalData::DType __out__ *dst,
                                              typename TileData::TileDType __in__ src, int gShape3, int gShape4,
                                              int gStride3, int gStride4, int validRow, int validCol)
 {
-    // Zn layout
-    cpu::parallel_for_1d(
-        0, static_cast<std::size_t>(gShape4), static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t c) {
-            size_t subTileC = c / TileData::InnerCols;
-            size_t innerC = c % TileData::InnerCols;
-            for (size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
-                size_t subTileR = r / TileData::InnerRows;
-                size_t innerR = r % TileData::InnerRows;
-
-                size_t tile_idx = subTileR * TileData::Cols * TileData::InnerRows + subTileC * TileData::InnerNumel +
-                                  innerC * TileData::InnerRows + innerR;
-
-                size_t gd_idx = r * static_cast<std::size_t>(gStride3) + c * static_cast<std::size_t>(gStride4);
-                dst[gd_idx] = src[tile_idx];
-            }
-        });
+    // Zn layout: each block row is a column-major InnerRows x Cols strip, so every strip column is one run.
+    constexpr std::size_t innerRows = TileData::InnerRows;
+    const std::size_t rows = static_cast<std::size_t>(gShape3);
+    const std::size_t blocks = (rows + innerRows - 1) / innerRows;
+    cpu::parallel_for_1d(0, blocks, static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t subTileR) {
+        const std::size_t r0 = subTileR * innerRows;
+        const std::size_t n = std::min(innerRows, rows - r0);
+        const typename TileData::DType *strip = src + subTileR * TileData::Cols * innerRows;
+        for (std::size_t c = 0; c < static_cast<std::size_t>(gShape4); c++) {
+            StoreRun<atomicType>(dst + r0 * gStride3 + c * gStride4, strip + c * innerRows, n,
+                         static_cast<std::size_t>(gStride3));
+        }
+    });
 }
 
-template <typename GlobalData, typename TileData, std::enable_if_t<!TileData::isRowMajor, int> = 0>
+template <typename GlobalData, typename TileData, AtomicType atomicType,
+          std::enable_if_t<!TileData::isRowMajor, int> = 0>
 __tf__ PTO_INLINE void StoreSubfractalMatrix(typename GlobalData::DType __out__ *dst,
                                              typename TileData::TileDType __in__ src, int gShape3, int gShape4,
                                              int gStride3, int gStride4, int validRow, int validCol)
 {
-    // Nz layout
-    cpu::parallel_for_1d(
-        0, static_cast<std::size_t>(gShape4), static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t c) {
-            size_t subTileC = c / TileData::InnerCols;
-            size_t innerC = c % TileData::InnerCols;
-            for (size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
-                size_t subTileR = r / TileData::InnerRows;
-                size_t innerR = r % TileData::InnerRows;
-
-                size_t tile_idx = subTileC * TileData::Rows * TileData::InnerCols + subTileR * TileData::InnerNumel +
-                                  innerR * TileData::InnerCols + innerC;
-                size_t gd_idx = r * static_cast<std::size_t>(gStride3) + c * static_cast<std::size_t>(gStride4);
-
-                dst[gd_idx] = src[tile_idx];
-            }
-        });
+    // Nz layout: each block column is a row-major Rows x InnerCols strip, so every strip row is one run.
+    constexpr std::size_t innerCols = TileData::InnerCols;
+    const std::size_t cols = static_cast<std::size_t>(gShape4);
+    const std::size_t blocks = (cols + innerCols - 1) / innerCols;
+    cpu::parallel_for_1d(0, blocks, static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t subTileC) {
+        const std::size_t c0 = subTileC * innerCols;
+        const std::size_t n = std::min(innerCols, cols - c0);
+        const typename TileData::DType *strip = src + subTileC * TileData::Rows * innerCols;
+        for (std::size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
+            StoreRun<atomicType>(dst + r * gStride3 + c0 * gStride4, strip + r * innerCols, n,
+                         static_cast<std::size_t>(gStride4));
+        }
+    });
 }
 
-template <typename GlobalData, typename TileData>
+template <typename GlobalData, typename TileData, AtomicType atomicType = AtomicType::AtomicNone>
 __tf__ PTO_INLINE void TStore(typename GlobalData::DType __out__ *dst, typename TileData::TileDType __in__ src,
                               int gShape0, int gShape1, int gShape2, int gShape3, int gShape4, int gStride0,
                               int gStride1, int gStride2, int gStride3, int gStride4, int validRow, int validCol)
 {
     assert((gShape0 * gShape1 * gShape2 * gShape3 == validRow && gShape4 == validCol && TileData::isRowMajor) ||
            (gShape0 * gShape1 * gShape2 * gShape4 == validCol && gShape3 == validRow && !TileData::isRowMajor));
-    if (TileData::SFractal == SLayout::NoneBox) {
-        StorePlain<GlobalData, TileData>(dst, src, gShape0, gShape1, gShape2, gShape3, gShape4, gStride0, gStride1,
-                                         gStride2, gStride3, gStride4, validRow, validCol);
+    if constexpr (TileData::SFractal == SLayout::NoneBox) {
+        StorePlain<GlobalData, TileData, atomicType>(dst, src, gShape0, gShape1, gShape2, gShape3, gShape4, gStride0,
+                                                     gStride1, gStride2, gStride3, gStride4, validRow, validCol);
     } else {
         assert(gShape0 == 1 && gShape1 == 1 && gShape2 == 1 && "Nz,Zn -> ND,DN convertion does support only 2D GMs");
-        StoreSubfractalMatrix<GlobalData, TileData>(dst, src, gShape3, gShape4, gStride3, gStride4, validRow, validCol);
+        StoreSubfractalMatrix<GlobalData, TileData, atomicType>(dst, src, gShape3, gShape4, gStride3, gStride4,
+                                                                validRow, validCol);
     }
 }
 
-template <typename TileData, typename GlobalData, AtomicType atomicType = AtomicType::AtomicNone>
-PTO_INTERNAL void TSTORE_IMPL(GlobalData &dst, TileData &src)
+// Acc -> GM store through the fixpipe: every element is converted (quant scale, ReLU, saturating cast) on its way
+// out, one Nz block row of InnerCols elements at a time. quantOf(c) gives the quant parameters of column c.
+template <typename GlobalData, typename TileData, AtomicType atomicType, ReluPreMode reluMode, bool withQuant,
+          typename QuantFn>
+PTO_INTERNAL void TStoreAcc(typename GlobalData::DType *dst, typename TileData::TileDType src, int gShape3,
+                            int gShape4, int gStride3, int gStride4, QuantFn quantOf)
+{
+    static_assert(!TileData::isRowMajor && TileData::SFractal == SLayout::RowMajor, "Acc tiles must be Nz");
+    using DstT = typename GlobalData::DType;
+    constexpr std::size_t innerCols = TileData::InnerCols;
+    const std::size_t cols = static_cast<std::size_t>(gShape4);
+    const std::size_t blocks = (cols + innerCols - 1) / innerCols;
+    cpu::parallel_for_1d(0, blocks, static_cast<std::size_t>(gShape3) * gShape4, [&](std::size_t subTileC) {
+        const std::size_t c0 = subTileC * innerCols;
+        const std::size_t n = std::min(innerCols, cols - c0);
+        FixpipeQuant quant[innerCols];
+        for (std::size_t j = 0; j < n; j++) {
+            quant[j] = quantOf(c0 + j);
+        }
+        const typename TileData::DType *strip = src + subTileC * TileData::Rows * innerCols;
+        DstT out[innerCols];
+        for (std::size_t r = 0; r < static_cast<std::size_t>(gShape3); r++) {
+            const typename TileData::DType *row = strip + r * innerCols;
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t j = 0; j < n; j++) {
+                out[j] = FixpipeConvert<DstT, reluMode, withQuant>(row[j], quant[j]);
+            }
+            StoreRun<atomicType>(dst + r * gStride3 + c0 * gStride4, out, n, static_cast<std::size_t>(gStride4));
+        }
+    });
+}
+
+template <typename TileData, typename GlobalData, AtomicType atomicType, ReluPreMode reluMode, bool withQuant,
+          typename QuantFn>
+PTO_INTERNAL void TStoreAccImpl(GlobalData &dst, TileData &src, QuantFn quantOf)
 {
-    static_assert(sizeof(typename TileData::DType) == sizeof(typename GlobalData::DType),
-                  "Source dtype must be same with dst dtype!");
+    static_assert(TileData::Loc == TileType::Acc, "Source TileType only suport Acc!");
     static_assert(GlobalData::layout == pto::Layout::ND || GlobalData::layout == pto::Layout::DN,
                   "Only ND and DN GLobal Tensors are currently supported");
-    TStore<GlobalData, TileData>(dst.data(), src.data(), dst.GetShape(pto::GlobalTensorDim::DIM_0),
-                                 dst.GetShape(pto::GlobalTensorDim::DIM_1), dst.GetShape(pto::GlobalTensorDim::DIM_2),
-                                 dst.GetShape(pto::GlobalTensorDim::DIM_3), dst.GetShape(pto::GlobalTensorDim::DIM_4),
-                                 dst.GetStride(pto::GlobalTensorDim::DIM_0), dst.GetStride(pto::GlobalTensorDim::DIM_1),
-                                 dst.GetStride(pto::GlobalTensorDim::DIM_2), dst.GetStride(pto::GlobalTensorDim::DIM_3),
-                                 dst.GetStride(pto::GlobalTensorDim::DIM_4), src.GetValidRow(), src.GetValidCol());
+    assert(dst.GetShape(pto::GlobalTensorDim::DIM_0) == 1 && dst.GetShape(pto::GlobalTensorDim::DIM_1) == 1 &&
+           dst.GetShape(pto::GlobalTensorDim::DIM_2) == 1 && "Acc -> ND,DN stores support only 2D GMs");
+    assert(dst.GetShape(pto::GlobalTensorDim::DIM_3) == src.GetValidRow() &&
+           dst.GetShape(pto::GlobalTensorDim::DIM_4) == src.GetValidCol());
+    TStoreAcc<GlobalData, TileData, atomicType, reluMode, withQuant>(
+        dst.data(), src.data(), dst.GetShape(pto::GlobalTensorDim::DIM_3), dst.GetShape(pto::GlobalTensorDim::DIM_4),
+        dst.GetStride(pto::GlobalTensorDim::DIM_3), dst.GetStride(pto::GlobalTensorDim::DIM_4), quantOf);
 }
 
 template <typename TileData, typename GlobalData, AtomicType atomicType = AtomicType::AtomicNone>
+PTO_INTERNAL void TSTORE_IMPL(GlobalData &dst, TileData &src)
+{
+    if constexpr (TileData::Loc == TileType::Acc &&
+                  !std::is_same_v<typename TileData::DType, typename GlobalData::DType>) {
+        // Acc -> GM with a type change is a fixpipe cast, e.g. f32 -> f16.
+        TStoreAccImpl<TileData, GlobalData, atomicType, ReluPreMode::NoRelu, false>(
+            dst, src, [](std::size_t) { return FixpipeQuant{}; });
+    } else {
+        static_assert(sizeof(typename TileData::DType) == sizeof(typename GlobalData::DType),
+                      "Source dtype must be same with dst dtype!");
+        static_assert(!IsMxFp4<typename TileData::DType>, "float4 tiles are matmul inputs and cannot be stored");
+        static_assert(GlobalData::layout == pto::Layout::ND || GlobalData::layout == pto::Layout::DN,
+                      "Only ND and DN GLobal Tensors are currently supported");
+        TStore<GlobalData, TileData, atomicType>(
+            dst.data(), src.data(), dst.GetShape(pto::GlobalTensorDim::DIM_0),
+            dst.GetShape(pto::GlobalTensorDim::DIM_1), dst.GetShape(pto::GlobalTensorDim::DIM_2),
+            dst.GetShape(pto::GlobalTensorDim::DIM_3), dst.GetShape(pto::GlobalTensorDim::DIM_4),
+            dst.GetStride(pto::GlobalTensorDim::DIM_0), dst.GetStride(pto::GlobalTensorDim::DIM_1),
+            dst.GetStride(pto::GlobalTensorDim::DIM_2), dst.GetStride(pto::GlobalTensorDim::DIM_3),
+            dst.GetStride(pto::GlobalTensorDim::DIM_4), src.GetValidRow(), src.GetValidCol());
+    }
+}
+
+template <typename TileData, typename GlobalData, AtomicType atomicType, ReluPreMode reluPreMode>
+PTO_INTERNAL void TSTORE_IMPL(GlobalData &dst, TileData &src)
+{
+    TStoreAccImpl<TileData, GlobalData, atomicType, reluPreMode, false>(dst, src,
+                                                                        [](std::size_t) { return FixpipeQuant{}; });
+}
+
+template <typename TileData, typename GlobalData, AtomicType atomicType = AtomicType::AtomicNone,
+          ReluPreMode reluPreMode = ReluPreMode::NoRelu>
 __aicore__ void TSTORE_IMPL(GlobalData &dst, TileData &src, uint64_t preQuantScalar)
 {
-    (void)preQuantScalar;
-    TSTORE_IMPL<TileData, GlobalData, atomicType>(dst, src);
+    const FixpipeQuant quant = DecodeQuantPre(preQuantScalar);
+    TStoreAccImpl<TileData, GlobalData, atomicType, reluPreMode, true>(dst, src,
+                                                                       [&quant](std::size_t) { return quant; });
 }
 
-template <typename TileData, typename GlobalData, typename FpTileData, AtomicType atomicType = AtomicType::AtomicNone>
+template <typename TileData, typename GlobalData, typename FpTileData, AtomicType atomicType = AtomicType::AtomicNone,
+          ReluPreMode reluPreMode = ReluPreMode::NoRelu>
 __aicore__ void TSTORE_IMPL(GlobalData &dst, TileData &src, FpTileData &fp)
 {
-    (void)fp;
-    TSTORE_IMPL<TileData, GlobalData, atomicType>(dst, src);
+    static_assert(sizeof(typename FpTileData::DType) == sizeof(uint64_t), "Fp tile must hold 64-bit quant words");
+    const typename FpTileData::DType *words = fp.data();
+    TStoreAccImpl<TileData, GlobalData, atomicType, reluPreMode, true>(dst, src, [words](std::size_t c) {
+        return DecodeQuantPre(static_cast<uint64_t>(words[GetTileElementOffset<FpTileData>(0, c)]));
+    });
 }
 } // namespace pto
 #endif
@@ -12,12 +12,15 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TSYNC_HPP
 #include <pto/common/type.hpp>
 #include <pto/common/event.hpp>
+#include <pto/cpu/pipes.hpp>
 
 namespace pto {
 
 // single pipeline wait, only support MTE3 or ALL pipeline
 template <Op OpCode>
 PTO_INTERNAL void TSYNC_IMPL()
-{}
+{
+    cpu::PipeDrainAll();
+}
 } // namespace pto
 #endif
@@ -11,40 +11,123 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define TTRANS_HPP
 
 #include <pto/common/pto_tile.hpp>
+#include "pto/cpu/parallel.hpp"
 #include "pto/cpu/tile_offsets.hpp"
 namespace pto {
+// Edge of the square blocks of the blocked transpose: 8x8 for 32-bit elements, 16x16 for 16- and 8-bit ones.
+template <typename T>
+constexpr size_t TRANS_BLOCK = sizeof(T) >= 4 ? 8 : 16;
+
+// dst(c, r) = src(r, c) when the two tiles run unit-stride in opposite directions (e.g. ND -> DN): for a fixed
+// source row, both sides are contiguous over the columns, so every dst span is a plain copy.
 template <typename DstTileData, typename SrcTileData>
-void TTrans_Impl(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, unsigned validRow,
+void TTransLines(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, unsigned validRow,
                  unsigned validCol)
 {
-    for (size_t c = 0; c < validCol; c++) {
-        size_t subTileSrcC = c / SrcTileData::InnerCols;
-        size_t innerSrcC = c % SrcTileData::InnerCols;
-        size_t subTileDstC = c / DstTileData::InnerCols;
-        size_t innerDstC = c % DstTileData::InnerCols;
-
-        for (size_t r = 0; r < validRow; r++) {
-            size_t srcTileIdx, dstTileIdx;
-            if constexpr (SrcTileData::SFractal == SLayout::NoneBox)
-                srcTileIdx = GetTileElementOffsetPlain<SrcTileData>(r, c);
-            else {
-                size_t subTileR = r / SrcTileData::InnerRows;
-                size_t innerR = r % SrcTileData::InnerRows;
-                srcTileIdx = GetElementOffsetSubfractals<SrcTileData>(subTileSrcC, innerSrcC, subTileR, innerR);
+    constexpr bool dstAlongRows = TileSpansAlongRows<DstTileData>;
+    const size_t lines = dstAlongRows ? validCol : validRow;
+    const size_t extent = dstAlongRows ? validRow : validCol;
+    cpu::parallel_for_rows(lines, extent, [&](size_t line) {
+        ForEachTileSpan<DstTileData>(line, extent, [&](size_t pos, size_t offset, size_t len) {
+            if constexpr (dstAlongRows) {
+                const size_t srcCol = GetTileColOffset<SrcTileData>(line);
+                PTO_CPU_VECTORIZE_LOOP
+                for (size_t i = 0; i < len; ++i) {
+                    dst[offset + i] = src[GetTileRowOffset<SrcTileData>(pos + i) + srcCol];
+                }
+            } else {
+                const size_t srcRow = GetTileRowOffset<SrcTileData>(line);
+                PTO_CPU_VECTORIZE_LOOP
+                for (size_t i = 0; i < len; ++i) {
+                    dst[offset + i] = src[srcRow + GetTileColOffset<SrcTileData>(pos + i)];
+                }
             }
+        });
+    });
+}
 
-            if constexpr (DstTileData::SFractal == SLayout::NoneBox)
-                dstTileIdx = GetTileElementOffsetPlain<DstTileData>(c, r);
-            else {
-                size_t subTileR = r / DstTileData::InnerRows;
-                size_t innerR = r % DstTileData::InnerRows;
-                dstTileIdx = GetElementOffsetSubfractals<DstTileData>(subTileR, innerR, subTileDstC, innerDstC);
+// One B x B block at (r0, c0), staged through a local array. A full block whose rows are contiguous on both sides
+// (plain tiles, or fractals at least B wide) is moved with constant trip counts and unit strides, so the compiler
+// keeps it in registers and lowers the transpose to vector shuffles.
+template <typename DstTileData, typename SrcTileData, size_t B>
+PTO_INTERNAL void TTransBlock(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, size_t r0,
+                              size_t c0, size_t rows, size_t cols)
+{
+    constexpr bool contiguous = TileSpanLength<SrcTileData> % B == 0 && TileSpanLength<DstTileData> % B == 0;
+    typename SrcTileData::DType block[B][B];
+    if (contiguous && rows == B && cols == B) {
+        if constexpr (TileSpansAlongRows<SrcTileData>) {
+            for (size_t i = 0; i < B; ++i) {
+                const auto *in = src + GetTileElementOffset<SrcTileData>(r0 + i, c0);
+                for (size_t j = 0; j < B; ++j) {
+                    block[i][j] = in[j];
+                }
+            }
+            for (size_t j = 0; j < B; ++j) {
+                auto *out = dst + GetTileElementOffset<DstTileData>(c0 + j, r0);
+                for (size_t i = 0; i < B; ++i) {
+                    out[i] = block[i][j];
+                }
             }
-            dst[dstTileIdx] = src[srcTileIdx];
+        } else {
+            for (size_t j = 0; j < B; ++j) {
+                const auto *in = src + GetTileElementOffset<SrcTileData>(r0, c0 + j);
+                for (size_t i = 0; i < B; ++i) {
+                    block[i][j] = in[i];
+                }
+            }
+            for (size_t i = 0; i < B; ++i) {
+                auto *out = dst + GetTileElementOffset<DstTileData>(c0, r0 + i);
+                for (size_t j = 0; j < B; ++j) {
+                    out[j] = block[i][j];
+                }
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        const size_t srcRow = GetTileRowOffset<SrcTileData>(r0 + i);
+        for (size_t j = 0; j < cols; ++j) {
+            block[i][j] = src[srcRow + GetTileColOffset<SrcTileData>(c0 + j)];
+        }
+    }
+    for (size_t j = 0; j < cols; ++j) {
+        const size_t dstRow = GetTileRowOffset<DstTileData>(c0 + j);
+        for (size_t i = 0; i < rows; ++i) {
+            dst[dstRow + GetTileColOffset<DstTileData>(r0 + i)] = block[i][j];
         }
     }
 }
 
+// dst(c, r) = src(r, c) when both tiles run unit-stride in the same direction (e.g. ND -> ND): a real transpose,
+// done block by block so reads and writes both touch only B cache lines per block, in parallel over row blocks.
+template <typename DstTileData, typename SrcTileData>
+void TTransBlocked(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, unsigned validRow,
+                   unsigned validCol)
+{
+    constexpr size_t B = TRANS_BLOCK<typename SrcTileData::DType>;
+    const size_t rowBlocks = (validRow + B - 1) / B;
+    cpu::parallel_for_1d(0, rowBlocks, static_cast<size_t>(validRow) * validCol, [&](size_t rb) {
+        const size_t r0 = rb * B;
+        const size_t rows = std::min<size_t>(B, validRow - r0);
+        for (size_t c0 = 0; c0 < validCol; c0 += B) {
+            TTransBlock<DstTileData, SrcTileData, B>(dst, src, r0, c0, rows, std::min<size_t>(B, validCol - c0));
+        }
+    });
+}
+
+template <typename DstTileData, typename SrcTileData>
+void TTrans_Impl(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, unsigned validRow,
+                 unsigned validCol)
+{
+    if constexpr (TileSpansAlongRows<DstTileData> != TileSpansAlongRows<SrcTileData>) {
+        TTransLines<DstTileData, SrcTileData>(dst, src, validRow, validCol);
+    } else {
+        TTransBlocked<DstTileData, SrcTileData>(dst, src, validRow, validCol);
+    }
+}
+
+// The CPU transpose stages through registers, so tmp is not touched.
 template <typename DstTileData, typename SrcTileData, typename TmpTileData>
 PTO_INTERNAL void TTRANS_IMPL(DstTileData &dst, SrcTileData &src, TmpTileData &tmp)
 {
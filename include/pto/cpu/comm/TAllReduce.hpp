@@ -0,0 +1,76 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_COMM_TALLREDUCE_HPP
+#define PTO_CPU_COMM_TALLREDUCE_HPP
+
+#include "pto/comm/comm_types.hpp"
+#include "pto/cpu/comm/collective.hpp"
+#include "pto/cpu/comm/TBroadcast.hpp"
+#include "pto/cpu/comm/TReduce.hpp"
+
+namespace pto {
+namespace comm {
+
+// ============================================================================
+// TALLREDUCE_IMPL: every rank of the group calls it and every dstGroup[r]
+// receives the element-wise reduction of all srcGroup[r]. src and dst may be
+// the same buffers (in place). signals[r] is rank r's block of
+// CollectiveSignalWords(nranks) int32 words, zeroed before first use.
+//
+//   Ring:   reduce-scatter then all-gather around the ring; each rank moves
+//           2 * (n - 1) / n of the data, independent of the group size.
+//   Tree:   binomial-tree reduce to rank 0, then binomial-tree broadcast.
+//   Direct: rank 0 reduces everything, then writes every rank's dst.
+// ============================================================================
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData>
+PTO_INTERNAL void TALLREDUCE_IMPL(SrcGroup &srcGroup, DstGroup &dstGroup, SignalGroup &signals, int myRank,
+                                  TileData &accTileData, TileData &pingTile, TileData &pongTile, pto::comm::ReduceOp op,
+                                  CollectiveAlgo algo)
+{
+    using GlobalSrcData = typename ParallelGroupTraits<SrcGroup>::GlobalDataType;
+    using GlobalDstData = typename ParallelGroupTraits<DstGroup>::GlobalDataType;
+    static_assert(std::is_same_v<typename GlobalSrcData::RawDType, typename GlobalDstData::RawDType>,
+                  "TALLREDUCE: GlobalData type mismatch!");
+    static_assert(std::is_same_v<typename GlobalSrcData::RawDType, typename TileData::DType>,
+                  "TALLREDUCE: TileData element type must match GlobalData element type");
+
+    const int nranks = srcGroup.GetSize();
+    PTO_ASSERT(nranks > 0 && dstGroup.GetSize() == nranks && signals.GetSize() == nranks,
+               "TALLREDUCE: src, dst and signal groups must have the same size");
+    PTO_ASSERT(myRank >= 0 && myRank < nranks, "TALLREDUCE: rank out of range");
+
+    if (algo != CollectiveAlgo::Ring) {
+        SrcGroup rootedSrc(&srcGroup[0], nranks, 0);
+        DstGroup rootedDst(&dstGroup[0], nranks, 0);
+        TREDUCE_IMPL(rootedSrc, rootedDst, signals, myRank, accTileData, pingTile, pongTile, op, algo);
+        TBROADCAST_IMPL(rootedDst, rootedDst[0], signals, myRank, pingTile, pongTile, algo);
+        return;
+    }
+
+    detail::CollectiveChannel<SignalGroup> chan(signals, myRank);
+    detail::CollectiveChunks chunks(srcGroup[myRank], accTileData);
+    if (chunks.Count() == 0) {
+        return;
+    }
+    if (nranks == 1) {
+        for (int64_t c = 0; c < chunks.Count(); ++c) {
+            detail::CopyChunk(dstGroup[0], srcGroup[0], chunks[c], accTileData);
+        }
+        return;
+    }
+    detail::RingReduceScatter(srcGroup, dstGroup, chan, myRank, chunks, accTileData, pingTile, pongTile, op);
+    detail::RingAllGather(dstGroup, chan, myRank, chunks, pingTile, pongTile, false);
+}
+
+} // namespace comm
+} // namespace pto
+
+#endif
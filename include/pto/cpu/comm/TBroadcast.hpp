@@ -13,35 +13,21 @@ See LICENSE in the root of the software repository for the full text of the Lice
 
 #include <pto/common/pto_tile.hpp>
 #include <type_traits>
+#include "pto/cpu/comm/TGet.hpp"
+#include "pto/cpu/comm/collective.hpp"
 
 namespace pto {
 namespace comm {
-template <typename GlobalData>
-void Copy(typename GlobalData::DType *dst, typename GlobalData::DType *src, long int shape[], long int stride[])
-{
-    for (size_t i = 0; i < shape[0]; i++) {
-        for (size_t j = 0; j < shape[1]; j++) {
-            for (size_t k = 0; k < shape[2]; k++) {
-                for (size_t l = 0; l < shape[3]; l++) {
-                    for (size_t m = 0; m < shape[4]; m++) {
-                        int index = i * stride[0] + j * stride[1] + k * stride[2] + l * stride[3] + m * stride[4];
-                        dst[index] = src[index];
-                    }
-                }
-            }
-        }
-    }
-}
-
 template <typename ParallelGroupType, typename GlobalData>
 PTO_INTERNAL void TBroadcast_Impl(ParallelGroupType &parallelGroup, GlobalData &src)
 {
-    long int shape[5] = {src.GetShape(0), src.GetShape(1), src.GetShape(2), src.GetShape(3), src.GetShape(4)};
-    long int stride[5] = {src.GetStride(0), src.GetStride(1), src.GetStride(2), src.GetStride(3), src.GetStride(4)};
     int groupSize = parallelGroup.GetSize();
-    for (unsigned n = 0; n < groupSize; ++n) {
-        GlobalData &member = parallelGroup[n];
-        Copy<GlobalData>(member.data(), src.data(), shape, stride);
+    for (int n = 0; n < groupSize; ++n) {
+        auto &member = parallelGroup[n];
+        // The root usually broadcasts out of its own member buffer, which already holds the data.
+        if (member.data() != src.data()) {
+            Copy_Data(member, src);
+        }
     }
 }
 
@@ -59,6 +45,163 @@ PTO_INTERNAL void TBROADCAST_IMPL(ParallelGroupType &parallelGroup, GlobalSrcDat
     TBroadcast_Impl<ParallelGroupType, GlobalSrcData>(parallelGroup, srcGlobalData);
 }
 
+// ============================================================================
+// TBROADCAST_IMPL (collective): every rank of the group calls it
+//
+// group[r] is rank r's destination buffer and group.GetRootIdx() the root,
+// whose srcGlobalData is copied into every group[r]. signals[r] is rank r's
+// block of CollectiveSignalWords(nranks) int32 words, zeroed before first use.
+//
+//   Direct: the root writes every member itself.
+//   Ring:   each rank pulls one segment from the root, then a ring all-gather.
+//   Tree:   binomial tree; each rank forwards a chunk as soon as it has it.
+// ============================================================================
+namespace detail {
+// Rank me starts with segment (me + 1) % n of group[me] complete and ends with all of it. Ranks with skipWrite
+// already hold everything and only relay flags.
+template <typename ParallelGroupType, typename SignalGroup, typename TileData>
+PTO_INTERNAL void RingAllGather(ParallelGroupType &group, CollectiveChannel<SignalGroup> &chan, int me,
+                                const CollectiveChunks &chunks, TileData &ping, TileData &pong, bool skipWrite)
+{
+    const int n = group.GetSize();
+    const int prev = (me + n - 1) % n;
+    const int next = (me + 1) % n;
+    chan.Post(next);
+    for (int s = 0; s < n - 1; ++s) {
+        const int seg = (me - s + n) % n;
+        chan.Await(prev);
+        if (!skipWrite) {
+            for (int64_t c = chunks.SegmentBegin(seg, n); c < chunks.SegmentBegin(seg + 1, n); ++c) {
+                CopyChunk(group[me], group[prev], chunks[c], (c % 2 == 0) ? ping : pong);
+            }
+        }
+        if (s < n - 2) {
+            chan.Post(next);
+        }
+    }
+    chan.Post(prev);
+    chan.Await(next);
+}
+
+template <typename ParallelGroupType, typename GlobalSrcData, typename SignalGroup, typename TileData>
+PTO_INTERNAL void RingBroadcast(ParallelGroupType &group, GlobalSrcData &src, CollectiveChannel<SignalGroup> &chan,
+                                int me, int root, const CollectiveChunks &chunks, TileData &ping, TileData &pong)
+{
+    const int n = group.GetSize();
+    if (me == root) {
+        for (int64_t c = 0; c < chunks.Count(); ++c) {
+            CopyChunk(group[root], src, chunks[c], (c % 2 == 0) ? ping : pong);
+        }
+        for (int r = 0; r < n; ++r) {
+            if (r != root) {
+                chan.Post(r);
+            }
+        }
+    } else {
+        chan.Await(root);
+        const int seg = (me + 1) % n;
+        for (int64_t c = chunks.SegmentBegin(seg, n); c < chunks.SegmentBegin(seg + 1, n); ++c) {
+            CopyChunk(group[me], group[root], chunks[c], (c % 2 == 0) ? ping : pong);
+        }
+    }
+    RingAllGather(group, chan, me, chunks, ping, pong, me == root);
+    if (me != root) {
+        chan.Post(root);
+        return;
+    }
+    for (int r = 0; r < n; ++r) {
+        if (r != root) {
+            chan.Await(r);
+        }
+    }
+}
+
+template <typename ParallelGroupType, typename GlobalSrcData, typename SignalGroup, typename TileData>
+PTO_INTERNAL void TreeBroadcast(ParallelGroupType &group, GlobalSrcData &src, CollectiveChannel<SignalGroup> &chan,
+                                int me, int root, const CollectiveChunks &chunks, TileData &ping, TileData &pong)
+{
+    const int n = group.GetSize();
+    const int v = TreeRelative(me, root, n);
+    const int parent = (v == 0) ? -1 : TreeAbsolute(TreeParent(v), root, n);
+    const int firstBit = TreeFirstChildBit(v);
+    for (int64_t c = 0; c < chunks.Count(); ++c) {
+        TileData &tile = (c % 2 == 0) ? ping : pong;
+        if (v == 0) {
+            CopyChunk(group[me], src, chunks[c], tile);
+        } else {
+            chan.Await(parent);
+            CopyChunk(group[me], group[parent], chunks[c], tile);
+        }
+        for (int bit = firstBit; v + bit < n; bit *= 2) {
+            chan.Post(TreeAbsolute(v + bit, root, n));
+        }
+    }
+    // Children read this rank's buffer until they acknowledge.
+    if (v != 0) {
+        chan.Post(parent);
+    }
+    for (int bit = firstBit; v + bit < n; bit *= 2) {
+        chan.Await(TreeAbsolute(v + bit, root, n));
+    }
+}
+
+template <typename ParallelGroupType, typename GlobalSrcData, typename SignalGroup>
+PTO_INTERNAL void DirectBroadcast(ParallelGroupType &group, GlobalSrcData &src, CollectiveChannel<SignalGroup> &chan,
+                                  int me, int root)
+{
+    const int n = group.GetSize();
+    if (me != root) {
+        chan.Post(root);
+        chan.Await(root);
+        return;
+    }
+    for (int r = 0; r < n; ++r) {
+        if (r != root) {
+            chan.Await(r);
+        }
+    }
+    TBroadcast_Impl<ParallelGroupType, GlobalSrcData>(group, src);
+    for (int r = 0; r < n; ++r) {
+        if (r != root) {
+            chan.Post(r);
+        }
+    }
+}
+} // namespace detail
+
+template <typename ParallelGroupType, typename GlobalSrcData, typename SignalGroup, typename TileData>
+PTO_INTERNAL void TBROADCAST_IMPL(ParallelGroupType &parallelGroup, GlobalSrcData &srcGlobalData, SignalGroup &signals,
+                                  int myRank, TileData &pingTile, TileData &pongTile, CollectiveAlgo algo)
+{
+    const int root = parallelGroup.GetRootIdx();
+    const int nranks = parallelGroup.GetSize();
+    PTO_ASSERT(nranks > 0 && signals.GetSize() == nranks, "TBROADCAST: data and signal groups must have the same size");
+    PTO_ASSERT(root >= 0 && root < nranks && myRank >= 0 && myRank < nranks, "TBROADCAST: rank out of range");
+
+    detail::CollectiveChannel<SignalGroup> chan(signals, myRank);
+    detail::CollectiveChunks chunks(parallelGroup[myRank], pingTile);
+    if (chunks.Count() == 0) {
+        return;
+    }
+    if (nranks == 1) {
+        for (int64_t c = 0; c < chunks.Count(); ++c) {
+            detail::CopyChunk(parallelGroup[0], srcGlobalData, chunks[c], pingTile);
+        }
+        return;
+    }
+    switch (algo) {
+        case CollectiveAlgo::Ring:
+            detail::RingBroadcast(parallelGroup, srcGlobalData, chan, myRank, root, chunks, pingTile, pongTile);
+            break;
+        case CollectiveAlgo::Tree:
+            detail::TreeBroadcast(parallelGroup, srcGlobalData, chan, myRank, root, chunks, pingTile, pongTile);
+            break;
+        default:
+            detail::DirectBroadcast(parallelGroup, srcGlobalData, chan, myRank, root);
+            break;
+    }
+}
+
 } // namespace comm
 } // namespace pto
 
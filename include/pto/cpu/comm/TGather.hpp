@@ -18,6 +18,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/common/constants.hpp"
 #include "pto/common/pto_instr.hpp"
 #include "pto/comm/comm_types.hpp"
+#include "pto/cpu/strided_copy.hpp"
 
 namespace pto {
 namespace comm {
@@ -44,6 +45,27 @@ namespace comm {
 //   - All source tensors in the ParallelGroup are assumed to have the same shape/strides.
 // ============================================================================
 
+namespace detail {
+// Copies each rank's (D0, D1, D2, H, W) tensor into rows [r * H, (r + 1) * H) of dst.
+template <typename ParallelGroupType, typename GlobalDstData>
+PTO_INTERNAL void GatherRows(ParallelGroupType &parallelGroup, GlobalDstData &dstGlobalData)
+{
+    const int nranks = parallelGroup.GetSize();
+    for (int r = 0; r < nranks; ++r) {
+        auto &src = parallelGroup[r];
+        const int64_t rows = src.GetShape(GlobalTensorDim::DIM_3);
+        PTO_ASSERT(dstGlobalData.GetShape(GlobalTensorDim::DIM_3) == nranks * rows,
+                   "TGATHER: dst DIM_3 must be nranks times the per-rank DIM_3");
+        pto::cpu::StridedLayout layout = pto::cpu::StridedLayoutOf(dstGlobalData, src);
+        for (int d = 0; d < pto::cpu::STRIDED_DIMS; ++d) {
+            layout.shape[d] = src.GetShape(d);
+        }
+        const int64_t offset = r * rows * dstGlobalData.GetStride(GlobalTensorDim::DIM_3);
+        pto::cpu::CopyStrided<false>(dstGlobalData.data() + offset, src.data(), layout);
+    }
+}
+} // namespace detail
+
 template <typename ParallelGroupType, typename GlobalDstData, typename TileData>
 PTO_INTERNAL void TGATHER_IMPL(ParallelGroupType &parallelGroup, GlobalDstData &dstGlobalData,
                                TileData &stagingTileData)
@@ -56,7 +78,7 @@ PTO_INTERNAL void TGATHER_IMPL(ParallelGroupType &parallelGroup, GlobalDstData &
                   "TGATHER: TileData element type must match GlobalData element type");
     static_assert(GlobalSrcData::layout == GlobalDstData::layout, "TGATHER: src/dst layout mismatch");
 
-    // CPU Logic is not implemented yet
+    detail::GatherRows(parallelGroup, dstGlobalData);
 }
 
 // ============================================================================
@@ -89,7 +111,7 @@ PTO_INTERNAL void TGATHER_IMPL(ParallelGroupType &parallelGroup, GlobalDstData &
     const int nranks = parallelGroup.GetSize();
     const int rootIdx = parallelGroup.GetRootIdx();
 
-    // CPU Logic is not implemented yet
+    detail::GatherRows(parallelGroup, dstGlobalData);
 }
 
 } // namespace comm
@@ -14,36 +14,18 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include <pto/common/pto_tile.hpp>
 #include "pto/cpu/tile_offsets.hpp"
 #include "pto/cpu/parallel.hpp"
+#include "pto/cpu/strided_copy.hpp"
 
 namespace pto {
 namespace comm {
 
+// GM-to-GM transfer shared by the CPU comm data movers. dst gives the shape, each side keeps its own strides.
+// There is no DMA engine to feed on the CPU, so staging tiles are not bounced through.
 template <typename GlobalDstData, typename GlobalSrcData, AtomicType atomicType = AtomicType::AtomicNone>
 PTO_INTERNAL void Copy_Data(GlobalDstData &dstTensor, GlobalSrcData &srcTensor)
 {
-    typename GlobalDstData::DType *dst = dstTensor.data();
-    typename GlobalSrcData::DType *src = srcTensor.data();
-    long shape[] = {dstTensor.GetShape(0), dstTensor.GetShape(1), dstTensor.GetShape(2), dstTensor.GetShape(3),
-                    dstTensor.GetShape(4)};
-    long stride[] = {dstTensor.GetStride(0), dstTensor.GetStride(1), dstTensor.GetStride(2), dstTensor.GetStride(3),
-                     dstTensor.GetStride(4)};
-
-    for (size_t i = 0; i < shape[0]; i++) {
-        for (size_t j = 0; j < shape[1]; j++) {
-            for (size_t k = 0; k < shape[2]; k++) {
-                for (size_t l = 0; l < shape[3]; l++) {
-                    for (size_t m = 0; m < shape[4]; m++) {
-                        int index = i * stride[0] + j * stride[1] + k * stride[2] + l * stride[3] + m * stride[4];
-                        if constexpr (atomicType == AtomicType::AtomicNone) {
-                            dst[index] = src[index];
-                        } else {
-                            dst[index] += src[index];
-                        }
-                    }
-                }
-            }
-        }
-    }
+    pto::cpu::CopyStrided<atomicType == AtomicType::AtomicAdd>(dstTensor.data(), srcTensor.data(),
+                                                               pto::cpu::StridedLayoutOf(dstTensor, srcTensor));
 }
 
 template <typename GlobalDstData, typename GlobalSrcData, typename TileData>
@@ -16,21 +16,25 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/cpu/tile_offsets.hpp"
 #include "pto/common/pto_instr.hpp"
 #include "pto/cpu/parallel.hpp"
+#include "pto/cpu/comm/signal.hpp"
 
 namespace pto {
 namespace comm {
 
 using NotifyOp = ::pto::comm::NotifyOp;
 
+// The update is atomic and wakes any TWAIT parked on the signal, in this process or another one sharing it.
 template <typename GlobalSignalData>
 void TNotify_Impl(typename GlobalSignalData::DType *dstSignaData, int32_t value, NotifyOp op)
 {
+    static_assert(sizeof(typename GlobalSignalData::DType) == sizeof(int32_t), "TNOTIFY: signal type must be 32-bit");
+    int32_t *word = reinterpret_cast<int32_t *>(dstSignaData);
     switch (op) {
         case NotifyOp::AtomicAdd:
-            dstSignaData[0] = dstSignaData[0] + value;
+            detail::SignalFetchAdd(word, value);
             break;
         case NotifyOp::Set:
-            dstSignaData[0] = value;
+            detail::SignalStore(word, value);
             break;
         default:
             break;
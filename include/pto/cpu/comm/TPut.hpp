@@ -18,13 +18,13 @@ namespace comm {
 template <typename GlobalDstData, typename GlobalSrcData, typename TileData, AtomicType atomicType>
 PTO_INTERNAL void TPUT_IMPL(GlobalDstData &dst, GlobalSrcData &src, TileData &src1)
 {
-    Copy_Data(src, dst);
+    Copy_Data<GlobalDstData, GlobalSrcData, atomicType>(dst, src);
 }
 
-template <typename GlobalDstData, typename GlobalSrcData, typename TileData>
+template <typename GlobalDstData, typename GlobalSrcData, typename TileData, AtomicType atomicType>
 PTO_INTERNAL void TPUT_IMPL(GlobalDstData &dst, GlobalSrcData &src, TileData &ping, TileData &pong)
 {
-    Copy_Data(src, dst);
+    Copy_Data<GlobalDstData, GlobalSrcData, atomicType>(dst, src);
 }
 
 template <typename GlobalDstData, typename GlobalSrcData>
@@ -36,7 +36,7 @@ PTO_INTERNAL void TGET_ASYNC_IMPL(GlobalDstData &dst, GlobalSrcData &src)
 template <typename GlobalDstData, typename GlobalSrcData>
 PTO_INTERNAL void TPUT_ASYNC_IMPL(GlobalDstData &dst, GlobalSrcData &src)
 {
-    Copy_Data(src, dst);
+    Copy_Data(dst, src);
 }
 
 } // namespace comm
@@ -18,6 +18,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/common/constants.hpp"
 #include "pto/common/pto_instr.hpp"
 #include "pto/comm/comm_types.hpp"
+#include "pto/cpu/comm/collective.hpp"
 
 namespace pto {
 namespace comm {
@@ -463,6 +464,185 @@ PTO_INTERNAL void TREDUCE_IMPL(ParallelGroupType &parallelGroup, GlobalDstData &
     }
 }
 
+// ============================================================================
+// TREDUCE_IMPL (collective): every rank of the group calls it
+//
+// srcGroup[r] / dstGroup[r] are rank r's source and destination buffers and
+// srcGroup.GetRootIdx() is the root. The result lands in dstGroup[root]; the
+// other ranks' dst buffers hold partial results. signals[r] is rank r's block
+// of CollectiveSignalWords(nranks) int32 words, zeroed before first use.
+//
+//   Direct: the root reduces every rank's source itself (TREDUCE ping-pong).
+//   Ring:   ring reduce-scatter, then the root gathers one segment per rank.
+//   Tree:   binomial tree; each rank reduces its children's partials chunk by
+//           chunk and forwards them, so levels of the tree overlap.
+// ============================================================================
+namespace detail {
+// After it, dstGroup[me] holds the full reduction of segment (me + 1) % n. Each step pulls the previous rank's
+// partial of one segment and folds in the local source.
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData>
+PTO_INTERNAL void RingReduceScatter(SrcGroup &srcGroup, DstGroup &dstGroup, CollectiveChannel<SignalGroup> &chan,
+                                    int me, const CollectiveChunks &chunks, TileData &acc, TileData &ping,
+                                    TileData &pong, pto::comm::ReduceOp op)
+{
+    const int n = srcGroup.GetSize();
+    const int prev = (me + n - 1) % n;
+    const int next = (me + 1) % n;
+    chan.Post(next);
+    for (int s = 0; s < n - 1; ++s) {
+        const int seg = (me - s - 1 + 2 * n) % n;
+        chan.Await(prev);
+        for (int64_t c = chunks.SegmentBegin(seg, n); c < chunks.SegmentBegin(seg + 1, n); ++c) {
+            const CollectiveChunk chunk = chunks[c];
+            TileData &recv = (c % 2 == 0) ? ping : pong;
+            LoadChunk(acc, srcGroup[me], chunk);
+            if (s == 0) {
+                LoadChunk(recv, srcGroup[prev], chunk);
+            } else {
+                LoadChunk(recv, dstGroup[prev], chunk);
+            }
+            ReduceTiles(acc, recv, op);
+            StoreChunk(dstGroup[me], chunk, acc);
+        }
+        if (s < n - 2) {
+            chan.Post(next);
+        }
+    }
+    // The next rank reads this rank's buffers until it has finished its own steps.
+    chan.Post(prev);
+    chan.Await(next);
+}
+
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData>
+PTO_INTERNAL void TreeReduce(SrcGroup &srcGroup, DstGroup &dstGroup, CollectiveChannel<SignalGroup> &chan, int me,
+                             int root, const CollectiveChunks &chunks, TileData &acc, TileData &ping, TileData &pong,
+                             pto::comm::ReduceOp op)
+{
+    const int n = srcGroup.GetSize();
+    const int v = TreeRelative(me, root, n);
+    const int parent = (v == 0) ? -1 : TreeAbsolute(TreeParent(v), root, n);
+    const int firstBit = TreeFirstChildBit(v);
+    if (v != 0 && !TreeHasChildren(v, n)) {
+        // A leaf's partial is its source: the parent reads it in place.
+        chan.Post(parent);
+        chan.Await(parent);
+        return;
+    }
+    for (int64_t c = 0; c < chunks.Count(); ++c) {
+        const CollectiveChunk chunk = chunks[c];
+        LoadChunk(acc, srcGroup[me], chunk);
+        int k = 0;
+        for (int bit = firstBit; v + bit < n; bit *= 2, ++k) {
+            const int child = TreeAbsolute(v + bit, root, n);
+            const bool leaf = !TreeHasChildren(v + bit, n);
+            if (!leaf || c == 0) {
+                chan.Await(child);
+            }
+            TileData &recv = ((c + k) % 2 == 0) ? ping : pong;
+            if (leaf) {
+                LoadChunk(recv, srcGroup[child], chunk);
+            } else {
+                LoadChunk(recv, dstGroup[child], chunk);
+            }
+            ReduceTiles(acc, recv, op);
+        }
+        StoreChunk(dstGroup[me], chunk, acc);
+        if (v != 0) {
+            chan.Post(parent);
+        }
+    }
+    for (int bit = firstBit; v + bit < n; bit *= 2) {
+        chan.Post(TreeAbsolute(v + bit, root, n));
+    }
+    if (v != 0) {
+        chan.Await(parent);
+    }
+}
+
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData>
+PTO_INTERNAL void RingReduce(SrcGroup &srcGroup, DstGroup &dstGroup, CollectiveChannel<SignalGroup> &chan, int me,
+                             int root, const CollectiveChunks &chunks, TileData &acc, TileData &ping, TileData &pong,
+                             pto::comm::ReduceOp op)
+{
+    const int n = srcGroup.GetSize();
+    RingReduceScatter(srcGroup, dstGroup, chan, me, chunks, acc, ping, pong, op);
+    if (me != root) {
+        chan.Post(root);
+        chan.Await(root);
+        return;
+    }
+    for (int owner = 0; owner < n; ++owner) {
+        if (owner == root) {
+            continue;
+        }
+        chan.Await(owner);
+        const int seg = (owner + 1) % n;
+        for (int64_t c = chunks.SegmentBegin(seg, n); c < chunks.SegmentBegin(seg + 1, n); ++c) {
+            CopyChunk(dstGroup[root], dstGroup[owner], chunks[c], (c % 2 == 0) ? ping : pong);
+        }
+        chan.Post(owner);
+    }
+}
+
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData>
+PTO_INTERNAL void DirectReduce(SrcGroup &srcGroup, DstGroup &dstGroup, CollectiveChannel<SignalGroup> &chan, int me,
+                               int root, TileData &acc, TileData &ping, TileData &pong, pto::comm::ReduceOp op)
+{
+    const int n = srcGroup.GetSize();
+    if (me != root) {
+        chan.Post(root);
+        chan.Await(root);
+        return;
+    }
+    for (int r = 0; r < n; ++r) {
+        if (r != root) {
+            chan.Await(r);
+        }
+    }
+    TREDUCE_IMPL(srcGroup, dstGroup[root], acc, ping, pong, op);
+    for (int r = 0; r < n; ++r) {
+        if (r != root) {
+            chan.Post(r);
+        }
+    }
+}
+} // namespace detail
+
+template <typename SrcGroup, typename DstGroup, typename SignalGroup, typename TileData>
+PTO_INTERNAL void TREDUCE_IMPL(SrcGroup &srcGroup, DstGroup &dstGroup, SignalGroup &signals, int myRank,
+                               TileData &accTileData, TileData &pingTile, TileData &pongTile, pto::comm::ReduceOp op,
+                               CollectiveAlgo algo)
+{
+    const int root = srcGroup.GetRootIdx();
+    const int nranks = srcGroup.GetSize();
+    PTO_ASSERT(nranks > 0 && dstGroup.GetSize() == nranks && signals.GetSize() == nranks,
+               "TREDUCE: src, dst and signal groups must have the same size");
+    PTO_ASSERT(root >= 0 && root < nranks && myRank >= 0 && myRank < nranks, "TREDUCE: rank out of range");
+
+    detail::CollectiveChannel<SignalGroup> chan(signals, myRank);
+    detail::CollectiveChunks chunks(srcGroup[myRank], accTileData);
+    if (chunks.Count() == 0) {
+        return;
+    }
+    if (nranks == 1) {
+        for (int64_t c = 0; c < chunks.Count(); ++c) {
+            detail::CopyChunk(dstGroup[0], srcGroup[0], chunks[c], accTileData);
+        }
+        return;
+    }
+    switch (algo) {
+        case CollectiveAlgo::Ring:
+            detail::RingReduce(srcGroup, dstGroup, chan, myRank, root, chunks, accTileData, pingTile, pongTile, op);
+            break;
+        case CollectiveAlgo::Tree:
+            detail::TreeReduce(srcGroup, dstGroup, chan, myRank, root, chunks, accTileData, pingTile, pongTile, op);
+            break;
+        default:
+            detail::DirectReduce(srcGroup, dstGroup, chan, myRank, root, accTileData, pingTile, pongTile, op);
+            break;
+    }
+}
+
 } // namespace comm
 } // namespace pto
 
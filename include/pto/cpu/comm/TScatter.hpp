@@ -18,6 +18,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #include "pto/common/constants.hpp"
 #include "pto/common/pto_instr.hpp"
 #include "pto/comm/comm_types.hpp"
+#include "pto/cpu/strided_copy.hpp"
 
 namespace pto {
 namespace comm {
@@ -44,6 +45,24 @@ namespace comm {
 //   - All destination tensors in the ParallelGroup are assumed to have the same shape/strides.
 // ============================================================================
 
+namespace detail {
+// Copies rows [r * H, (r + 1) * H) of src into each rank's (D0, D1, D2, H, W) tensor.
+template <typename ParallelGroupType, typename GlobalSrcData>
+PTO_INTERNAL void ScatterRows(ParallelGroupType &parallelGroup, GlobalSrcData &srcGlobalData)
+{
+    const int nranks = parallelGroup.GetSize();
+    for (int r = 0; r < nranks; ++r) {
+        auto &dst = parallelGroup[r];
+        const int64_t rows = dst.GetShape(GlobalTensorDim::DIM_3);
+        PTO_ASSERT(srcGlobalData.GetShape(GlobalTensorDim::DIM_3) == nranks * rows,
+                   "TSCATTER: src DIM_3 must be nranks times the per-rank DIM_3");
+        const int64_t offset = r * rows * srcGlobalData.GetStride(GlobalTensorDim::DIM_3);
+        pto::cpu::CopyStrided<false>(dst.data(), srcGlobalData.data() + offset,
+                                     pto::cpu::StridedLayoutOf(dst, srcGlobalData));
+    }
+}
+} // namespace detail
+
 template <typename ParallelGroupType, typename GlobalSrcData, typename TileData>
 PTO_INTERNAL void TSCATTER_IMPL(ParallelGroupType &parallelGroup, GlobalSrcData &srcGlobalData,
                                 TileData &stagingTileData)
@@ -62,7 +81,7 @@ PTO_INTERNAL void TSCATTER_IMPL(ParallelGroupType &parallelGroup, GlobalSrcData
     PTO_ASSERT(nranks > 0, "ParallelGroup size must be greater than 0!");
     PTO_ASSERT(rootIdx >= 0 && rootIdx < nranks, "rootIdx must be in range [0, nranks)!");
 
-    // CPU Logic is not implemented yet
+    detail::ScatterRows(parallelGroup, srcGlobalData);
 }
 
 // ============================================================================
@@ -98,7 +117,7 @@ PTO_INTERNAL void TSCATTER_IMPL(ParallelGroupType &parallelGroup, GlobalSrcData
     PTO_ASSERT(nranks > 0, "ParallelGroup size must be greater than 0!");
     PTO_ASSERT(rootIdx >= 0 && rootIdx < nranks, "rootIdx must be in range [0, nranks)!");
 
-    // CPU Logic is not implemented yet
+    detail::ScatterRows(parallelGroup, srcGlobalData);
 }
 
 } // namespace comm
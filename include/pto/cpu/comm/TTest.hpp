@@ -12,6 +12,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define PTO_TTEST_HPP
 
 #include "pto/comm/comm_types.hpp"
+#include "pto/cpu/comm/signal.hpp"
 
 namespace pto {
 namespace comm {
@@ -36,13 +37,13 @@ PTO_INTERNAL bool TestCompareSignal(int32_t sigVal, int32_t cmpVal, WaitCmp cmp)
     }
 }
 
-PTO_INTERNAL bool TestPartSignal(volatile int32_t *basePtr, int32_t cmpValue, WaitCmp cmp, int d0, int st0, int d1,
-                                 int st1, int d2, int st2, int s3, int st3, int s4)
+PTO_INTERNAL bool TestPartSignal(int32_t *basePtr, int32_t cmpValue, WaitCmp cmp, int d0, int st0, int d1, int st1,
+                                 int d2, int st2, int s3, int st3, int s4)
 {
     for (int d3 = 0; d3 < s3; ++d3) {
         for (int d4 = 0; d4 < s4; ++d4) {
             const int idx = d0 * st0 + d1 * st1 + d2 * st2 + d3 * st3 + d4;
-            if (!TestCompareSignal(basePtr[idx], cmpValue, cmp)) {
+            if (!TestCompareSignal(detail::SignalLoad(basePtr + idx), cmpValue, cmp)) {
                 return false;
             }
         }
@@ -68,7 +69,7 @@ PTO_INTERNAL bool TTEST_IMPL(GlobalSignalData &signalData, int32_t cmpValue, Wai
     const int st2 = signalData.GetStride(GlobalTensorDim::DIM_2);
     const int st3 = signalData.GetStride(GlobalTensorDim::DIM_3);
 
-    volatile int32_t *basePtr = (volatile int32_t *)signalData.data();
+    int32_t *basePtr = reinterpret_cast<int32_t *>(signalData.data());
 
     // Test if all signals satisfy the condition (full 5-D traversal)
     for (int d0 = 0; d0 < s0; ++d0) {
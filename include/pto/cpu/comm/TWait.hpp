@@ -13,11 +13,10 @@ See LICENSE in the root of the software repository for the full text of the Lice
 
 #pragma once
 
-#include <thread>
-#include <chrono>
-#include <atomic>
+#include <cstdint>
 #include <type_traits>
 #include "pto/comm/comm_types.hpp"
+#include "pto/cpu/comm/signal.hpp"
 
 namespace pto {
 namespace comm {
@@ -63,33 +62,32 @@ inline void TWAIT_IMPL(GlobalSignalData &signalData, int32_t cmpValue, comm::Wai
     PTO_ASSERT(s0 > 0 && s1 > 0 && s2 > 0 && s3 > 0 && s4 > 0,
                "TWAIT: possible deadlock detected, spin count exceeded maximum limit");
 
-    bool allSatisfied = false;
-    uint32_t spin = 0;
-    constexpr uint32_t kMaxSpinCount = 100000000;
-    while (!allSatisfied) {
-        allSatisfied = true;
-        for (int flat = 0; flat < total && allSatisfied; ++flat) {
-            int tmp = flat;
-            const int d4 = tmp % s4;
-            tmp /= s4;
-            const int d3 = tmp % s3;
-            tmp /= s3;
-            const int d2 = tmp % s2;
-            tmp /= s2;
-            const int d1 = tmp % s1;
-            tmp /= s1;
-            const int d0 = tmp;
-            const int64_t idx = d0 * st0 + d1 * st1 + d2 * st2 + d3 * st3 + d4 * st4;
-            int32_t val = reinterpret_cast<std::atomic<int32_t> *>(basePtr + idx)->load(std::memory_order_acquire);
-            if (!detail::CompareSignalRuntime(val, cmpValue, cmp)) {
-                allSatisfied = false;
-            }
-        }
-        if (!allSatisfied) {
-            PTO_ASSERT(spin < kMaxSpinCount, "TWAIT: possible deadlock detected, spin count exceeded maximum limit");
-            std::this_thread::sleep_for(std::chrono::microseconds(10));
-            ++spin;
+    // Scan until one pass sees every element satisfied. On a miss, spin and then park on the element that failed
+    // until it changes; TNOTIFY wakes it directly. Only parks that time out with no change count towards the limit.
+    uint32_t idleParks = 0;
+    int flat = 0;
+    int satisfied = 0;
+    while (satisfied < total) {
+        int tmp = flat;
+        const int d4 = tmp % s4;
+        tmp /= s4;
+        const int d3 = tmp % s3;
+        tmp /= s3;
+        const int d2 = tmp % s2;
+        tmp /= s2;
+        const int d1 = tmp % s1;
+        tmp /= s1;
+        const int d0 = tmp;
+        int32_t *word = basePtr + (d0 * st0 + d1 * st1 + d2 * st2 + d3 * st3 + d4 * st4);
+        const int32_t val = detail::SignalLoad(word);
+        if (detail::CompareSignalRuntime(val, cmpValue, cmp)) {
+            satisfied++;
+        } else {
+            PTO_ASSERT(idleParks < 1000000u, "TWAIT: possible deadlock detected, spin count exceeded maximum limit");
+            idleParks = detail::SignalAwaitChange(word, val) ? 0 : idleParks + 1;
+            satisfied = 0;
         }
+        flat = (flat + 1) % total;
     }
 }
 
@@ -0,0 +1,222 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_COMM_COLLECTIVE_HPP
+#define PTO_CPU_COMM_COLLECTIVE_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "pto/common/pto_instr.hpp"
+#include "pto/comm/comm_types.hpp"
+#include "pto/cpu/comm/TNotify.hpp"
+#include "pto/cpu/comm/TWait.hpp"
+
+// Building blocks for collectives that every rank of a group calls (CollectiveAlgo Ring/Tree/Direct): a tile-sized
+// chunking of the data shared by all ranks, and point-to-point flags carried by TNOTIFY/TWAIT.
+namespace pto {
+namespace comm {
+
+// Number of int32 words each rank's signal block must provide for a group of nranks.
+PTO_INTERNAL constexpr int CollectiveSignalWords(int nranks)
+{
+    return 2 * nranks;
+}
+
+namespace detail {
+// Flags between ranks. Word p of a rank's block counts posts received from rank p; word nranks + p counts how many
+// of them this rank has consumed, and is only touched by the owner. Counts only grow, so a rank running ahead into
+// the next collective never confuses a peer, as long as every post is awaited by the protocol that made it.
+template <typename SignalGroup>
+class CollectiveChannel {
+public:
+    CollectiveChannel(SignalGroup &signals, int myRank) : signals_(signals), me_(myRank), n_(signals.GetSize()) {}
+
+    void Post(int peer)
+    {
+        Signal flag(reinterpret_cast<int32_t *>(signals_[peer].data()) + me_);
+        TNOTIFY_IMPL(flag, 1, NotifyOp::AtomicAdd);
+    }
+
+    void Await(int peer)
+    {
+        int32_t *own = reinterpret_cast<int32_t *>(signals_[me_].data());
+        const int32_t expected = ++own[n_ + peer];
+        Signal flag(own + peer);
+        TWAIT_IMPL(flag, expected, WaitCmp::GE);
+    }
+
+private:
+    SignalGroup &signals_;
+    int me_;
+    int n_;
+};
+
+struct CollectiveChunk {
+    int i0;
+    int i1;
+    int i2;
+    int row;
+    int col;
+    int rows;
+    int cols;
+};
+
+// Splits the tensor shape into tile-sized (rows x cols) chunks in a fixed order so every rank agrees on chunk ids.
+// A dynamic valid dimension is chunked by the tile's full extent: its current value is whatever the last chunk of a
+// previous collective left behind, which differs between ranks.
+class CollectiveChunks {
+public:
+    template <typename GlobalData, typename TileData>
+    CollectiveChunks(GlobalData &ref, TileData &tile)
+        : s1_(ref.GetShape(GlobalTensorDim::DIM_1)), s2_(ref.GetShape(GlobalTensorDim::DIM_2)),
+          s3_(ref.GetShape(GlobalTensorDim::DIM_3)), s4_(ref.GetShape(GlobalTensorDim::DIM_4)),
+          tileRows_(TileData::ValidRow == DYNAMIC ? TileData::Rows : tile.GetValidRow()),
+          tileCols_(TileData::ValidCol == DYNAMIC ? TileData::Cols : tile.GetValidCol())
+    {
+        PTO_ASSERT(tileRows_ > 0 && tileCols_ > 0, "collective: tile valid shape must be positive");
+        if constexpr (TileData::ValidRow != DYNAMIC) {
+            PTO_ASSERT(s3_ % tileRows_ == 0, "collective: shape3 must be divisible by a static tile ValidRow");
+        }
+        if constexpr (TileData::ValidCol != DYNAMIC) {
+            PTO_ASSERT(s4_ % tileCols_ == 0, "collective: shape4 must be divisible by a static tile ValidCol");
+        }
+        rowChunks_ = (s3_ + tileRows_ - 1) / tileRows_;
+        colChunks_ = (s4_ + tileCols_ - 1) / tileCols_;
+        const int64_t planes = static_cast<int64_t>(ref.GetShape(GlobalTensorDim::DIM_0)) * s1_ * s2_;
+        count_ = planes * rowChunks_ * colChunks_;
+    }
+
+    int64_t Count() const
+    {
+        return count_;
+    }
+
+    // Chunks [Begin(k), Begin(k + 1)) form segment k of n near-equal segments.
+    int64_t SegmentBegin(int k, int n) const
+    {
+        return count_ * k / n;
+    }
+
+    CollectiveChunk operator[](int64_t idx) const
+    {
+        CollectiveChunk c;
+        const int colChunk = static_cast<int>(idx % colChunks_);
+        idx /= colChunks_;
+        const int rowChunk = static_cast<int>(idx % rowChunks_);
+        idx /= rowChunks_;
+        c.i2 = static_cast<int>(idx % s2_);
+        idx /= s2_;
+        c.i1 = static_cast<int>(idx % s1_);
+        c.i0 = static_cast<int>(idx / s1_);
+        c.row = rowChunk * tileRows_;
+        c.col = colChunk * tileCols_;
+        c.rows = c.row + tileRows_ <= s3_ ? tileRows_ : s3_ - c.row;
+        c.cols = c.col + tileCols_ <= s4_ ? tileCols_ : s4_ - c.col;
+        return c;
+    }
+
+private:
+    int s1_;
+    int s2_;
+    int s3_;
+    int s4_;
+    int tileRows_;
+    int tileCols_;
+    int rowChunks_ = 0;
+    int colChunks_ = 0;
+    int64_t count_ = 0;
+};
+
+template <typename GlobalData>
+PTO_INTERNAL auto CollectiveChunkView(GlobalData &tensor, const CollectiveChunk &c)
+{
+    using T = typename GlobalData::RawDType;
+    using DynShape = Shape<1, 1, 1, DYNAMIC, DYNAMIC>;
+    using DynStride = Stride<DYNAMIC, DYNAMIC, DYNAMIC, DYNAMIC, DYNAMIC>;
+    using ViewT = GlobalTensor<T, DynShape, DynStride, GlobalData::layout>;
+    const int64_t st0 = tensor.GetStride(GlobalTensorDim::DIM_0);
+    const int64_t st1 = tensor.GetStride(GlobalTensorDim::DIM_1);
+    const int64_t st2 = tensor.GetStride(GlobalTensorDim::DIM_2);
+    const int64_t st3 = tensor.GetStride(GlobalTensorDim::DIM_3);
+    const int64_t st4 = tensor.GetStride(GlobalTensorDim::DIM_4);
+    const int64_t offset = c.i0 * st0 + c.i1 * st1 + c.i2 * st2 + c.row * st3 + c.col * st4;
+    return ViewT(tensor.data() + offset, DynShape(1, 1, 1, c.rows, c.cols), DynStride(st0, st1, st2, st3, st4));
+}
+
+template <typename TileData, typename GlobalData>
+PTO_INTERNAL void LoadChunk(TileData &tile, GlobalData &tensor, const CollectiveChunk &c)
+{
+    if constexpr (TileData::ValidRow == DYNAMIC) {
+        tile.RowMaskInternal = c.rows;
+    }
+    if constexpr (TileData::ValidCol == DYNAMIC) {
+        tile.ColMaskInternal = c.cols;
+    }
+    auto view = CollectiveChunkView(tensor, c);
+    TLOAD(tile, view);
+}
+
+template <typename GlobalData, typename TileData>
+PTO_INTERNAL void StoreChunk(GlobalData &tensor, const CollectiveChunk &c, TileData &tile)
+{
+    auto view = CollectiveChunkView(tensor, c);
+    TSTORE(view, tile);
+}
+
+template <typename DstData, typename SrcData, typename TileData>
+PTO_INTERNAL void CopyChunk(DstData &dst, SrcData &src, const CollectiveChunk &c, TileData &tile)
+{
+    if (static_cast<const void *>(dst.data()) == static_cast<const void *>(src.data())) {
+        return;
+    }
+    LoadChunk(tile, src, c);
+    StoreChunk(dst, c, tile);
+}
+
+// Binomial tree over ranks relative to root: the parent of v clears its highest set bit, the children of v are
+// v + 2^k for every 2^k above v.
+PTO_INTERNAL int TreeRelative(int rank, int root, int n)
+{
+    return (rank - root + n) % n;
+}
+
+PTO_INTERNAL int TreeAbsolute(int relative, int root, int n)
+{
+    return (relative + root) % n;
+}
+
+PTO_INTERNAL int TreeParent(int relative)
+{
+    int high = 1;
+    while (high * 2 <= relative) {
+        high *= 2;
+    }
+    return relative - high;
+}
+
+PTO_INTERNAL int TreeFirstChildBit(int relative)
+{
+    int bit = 1;
+    while (bit <= relative) {
+        bit *= 2;
+    }
+    return bit;
+}
+
+PTO_INTERNAL bool TreeHasChildren(int relative, int n)
+{
+    return relative + TreeFirstChildBit(relative) < n;
+}
+} // namespace detail
+} // namespace comm
+} // namespace pto
+
+#endif
@@ -0,0 +1,289 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_COMM_RANKS_HPP
+#define PTO_CPU_COMM_RANKS_HPP
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/cpu/parallel.hpp"
+#include "pto/cpu/comm/signal.hpp"
+
+// Multi-rank runtime for the CPU simulator. LaunchRanks runs one copy of a kernel per rank, either as threads or as
+// forked processes, over a POSIX shared-memory heap. Each rank owns a symmetric GM window: a buffer allocated at
+// some offset of one window lives at the same offset of every peer's window, so ParallelGroup tensors and TPUT/TGET
+// targets are built by translating a local pointer with RankContext::Peer.
+namespace pto::cpu {
+enum class RankMode
+{
+    Thread,
+    Process,
+};
+
+namespace detail {
+constexpr std::size_t RANK_HEAP_ALIGN = 64;
+constexpr std::size_t RANK_HEADER_BYTES = 4096;
+
+struct RankHeapHeader {
+    alignas(RANK_HEAP_ALIGN) int32_t arrived;
+    alignas(RANK_HEAP_ALIGN) int32_t generation;
+    alignas(RANK_HEAP_ALIGN) int32_t aborted; // set by a failing rank; waits in its peers then throw
+};
+
+constexpr std::size_t AlignUp(std::size_t v, std::size_t a)
+{
+    return (v + a - 1) / a * a;
+}
+
+// Maps header + nranks windows from a POSIX shared-memory object. The name is unlinked right away; forked ranks
+// inherit the mapping at the same address, which keeps peer pointers valid in every rank.
+class RankHeap {
+public:
+    RankHeap(int nranks, std::size_t windowBytes)
+        : windowBytes_(AlignUp(windowBytes, RANK_HEAP_ALIGN)),
+          bytes_(RANK_HEADER_BYTES + windowBytes_ * static_cast<std::size_t>(nranks))
+    {
+        static std::atomic<uint32_t> serial{0};
+        const std::string name = "/pto_cpu_ranks_" + std::to_string(getpid()) + "_" + std::to_string(serial++);
+        const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::runtime_error("LaunchRanks: shm_open failed");
+        }
+        shm_unlink(name.c_str());
+        void *base = MAP_FAILED;
+        if (ftruncate(fd, static_cast<off_t>(bytes_)) == 0) {
+            base = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (base == MAP_FAILED) {
+            throw std::runtime_error("LaunchRanks: cannot map the shared heap");
+        }
+        base_ = static_cast<uint8_t *>(base);
+    }
+
+    ~RankHeap()
+    {
+        munmap(base_, bytes_);
+    }
+
+    RankHeap(const RankHeap &) = delete;
+    RankHeap &operator=(const RankHeap &) = delete;
+
+    RankHeapHeader *Header() const
+    {
+        return reinterpret_cast<RankHeapHeader *>(base_);
+    }
+
+    uint8_t *Window(int rank) const
+    {
+        return base_ + RANK_HEADER_BYTES + windowBytes_ * static_cast<std::size_t>(rank);
+    }
+
+    std::size_t WindowBytes() const
+    {
+        return windowBytes_;
+    }
+
+private:
+    std::size_t windowBytes_;
+    std::size_t bytes_;
+    uint8_t *base_ = nullptr;
+};
+} // namespace detail
+
+class RankContext {
+public:
+    RankContext(const detail::RankHeap &heap, int rank, int nranks) : heap_(&heap), rank_(rank), nranks_(nranks) {}
+
+    int Rank() const
+    {
+        return rank_;
+    }
+
+    int Size() const
+    {
+        return nranks_;
+    }
+
+    // Symmetric allocation: every rank must make the same sequence of calls so offsets agree across windows.
+    // Memory starts zeroed.
+    template <typename T>
+    T *Alloc(std::size_t count)
+    {
+        const std::size_t offset = used_;
+        used_ = detail::AlignUp(used_ + count * sizeof(T), detail::RANK_HEAP_ALIGN);
+        if (used_ > heap_->WindowBytes()) {
+            throw std::runtime_error("LaunchRanks: symmetric window exhausted");
+        }
+        return reinterpret_cast<T *>(heap_->Window(rank_) + offset);
+    }
+
+    // The peer's copy of a buffer allocated with Alloc on this rank.
+    template <typename T>
+    T *Peer(T *local, int peer) const
+    {
+        const std::ptrdiff_t offset = reinterpret_cast<uint8_t *>(local) - heap_->Window(rank_);
+        return reinterpret_cast<T *>(heap_->Window(peer) + offset);
+    }
+
+    // Fills tensors[r] with view(Peer(local, r)) for every rank, the layout ParallelGroup expects.
+    template <typename GlobalData, typename T, typename ViewFn>
+    void PeerTensors(GlobalData *tensors, T *local, ViewFn view) const
+    {
+        for (int r = 0; r < nranks_; r++) {
+            tensors[r] = view(Peer(local, r));
+        }
+    }
+
+    // Blocks until every rank has arrived; also orders all GM writes made before it. Throws if a rank has failed.
+    void Barrier()
+    {
+        detail::RankHeapHeader *hdr = heap_->Header();
+        comm::detail::ThrowIfRanksAborted();
+        const int32_t gen = comm::detail::SignalLoad(&hdr->generation);
+        if (comm::detail::SignalFetchAdd(&hdr->arrived, 1) == nranks_ - 1) {
+            comm::detail::SignalStore(&hdr->arrived, 0);
+            comm::detail::SignalFetchAdd(&hdr->generation, 1);
+            return;
+        }
+        while (comm::detail::SignalLoad(&hdr->generation) == gen) {
+            comm::detail::SignalAwaitChange(&hdr->generation, gen);
+        }
+    }
+
+private:
+    const detail::RankHeap *heap_;
+    int rank_;
+    int nranks_;
+    std::size_t used_ = 0;
+};
+
+namespace detail {
+// Runs one rank and returns whether it succeeded. A rank that throws hands its exception to onError and then raises
+// the heap's abort flag, so peers blocked in Barrier or TWAIT stop waiting for it; their own failures come later.
+template <typename Fn, typename OnError>
+bool RunRank(const RankHeap &heap, int rank, int nranks, Fn &fn, OnError onError)
+{
+    InParallelRegion() = true;
+    comm::detail::RankAbortWord() = &heap.Header()->aborted;
+    bool ok = true;
+    try {
+        RankContext ctx(heap, rank, nranks);
+        fn(ctx);
+    } catch (...) {
+        onError(std::current_exception());
+        comm::detail::SignalStore(&heap.Header()->aborted, 1);
+        ok = false;
+    }
+    comm::detail::RankAbortWord() = nullptr;
+    return ok;
+}
+} // namespace detail
+
+// Runs fn(RankContext &) once per rank with windowBytes of symmetric GM each, and returns after all ranks finish.
+// A failing rank stops the others at their next Barrier or TWAIT and is reported by rethrowing its exception
+// (threads) or by a std::runtime_error (processes). In Process mode each rank runs its tile ops inline, since pool
+// threads do not survive fork, and AtomicAdd stores update global memory with lock-free compare-exchange.
+template <typename Fn>
+void LaunchRanks(int nranks, std::size_t windowBytes, RankMode mode, Fn &&fn)
+{
+    detail::RankHeap heap(nranks, windowBytes);
+    if (mode == RankMode::Thread) {
+        ConcurrentWriters().fetch_add(nranks);
+        std::vector<std::thread> threads;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        for (int r = 0; r < nranks; r++) {
+            threads.emplace_back([&, r]() {
+                detail::RunRank(heap, r, nranks, fn, [&](std::exception_ptr e) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = e;
+                    }
+                });
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        ConcurrentWriters().fetch_sub(nranks);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return;
+    }
+
+    std::vector<pid_t> children;
+    for (int r = 0; r < nranks; r++) {
+        const pid_t pid = fork();
+        if (pid < 0) {
+            // The ranks already started would wait forever for the missing one at their first barrier.
+            for (pid_t child : children) {
+                kill(child, SIGKILL);
+            }
+            break;
+        }
+        if (pid == 0) {
+            GlobalMemoryCrossProcess() = true;
+            _exit(detail::RunRank(heap, r, nranks, fn, [](std::exception_ptr) {}) ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    // Reap children as they exit. Once one fails (or crashes without raising the abort flag) the rest are killed:
+    // they may be blocked on it or spinning on data it will never produce.
+    bool ok = children.size() == static_cast<std::size_t>(nranks);
+    std::vector<pid_t> running = children;
+    while (!running.empty()) {
+        bool reaped = false;
+        for (std::size_t i = 0; i < running.size();) {
+            int status = 0;
+            const pid_t done = waitpid(running[i], &status, ok ? WNOHANG : 0);
+            if (done == 0 || (done < 0 && errno == EINTR)) {
+                i++;
+                continue;
+            }
+            reaped = true;
+            running.erase(running.begin() + static_cast<std::ptrdiff_t>(i));
+            if (ok && !(WIFEXITED(status) && WEXITSTATUS(status) == 0)) {
+                ok = false;
+                comm::detail::SignalStore(&heap.Header()->aborted, 1);
+                for (pid_t pid : running) {
+                    kill(pid, SIGKILL);
+                }
+            }
+        }
+        if (!reaped && ok) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (!ok) {
+        throw std::runtime_error("LaunchRanks: a rank process failed");
+    }
+}
+} // namespace pto::cpu
+
+#endif
@@ -0,0 +1,118 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_COMM_SIGNAL_HPP
+#define PTO_CPU_COMM_SIGNAL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Signal words shared by TNOTIFY, TWAIT and TTEST. Every access is atomic, and parking uses a shared (not
+// process-private) futex on the word itself, so notifier and waiter may be threads of one process or processes
+// mapping the same memory.
+namespace pto::comm::detail {
+inline std::atomic_ref<int32_t> SignalWord(int32_t *addr)
+{
+    return std::atomic_ref<int32_t>(*addr);
+}
+
+inline int32_t SignalLoad(int32_t *addr)
+{
+    return SignalWord(addr).load(std::memory_order_acquire);
+}
+
+// Wakes every thread parked on addr.
+inline void SignalWake(int32_t *addr)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)addr;
+#endif
+}
+
+// Blocks while *addr still holds seen, for at most timeout. Spurious returns are allowed; callers re-check.
+inline void SignalPark(int32_t *addr, int32_t seen, std::chrono::microseconds timeout)
+{
+#if defined(__linux__)
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+    ts.tv_nsec = static_cast<long>(timeout.count() % 1000000) * 1000;
+    syscall(SYS_futex, addr, FUTEX_WAIT, seen, &ts, nullptr, 0);
+#else
+    if (SignalLoad(addr) == seen) {
+        std::this_thread::sleep_for(timeout);
+    }
+#endif
+}
+
+// Abort word of the multi-rank launch the calling thread runs a rank of, or null. A failing rank sets it so that
+// peers blocked in a wait give up instead of waiting forever for it.
+inline int32_t *&RankAbortWord()
+{
+    thread_local int32_t *word = nullptr;
+    return word;
+}
+
+inline void ThrowIfRanksAborted()
+{
+    int32_t *word = RankAbortWord();
+    if (word != nullptr && SignalLoad(word) != 0) {
+        throw std::runtime_error("LaunchRanks: a peer rank failed");
+    }
+}
+
+// Waits until *addr differs from seen, spinning first and then parking once for a bounded time. Returns whether the
+// value changed. Plain stores from writers that bypass TNOTIFY (and so wake nobody) are noticed within one timeout,
+// and so is a failed peer rank, which makes the wait throw.
+inline bool SignalAwaitChange(int32_t *addr, int32_t seen)
+{
+    constexpr int kSpinRounds = 2000;
+    constexpr std::chrono::microseconds kParkTimeout(1000);
+    ThrowIfRanksAborted();
+    for (int i = 0; i < kSpinRounds; i++) {
+        if (SignalLoad(addr) != seen) {
+            return true;
+        }
+        if (i % 64 == 63) {
+            std::this_thread::yield();
+        }
+    }
+    SignalPark(addr, seen, kParkTimeout);
+    ThrowIfRanksAborted();
+    return SignalLoad(addr) != seen;
+}
+
+inline int32_t SignalFetchAdd(int32_t *addr, int32_t value)
+{
+    const int32_t old = SignalWord(addr).fetch_add(value, std::memory_order_acq_rel);
+    SignalWake(addr);
+    return old;
+}
+
+inline void SignalStore(int32_t *addr, int32_t value)
+{
+    SignalWord(addr).store(value, std::memory_order_release);
+    SignalWake(addr);
+}
+} // namespace pto::comm::detail
+
+#endif
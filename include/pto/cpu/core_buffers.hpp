@@ -0,0 +1,83 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_CORE_BUFFERS_HPP
+#define PTO_CPU_CORE_BUFFERS_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/common/memory.hpp"
+#include "pto/common/tassign_check.hpp"
+
+// Simulated on-chip buffers of one AI core: UB, L1, L0A, L0B, L0C, the bias table, the fixpipe buffer and the A5
+// scale buffers, one per TileType, sized from buffer_limits.hpp. Each is a zeroed, 64-byte aligned host block
+// allocated on the first TASSIGN into it. TASSIGN turns a tile into a view of the bytes at its address, so tiles
+// assigned to overlapping ranges alias exactly as they do on the device. Every core runs on its own host thread
+// (see pto/cpu/launch.hpp), which owns that core's buffers.
+namespace pto::cpu {
+constexpr std::size_t CORE_BUFFER_ALIGN = 64;
+
+class CoreBuffers {
+public:
+    CoreBuffers() = default;
+    CoreBuffers(const CoreBuffers &) = delete;
+    CoreBuffers &operator=(const CoreBuffers &) = delete;
+
+    // Host address of [addr, addr + bytes) in the Loc buffer. Ranges outside the buffer, or addresses the device
+    // could not use, abort like any other simulator constraint.
+    template <TileType Loc>
+    std::byte *At(std::size_t addr, std::size_t bytes)
+    {
+        using Traits = pto::detail::BufferTraits<Loc>;
+        PTO_CPU_STUB_ASSERT(Traits::capacity > 0 && bytes <= Traits::capacity && addr <= Traits::capacity - bytes);
+        PTO_CPU_STUB_ASSERT(addr % Traits::alignment == 0);
+        std::unique_ptr<std::byte, Release> &buffer = buffers_[static_cast<int>(Loc)];
+        if (!buffer) {
+            void *storage = ::operator new(Traits::capacity, std::align_val_t{CORE_BUFFER_ALIGN});
+            buffer.reset(static_cast<std::byte *>(storage));
+            std::memset(buffer.get(), 0, Traits::capacity);
+        }
+        return buffer.get() + addr;
+    }
+
+private:
+    struct Release {
+        void operator()(std::byte *p) const
+        {
+            ::operator delete(p, std::align_val_t{CORE_BUFFER_ALIGN});
+        }
+    };
+
+    static constexpr int LOCATIONS = static_cast<int>(TileType::ScaleRight) + 1;
+
+    std::unique_ptr<std::byte, Release> buffers_[LOCATIONS];
+};
+
+// Buffers of the core run by the calling host thread.
+inline CoreBuffers &CurrentCoreBuffers()
+{
+    thread_local CoreBuffers buffers;
+    return buffers;
+}
+
+// Where a tile (or conv tile) of type TileData assigned to addr lives on the calling core.
+template <typename TileData>
+PTO_INTERNAL typename TileData::DType *TileAddress(std::size_t addr)
+{
+    std::byte *bytes = CurrentCoreBuffers().At<TileData::Loc>(addr, pto::detail::tile_storage_bytes_v<TileData>);
+    return reinterpret_cast<typename TileData::DType *>(bytes);
+}
+} // namespace pto::cpu
+
+#endif
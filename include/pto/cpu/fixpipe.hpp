@@ -0,0 +1,86 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_FIXPIPE_HPP
+#define PTO_CPU_FIXPIPE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Fixpipe post-processing applied when Acc data leaves L0C (TSTORE to GM, TMOV to Vec/Mat): pre-stage quant
+// scale, pre-stage ReLU and the saturating cast to the destination type.
+namespace pto {
+struct FixpipeQuant {
+    float scale = 1.0f;
+    int32_t offset = 0;
+    bool signedInt8 = true;
+};
+
+// Decodes a QUANT_PRE word: M1 in bits [31:13] (the top 19 bits of an fp32), a signed 9-bit offset in [45:37]
+// and the int8/uint8 output selector in bit 46.
+PTO_INTERNAL FixpipeQuant DecodeQuantPre(uint64_t word)
+{
+    FixpipeQuant quant;
+    const uint32_t m1Bits = static_cast<uint32_t>(word) & 0xFFFFE000u;
+    std::memcpy(&quant.scale, &m1Bits, sizeof(quant.scale));
+    const int32_t offset = static_cast<int32_t>((word >> 37) & 0x1FF);
+    quant.offset = (offset & 0x100) ? offset - 0x200 : offset;
+    quant.signedInt8 = ((word >> 46) & 0x1) != 0;
+    return quant;
+}
+
+template <typename DstT>
+PTO_INTERNAL DstT FixpipeSaturate(float v, const FixpipeQuant &quant)
+{
+    if constexpr (std::is_integral_v<DstT> && sizeof(DstT) == 1) {
+        const float lo = quant.signedInt8 ? -128.0f : 0.0f;
+        const float hi = quant.signedInt8 ? 127.0f : 255.0f;
+        const float t = std::clamp(std::nearbyint(v), -256.0f, 255.0f) + static_cast<float>(quant.offset);
+        return static_cast<DstT>(std::clamp(t, lo, hi));
+    } else if constexpr (std::is_integral_v<DstT>) {
+        const float lo = static_cast<float>(std::numeric_limits<DstT>::lowest());
+        const float hi = static_cast<float>(std::numeric_limits<DstT>::max());
+        return static_cast<DstT>(std::clamp(std::nearbyint(v), lo, hi));
+    } else if constexpr (std::is_same_v<DstT, half>) {
+        constexpr float halfMax = 65504.0f;
+        return static_cast<DstT>(std::clamp(v, -halfMax, halfMax));
+    } else {
+        return static_cast<DstT>(v);
+    }
+}
+
+// One Acc element through the fixpipe. Without a scale, same-type moves stay bit exact.
+template <typename DstT, ReluPreMode reluMode, bool withQuant, typename SrcT>
+PTO_INTERNAL DstT FixpipeConvert(SrcT v, const FixpipeQuant &quant)
+{
+    if constexpr (!withQuant && std::is_same_v<DstT, SrcT>) {
+        if constexpr (reluMode == ReluPreMode::NormalRelu) {
+            return v < SrcT(0) ? SrcT(0) : v;
+        } else {
+            return v;
+        }
+    } else {
+        float f = static_cast<float>(v);
+        if constexpr (withQuant) {
+            f *= quant.scale;
+        }
+        if constexpr (reluMode == ReluPreMode::NormalRelu) {
+            f = std::max(f, 0.0f);
+        }
+        return FixpipeSaturate<DstT>(f, quant);
+    }
+}
+} // namespace pto
+
+#endif
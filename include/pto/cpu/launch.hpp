@@ -0,0 +1,175 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_LAUNCH_HPP
+#define PTO_CPU_LAUNCH_HPP
+
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/common/fifo.hpp"
+#include "pto/cpu/parallel.hpp"
+#include "pto/cpu/pipes.hpp"
+
+// SPMD launcher for the CPU simulator: every logical AI core of a launch runs on its own host thread, and
+// get_block_idx()/get_block_num()/get_subblockid()/get_subblockdim() report that core's identity. With
+// cpu::set_async_pipes(true) each core also runs its instructions on simulated pipes (see pto/cpu/pipes.hpp).
+namespace pto::cpu {
+// Objects the cores of one launch share, such as FIFO channels, one per key and block. The launcher owns them, so
+// every launch starts from fresh state and drops it when it returns.
+class LaunchObjects {
+public:
+    template <typename T>
+    T &Get(const void *key, int64_t blockIdx)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::shared_ptr<void> &object = objects_[{key, blockIdx}];
+        if (!object) {
+            object = std::make_shared<T>();
+        }
+        return *static_cast<T *>(object.get());
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::pair<const void *, int64_t>, std::shared_ptr<void>> objects_;
+};
+
+// Objects of the launch running on this thread; code run outside any launch shares one process-wide set.
+inline LaunchObjects &CurrentLaunchObjects()
+{
+    static LaunchObjects outsideLaunch;
+    LaunchObjects *objects = CurrentCore().objects;
+    return objects != nullptr ? *objects : outsideLaunch;
+}
+
+namespace detail {
+class CoreGroup {
+public:
+    // All cores are counted before any of them starts so none can observe itself running alone.
+    explicit CoreGroup(int64_t coreNum) : coreNum_(coreNum)
+    {
+        ConcurrentWriters().fetch_add(coreNum_);
+    }
+
+    ~CoreGroup()
+    {
+        ConcurrentWriters().fetch_sub(coreNum_);
+    }
+
+    CoreGroup(const CoreGroup &) = delete;
+    CoreGroup &operator=(const CoreGroup &) = delete;
+
+    template <typename Fn>
+    void Spawn(const CoreContext &ctx, Fn &fn)
+    {
+        threads_.emplace_back([this, ctx, &fn]() {
+            CurrentCore() = ctx;
+            CurrentCore().objects = &objects_;
+            // Cores already occupy the host threads; tile ops inside a core run inline.
+            InParallelRegion() = true;
+            try {
+                AsyncPipeScope pipes(async_pipes_enabled());
+                fn();
+                pipes.Finish();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+            }
+        });
+    }
+
+    void Join()
+    {
+        for (auto &t : threads_) {
+            t.join();
+        }
+        threads_.clear();
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    int64_t coreNum_;
+    LaunchObjects objects_;
+    std::vector<std::thread> threads_;
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+template <typename Fn>
+void RunInline(const CoreContext &ctx, Fn &fn)
+{
+    LaunchObjects objects;
+    CoreContext saved = CurrentCore();
+    CurrentCore() = ctx;
+    CurrentCore().objects = &objects;
+    try {
+        AsyncPipeScope pipes(async_pipes_enabled());
+        fn();
+        pipes.Finish();
+    } catch (...) {
+        CurrentCore() = saved;
+        throw;
+    }
+    CurrentCore() = saved;
+}
+} // namespace detail
+
+// Runs fn on blockDim vector cores, equivalent to kernel<<<blockDim, ...>>>(...) on device.
+template <typename Fn>
+void LaunchKernel(uint32_t blockDim, Fn &&fn)
+{
+    if (blockDim <= 1) {
+        detail::RunInline(CoreContext{0, 1, 0, 1, false, 1}, fn);
+        return;
+    }
+    detail::CoreGroup group(blockDim);
+    for (uint32_t b = 0; b < blockDim; b++) {
+        group.Spawn(CoreContext{b, blockDim, 0, 1, false, 1}, fn);
+    }
+    group.Join();
+}
+
+// Runs a mixed Cube/Vec launch: each of the blockDim blocks gets one Cube core running cubeFn and the Vec cores
+// selected by ratio running vecFn. All cores of all blocks run concurrently so they can synchronize through FIFOs.
+template <typename CubeFn, typename VecFn>
+void LaunchMixKernel(uint32_t blockDim, VecCubeRatio ratio, CubeFn &&cubeFn, VecFn &&vecFn)
+{
+    const int64_t vecNum = (ratio == VecCubeRatio::V2C1_VECS) ? 2 : 1;
+    const int64_t firstVec = (ratio == VecCubeRatio::V1C1_VEC1) ? 1 : 0;
+    const uint8_t vecMask = static_cast<uint8_t>(((1u << vecNum) - 1u) << firstVec);
+    detail::CoreGroup group(static_cast<int64_t>(blockDim) * (1 + vecNum));
+    for (uint32_t b = 0; b < blockDim; b++) {
+        group.Spawn(CoreContext{b, blockDim, 0, 1, true, vecMask}, cubeFn);
+        for (int64_t v = 0; v < vecNum; v++) {
+            group.Spawn(CoreContext{b, blockDim, firstVec + v, vecNum, false, vecMask}, vecFn);
+        }
+    }
+    group.Join();
+}
+
+inline bool IsCubeCore()
+{
+    return CurrentCore().isCube;
+}
+} // namespace pto::cpu
+
+#endif
@@ -0,0 +1,165 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_MX_FORMATS_HPP
+#define PTO_CPU_MX_FORMATS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Decoding of the MX (microscaling) element formats. Every format has at most 256 codes, so each one decodes through
+// a float table built at compile time; a block of 32 elements along K shares one e8m0 power-of-two scale.
+namespace pto {
+constexpr std::size_t MX_SCALE_BLOCK = 32;
+
+constexpr float MxPow2(int e)
+{
+    float v = 1.0f;
+    for (; e > 0; --e) {
+        v *= 2.0f;
+    }
+    for (; e < 0; ++e) {
+        v *= 0.5f;
+    }
+    return v;
+}
+
+// Sign, expBits exponent bits and manBits mantissa bits with the given bias; subnormals when the exponent is 0.
+// Codes of an all-ones exponent are left to the caller, which knows whether the format has infinities.
+constexpr float MxDecodeMinifloat(uint32_t code, int expBits, int manBits, int bias)
+{
+    const uint32_t man = code & ((1u << manBits) - 1);
+    const int exp = static_cast<int>((code >> manBits) & ((1u << expBits) - 1));
+    const float sign = (code >> (expBits + manBits)) & 1u ? -1.0f : 1.0f;
+    const float scale = MxPow2(-manBits);
+    if (exp == 0) {
+        return sign * static_cast<float>(man) * scale * MxPow2(1 - bias);
+    }
+    return sign * (1.0f + static_cast<float>(man) * scale) * MxPow2(exp - bias);
+}
+
+// e4m3fn: no infinities, S.1111.111 is NaN, largest finite value 448.
+constexpr float MxDecodeE4M3(uint32_t code)
+{
+    return (code & 0x7Fu) == 0x7Fu ? std::numeric_limits<float>::quiet_NaN() : MxDecodeMinifloat(code, 4, 3, 7);
+}
+
+// e5m2: IEEE-style infinities and NaNs.
+constexpr float MxDecodeE5M2(uint32_t code)
+{
+    if ((code & 0x7Cu) == 0x7Cu) {
+        return (code & 0x3u) != 0 ? std::numeric_limits<float>::quiet_NaN() :
+                                    ((code & 0x80u) ? -std::numeric_limits<float>::infinity() :
+                                                      std::numeric_limits<float>::infinity());
+    }
+    return MxDecodeMinifloat(code, 5, 2, 15);
+}
+
+// e2m1: +-{0, 0.5, 1, 1.5, 2, 3, 4, 6}.
+constexpr float MxDecodeE2M1(uint32_t code)
+{
+    return MxDecodeMinifloat(code, 2, 1, 1);
+}
+
+// e1m2: +-{0, 0.25, 0.5, 0.75, 1, 1.25, 1.5, 1.75}.
+constexpr float MxDecodeE1M2(uint32_t code)
+{
+    return MxDecodeMinifloat(code, 1, 2, 1);
+}
+
+// e8m0 scale: 2^(code - 127), 0xFF is NaN.
+constexpr float MxDecodeE8M0(uint32_t code)
+{
+    return code == 0xFFu ? std::numeric_limits<float>::quiet_NaN() : MxPow2(static_cast<int>(code) - 127);
+}
+
+template <std::size_t N>
+constexpr std::array<float, N> MakeMxTable(float (*decode)(uint32_t))
+{
+    std::array<float, N> table{};
+    for (std::size_t i = 0; i < N; ++i) {
+        table[i] = decode(static_cast<uint32_t>(i));
+    }
+    return table;
+}
+
+// Per-format decode: elementsPerByte codes of 8 / elementsPerByte bits share one byte.
+template <typename T>
+struct MxFormat;
+
+template <>
+struct MxFormat<float8_e4m3_t> {
+    static constexpr std::size_t elementsPerByte = 1;
+    static constexpr std::array<float, 256> table = MakeMxTable<256>(MxDecodeE4M3);
+};
+
+template <>
+struct MxFormat<float8_e5m2_t> {
+    static constexpr std::size_t elementsPerByte = 1;
+    static constexpr std::array<float, 256> table = MakeMxTable<256>(MxDecodeE5M2);
+};
+
+template <>
+struct MxFormat<float8_e8m0_t> {
+    static constexpr std::size_t elementsPerByte = 1;
+    static constexpr std::array<float, 256> table = MakeMxTable<256>(MxDecodeE8M0);
+};
+
+template <>
+struct MxFormat<float4_e2m1x2_t> {
+    static constexpr std::size_t elementsPerByte = 2;
+    static constexpr std::array<float, 16> table = MakeMxTable<16>(MxDecodeE2M1);
+};
+
+template <>
+struct MxFormat<float4_e1m2x2_t> {
+    static constexpr std::size_t elementsPerByte = 2;
+    static constexpr std::array<float, 16> table = MakeMxTable<16>(MxDecodeE1M2);
+};
+
+// Code of the float4 element at nibble offset `offset`: byte offset / 2, the low nibble for an even offset.
+template <typename T>
+PTO_INTERNAL uint32_t MxNibble(const T *base, std::size_t offset)
+{
+    const unsigned char byte = base[offset / 2].bits;
+    return (offset & 1) ? byte >> 4 : byte & 0xFu;
+}
+
+// Overwrites one nibble and keeps the other element of the byte.
+template <typename T>
+PTO_INTERNAL void MxSetNibble(T *base, std::size_t offset, uint32_t code)
+{
+    unsigned char &byte = base[offset / 2].bits;
+    byte = (offset & 1) ? static_cast<unsigned char>((byte & 0x0Fu) | ((code & 0xFu) << 4)) :
+                          static_cast<unsigned char>((byte & 0xF0u) | (code & 0xFu));
+}
+
+// Value of the element at tile offset `offset`, which for float4 formats counts nibbles.
+template <typename T>
+PTO_INTERNAL float MxDecode(const T *base, std::size_t offset)
+{
+    if constexpr (MxFormat<T>::elementsPerByte == 1) {
+        return MxFormat<T>::table[base[offset].bits];
+    } else {
+        return MxFormat<T>::table[MxNibble(base, offset)];
+    }
+}
+
+template <typename T>
+constexpr bool IsMxFp8 = std::is_same_v<T, float8_e4m3_t> || std::is_same_v<T, float8_e5m2_t>;
+
+template <typename T>
+constexpr bool IsMxFp4 = std::is_same_v<T, float4_e2m1x2_t> || std::is_same_v<T, float4_e1m2x2_t>;
+} // namespace pto
+
+#endif
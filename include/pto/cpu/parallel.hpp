@@ -12,9 +12,21 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define PTO_CPU_PARALLEL_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <thread>
 #include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 // Tuning knobs (can be overridden via compile definitions).
 #ifndef PTO_CPU_PARALLEL_THRESHOLD_ELEMS
@@ -25,6 +37,11 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #define PTO_CPU_MAX_THREADS 0u
 #endif
 
+// Chunks handed out per participating thread; the surplus is what idle workers steal.
+#ifndef PTO_CPU_CHUNKS_PER_THREAD
+#define PTO_CPU_CHUNKS_PER_THREAD 4u
+#endif
+
 // Vectorization hints (portable fallbacks).
 #if defined(__clang__)
 #define PTO_CPU_PRAGMA(X) _Pragma(#X)
@@ -38,9 +55,46 @@ See LICENSE in the root of the software repository for the full text of the Lice
 
 namespace pto::cpu {
 
+namespace detail {
+inline unsigned ReadEnvUnsigned(const char *name, unsigned fallback) noexcept
+{
+    const char *value = std::getenv(name);
+    if (value == nullptr || *value == '\0') {
+        return fallback;
+    }
+    char *end = nullptr;
+    const unsigned long parsed = std::strtoul(value, &end, 10);
+    return (end != nullptr && *end == '\0') ? static_cast<unsigned>(parsed) : fallback;
+}
+
+// Runtime thread-count override, 0 means "use hardware_concurrency". Seeded from PTO_CPU_NUM_THREADS.
+inline std::atomic<unsigned> &ThreadCountOverride() noexcept
+{
+    static std::atomic<unsigned> value{ReadEnvUnsigned("PTO_CPU_NUM_THREADS", 0u)};
+    return value;
+}
+
+// Pin pool workers to consecutive cores. Seeded from PTO_CPU_THREAD_AFFINITY.
+inline std::atomic<bool> &ThreadAffinityEnabled() noexcept
+{
+    static std::atomic<bool> value{ReadEnvUnsigned("PTO_CPU_THREAD_AFFINITY", 0u) != 0u};
+    return value;
+}
+
+// Set while a thread executes a parallel_for body; nested parallel regions then run inline.
+inline bool &InParallelRegion() noexcept
+{
+    thread_local bool value = false;
+    return value;
+}
+} // namespace detail
+
 inline unsigned get_thread_count() noexcept
 {
-    unsigned hw = std::thread::hardware_concurrency();
+    unsigned hw = detail::ThreadCountOverride().load(std::memory_order_relaxed);
+    if (hw == 0) {
+        hw = std::thread::hardware_concurrency();
+    }
     if (hw == 0) {
         hw = 1;
     }
@@ -50,6 +104,259 @@ inline unsigned get_thread_count() noexcept
     return std::max<unsigned>(1, hw);
 }
 
+namespace detail {
+struct ParallelJob {
+    void (*invoke)(void *ctx, std::size_t begin, std::size_t end) = nullptr;
+    void *ctx = nullptr;
+    std::size_t pending = 0; // guarded by doneMutex
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+    std::exception_ptr error;
+};
+
+struct ParallelTask {
+    ParallelJob *job;
+    std::size_t begin;
+    std::size_t end;
+};
+
+// Process-wide pool of get_thread_count() - 1 workers; the submitting thread is the remaining participant.
+// Each worker owns a deque: it pops its own tasks LIFO and steals from the other deques FIFO when empty.
+class WorkStealingPool {
+public:
+    static WorkStealingPool &Instance()
+    {
+        static WorkStealingPool pool;
+        return pool;
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    ~WorkStealingPool()
+    {
+        Shutdown();
+    }
+
+    void Shutdown()
+    {
+        std::unique_lock<std::shared_mutex> config(configMutex_);
+        StopWorkers();
+    }
+
+    // Splits [begin, end) into `chunks` ranges, runs them on the pool and blocks until all have finished.
+    void Run(ParallelJob &job, std::size_t begin, std::size_t end, std::size_t chunks)
+    {
+        std::shared_lock<std::shared_mutex> config = AcquireConfigured();
+        const std::size_t count = end - begin;
+        const std::size_t chunk = (count + chunks - 1) / chunks;
+        const std::size_t queueNum = queues_.size();
+
+        job.pending = (count + chunk - 1) / chunk;
+        std::size_t next = 0;
+        for (std::size_t b = begin + chunk; b < end; b += chunk) {
+            WorkerQueue &queue = *queues_[next];
+            next = (next + 1) % queueNum;
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back({&job, b, std::min(end, b + chunk)});
+            queued_.fetch_add(1, std::memory_order_release);
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+        }
+        wake_.notify_all();
+
+        Execute({&job, begin, std::min(end, begin + chunk)});
+        ParallelTask task;
+        while (!IsDone(job) && Steal(queueNum, task)) {
+            Execute(task);
+        }
+        std::unique_lock<std::mutex> lock(job.doneMutex);
+        job.doneCv.wait(lock, [&job]() { return job.pending == 0; });
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<ParallelTask> tasks;
+    };
+
+    WorkStealingPool() = default;
+
+    // Returns a shared configuration lock once the pool matches the requested thread count and affinity.
+    std::shared_lock<std::shared_mutex> AcquireConfigured()
+    {
+        for (;;) {
+            std::shared_lock<std::shared_mutex> config(configMutex_);
+            if (IsConfigured()) {
+                return config;
+            }
+            config.unlock();
+            std::unique_lock<std::shared_mutex> exclusive(configMutex_);
+            if (!IsConfigured()) {
+                StopWorkers();
+                StartWorkers(get_thread_count() - 1, ThreadAffinityEnabled().load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+    bool IsConfigured() const
+    {
+        return !queues_.empty() && workers_.size() == get_thread_count() - 1 &&
+               affinity_ == ThreadAffinityEnabled().load(std::memory_order_relaxed);
+    }
+
+    void StartWorkers(unsigned workerNum, bool affinity)
+    {
+        stop_ = false;
+        affinity_ = affinity;
+        // Keep at least one queue so a single-threaded pool still has somewhere to put tasks.
+        const unsigned queueNum = std::max(1u, workerNum);
+        for (unsigned i = 0; i < queueNum; ++i) {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (unsigned i = 0; i < workerNum; ++i) {
+            workers_.emplace_back([this, i]() { WorkerLoop(i); });
+            if (affinity) {
+                PinToCore(workers_.back(), i + 1);
+            }
+        }
+    }
+
+    void StopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+        queues_.clear();
+        queued_.store(0, std::memory_order_relaxed);
+    }
+
+    static void PinToCore(std::thread &thread, unsigned core)
+    {
+#if defined(__linux__)
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core % hw, &set);
+        (void)pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+        (void)thread;
+        (void)core;
+#endif
+    }
+
+    void WorkerLoop(unsigned self)
+    {
+        InParallelRegion() = true;
+        const std::size_t queueNum = queues_.size();
+        for (;;) {
+            ParallelTask task;
+            if (PopLocal(self, task) || Steal(queueNum, task, self + 1)) {
+                Execute(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wake_.wait(lock, [this]() { return stop_ || queued_.load(std::memory_order_acquire) > 0; });
+            if (stop_ && queued_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    bool PopLocal(unsigned self, ParallelTask &task)
+    {
+        WorkerQueue &queue = *queues_[self];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+        queued_.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    bool Steal(std::size_t queueNum, ParallelTask &task, std::size_t start = 0)
+    {
+        for (std::size_t n = 0; n < queueNum; ++n) {
+            WorkerQueue &queue = *queues_[(start + n) % queueNum];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+                queued_.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool IsDone(ParallelJob &job)
+    {
+        std::lock_guard<std::mutex> lock(job.doneMutex);
+        return job.pending == 0;
+    }
+
+    static void Execute(const ParallelTask &task)
+    {
+        ParallelJob &job = *task.job;
+        const bool nested = InParallelRegion();
+        InParallelRegion() = true;
+        std::exception_ptr error;
+        try {
+            job.invoke(job.ctx, task.begin, task.end);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        InParallelRegion() = nested;
+
+        std::lock_guard<std::mutex> lock(job.doneMutex);
+        if (error && !job.error) {
+            job.error = error;
+        }
+        if (--job.pending == 0) {
+            job.doneCv.notify_all();
+        }
+    }
+
+    std::shared_mutex configMutex_;
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    bool affinity_ = false;
+
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    std::atomic<std::size_t> queued_{0};
+    bool stop_ = false;
+};
+} // namespace detail
+
+// Override the number of threads used by parallel_for_1d at runtime (0 restores the hardware default).
+// The pool picks up the new size on the next parallel region.
+inline void set_thread_count(unsigned threads) noexcept
+{
+    detail::ThreadCountOverride().store(threads, std::memory_order_relaxed);
+}
+
+// Pin pool worker i to core i + 1 (Linux only; ignored elsewhere). Applied on the next parallel region.
+inline void set_thread_affinity(bool enable) noexcept
+{
+    detail::ThreadAffinityEnabled().store(enable, std::memory_order_relaxed);
+}
+
+// Join all pool workers. The pool is restarted lazily by the next parallel region.
+inline void shutdown_thread_pool()
+{
+    detail::WorkStealingPool::Instance().Shutdown();
+}
+
 template <typename Fn>
 inline void parallel_for_1d(std::size_t begin, std::size_t end, std::size_t total_work_elems, Fn fn)
 {
@@ -59,7 +366,8 @@ inline void parallel_for_1d(std::size_t begin, std::size_t end, std::size_t tota
         return;
     }
 
-    if (total_work_elems < static_cast<std::size_t>(PTO_CPU_PARALLEL_THRESHOLD_ELEMS) || count < SIZE_TWO) {
+    if (total_work_elems < static_cast<std::size_t>(PTO_CPU_PARALLEL_THRESHOLD_ELEMS) || count < SIZE_TWO ||
+        detail::InParallelRegion()) {
         for (std::size_t i = begin; i < end; ++i) {
             fn(i);
         }
@@ -74,23 +382,19 @@ inline void parallel_for_1d(std::size_t begin, std::size_t end, std::size_t tota
         return;
     }
 
-    const std::size_t chunk = (count + threads - 1) / threads;
-    std::vector<std::thread> workers;
-    workers.reserve(threads);
-    for (unsigned t = 0; t < threads; ++t) {
-        const std::size_t b = begin + static_cast<std::size_t>(t) * chunk;
-        const std::size_t e = std::min(end, b + chunk);
-        if (b >= e) {
-            break;
+    detail::ParallelJob job;
+    job.ctx = &fn;
+    job.invoke = [](void *ctx, std::size_t b, std::size_t e) {
+        Fn &body = *static_cast<Fn *>(ctx);
+        for (std::size_t i = b; i < e; ++i) {
+            body(i);
         }
-        workers.emplace_back([&, b, e]() {
-            for (std::size_t i = b; i < e; ++i) {
-                fn(i);
-            }
-        });
-    }
-    for (auto &w : workers) {
-        w.join();
+    };
+    const std::size_t chunks = std::min<std::size_t>(count, static_cast<std::size_t>(threads) *
+                                                                PTO_CPU_CHUNKS_PER_THREAD);
+    detail::WorkStealingPool::Instance().Run(job, begin, end, chunks);
+    if (job.error) {
+        std::rethrow_exception(job.error);
     }
 }
 
@@ -0,0 +1,488 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_PIPES_HPP
+#define PTO_CPU_PIPES_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/common/event.hpp"
+#include "pto/common/pto_tile.hpp"
+#include "pto/cpu/parallel.hpp"
+#include "pto/cpu/profile.hpp"
+#include "pto/cpu/timeline.hpp"
+
+// Opt-in asynchronous pipe execution for the CPU simulator.
+//
+// Inside an AsyncPipeScope every instruction issued through MAP_INSTR_IMPL is queued on a host worker standing in
+// for its hardware pipe (MTE2 loads, V vector ops, MTE1 L1->L0 moves, M cube, FIX Acc moves, MTE3 stores). Pipes
+// run in order; across pipes only set_flag/wait_flag, pipe_barrier(PIPE_ALL) and RecordEvent tokens order the
+// work, exactly as on the device. Kernels that rely on program order without flags keep working outside a scope.
+// The mode is enabled per launch with cpu::set_async_pipes(true) or PTO_CPU_ASYNC_PIPES=1.
+namespace pto::cpu {
+namespace detail {
+class PipeWorker {
+public:
+    PipeWorker(const CoreContext &core, bool inParallelRegion)
+        : thread_([this, core, inParallelRegion]() { Loop(core, inParallelRegion); })
+    {}
+
+    ~PipeWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+
+    PipeWorker(const PipeWorker &) = delete;
+    PipeWorker &operator=(const PipeWorker &) = delete;
+
+    uint64_t Enqueue(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+        return ++issued_;
+    }
+
+    void WaitFor(uint64_t seq)
+    {
+        uint64_t done = completed_.load(std::memory_order_acquire);
+        while (done < seq) {
+            completed_.wait(done, std::memory_order_acquire);
+            done = completed_.load(std::memory_order_acquire);
+        }
+    }
+
+    void Quiesce()
+    {
+        WaitFor(issued_);
+    }
+
+    void Drain()
+    {
+        WaitFor(issued_);
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    void Loop(const CoreContext &core, bool inParallelRegion)
+    {
+        CurrentCore() = core;
+        InParallelRegion() = inParallelRegion;
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            try {
+                task();
+            } catch (...) {
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+            }
+            completed_.fetch_add(1, std::memory_order_release);
+            completed_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    uint64_t issued_ = 0; // only touched by the issuing thread
+    std::atomic<uint64_t> completed_{0};
+    std::exception_ptr error_;
+    std::thread thread_;
+};
+
+class PipeExecutor {
+public:
+    PipeExecutor() = default;
+    PipeExecutor(const PipeExecutor &) = delete;
+    PipeExecutor &operator=(const PipeExecutor &) = delete;
+
+    ~PipeExecutor()
+    {
+        try {
+            DrainAll();
+        } catch (...) {
+        }
+    }
+
+    PipeToken Issue(pipe_t pipe, std::function<void()> task)
+    {
+        auto &worker = Worker(pipe);
+        uint64_t seq = worker->Enqueue(std::move(task));
+        return PipeToken{worker, seq};
+    }
+
+    void SetFlag(pipe_t src, pipe_t dst, event_t id)
+    {
+        std::atomic<uint64_t> *flag = &flags_[Index(src)][Index(dst)][Event(id)];
+        if (IsScalar(src)) {
+            Signal(*flag);
+        } else {
+            Worker(src)->Enqueue([flag]() { Signal(*flag); });
+        }
+    }
+
+    void WaitFlag(pipe_t src, pipe_t dst, event_t id)
+    {
+        std::atomic<uint64_t> *flag = &flags_[Index(src)][Index(dst)][Event(id)];
+        uint64_t target = ++waits_[Index(src)][Index(dst)][Event(id)];
+        if (IsScalar(dst)) {
+            Await(*flag, target);
+        } else {
+            Worker(dst)->Enqueue([flag, target]() { Await(*flag, target); });
+        }
+    }
+
+    void DrainAll()
+    {
+        for (auto &worker : workers_) {
+            if (worker) {
+                worker->Drain();
+            }
+        }
+    }
+
+    // Waits for every queued task without reporting errors; those surface at the next DrainAll.
+    void QuiesceAll()
+    {
+        for (auto &worker : workers_) {
+            if (worker) {
+                worker->Quiesce();
+            }
+        }
+    }
+
+private:
+    static int Index(pipe_t pipe)
+    {
+        return (pipe >= 0 && pipe < PIPE_NUM) ? pipe : PIPE_S;
+    }
+
+    static int Event(event_t id)
+    {
+        return static_cast<int>(id) % EVENT_ID_MAX;
+    }
+
+    static bool IsScalar(pipe_t pipe)
+    {
+        return pipe == PIPE_S || pipe == PIPE_ALL;
+    }
+
+    static void Signal(std::atomic<uint64_t> &flag)
+    {
+        flag.fetch_add(1, std::memory_order_release);
+        flag.notify_all();
+    }
+
+    static void Await(std::atomic<uint64_t> &flag, uint64_t target)
+    {
+        uint64_t value = flag.load(std::memory_order_acquire);
+        while (value < target) {
+            flag.wait(value, std::memory_order_acquire);
+            value = flag.load(std::memory_order_acquire);
+        }
+    }
+
+    std::shared_ptr<PipeWorker> &Worker(pipe_t pipe)
+    {
+        auto &worker = workers_[Index(pipe)];
+        if (!worker) {
+            worker = std::make_shared<PipeWorker>(CurrentCore(), InParallelRegion());
+        }
+        return worker;
+    }
+
+    std::shared_ptr<PipeWorker> workers_[PIPE_NUM];
+    std::atomic<uint64_t> flags_[PIPE_NUM][PIPE_NUM][EVENT_ID_MAX] = {};
+    uint64_t waits_[PIPE_NUM][PIPE_NUM][EVENT_ID_MAX] = {};
+};
+
+inline PipeExecutor *&CurrentExecutor()
+{
+    thread_local PipeExecutor *executor = nullptr;
+    return executor;
+}
+
+inline PipeToken &LastToken()
+{
+    thread_local PipeToken token;
+    return token;
+}
+
+inline std::atomic<bool> &AsyncPipesEnabled()
+{
+    static std::atomic<bool> enabled{[]() {
+        const char *env = std::getenv("PTO_CPU_ASYNC_PIPES");
+        return env != nullptr && env[0] != '\0' && env[0] != '0';
+    }()};
+    return enabled;
+}
+
+template <typename T>
+using PipeArgT = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T>
+constexpr bool IsPipeTileArg = is_tile_data_v<PipeArgT<T>> || is_conv_tile_v<PipeArgT<T>>;
+
+template <typename T>
+constexpr bool IsPipeGlobalArg = is_global_data_v<PipeArgT<T>>;
+
+template <typename T>
+constexpr bool IsPipeValueArg = std::is_arithmetic_v<PipeArgT<T>> || std::is_enum_v<PipeArgT<T>> ||
+                                std::is_pointer_v<PipeArgT<T>> || std::is_null_pointer_v<PipeArgT<T>>;
+
+template <typename T>
+constexpr bool IsTileAt(TileType loc)
+{
+    if constexpr (is_tile_data_v<PipeArgT<T>>) {
+        return PipeArgT<T>::Loc == loc;
+    } else {
+        return false;
+    }
+}
+
+// Tiles are captured by reference (they may own their storage), everything else by value.
+template <typename T>
+using PipeCaptureT = std::conditional_t<IsPipeTileArg<T>, PipeArgT<T> &, PipeArgT<T>>;
+
+// Maps an instruction to the pipe that executes it on the device, from its operand types.
+template <typename First, typename... Rest>
+constexpr pipe_t InstrPipe()
+{
+    constexpr bool anyGlobal = (IsPipeGlobalArg<Rest> || ...);
+    constexpr bool anyAcc = (IsTileAt<Rest>(TileType::Acc) || ...);
+    constexpr bool anyCubeSrc = (IsTileAt<Rest>(TileType::Left) || ...) || (IsTileAt<Rest>(TileType::Right) || ...);
+    constexpr bool anyMat = (IsTileAt<Rest>(TileType::Mat) || ...);
+    if constexpr (IsPipeGlobalArg<First>) {
+        return anyAcc ? PIPE_FIX : PIPE_MTE3;
+    } else if constexpr (anyGlobal) {
+        return PIPE_MTE2;
+    } else if constexpr (anyCubeSrc) {
+        return PIPE_M;
+    } else if constexpr (anyAcc) {
+        return PIPE_FIX;
+    } else if constexpr (IsTileAt<First>(TileType::Left) || IsTileAt<First>(TileType::Right) ||
+                         IsTileAt<First>(TileType::Bias) || IsTileAt<First>(TileType::Scaling) ||
+                         IsTileAt<First>(TileType::ScaleLeft) || IsTileAt<First>(TileType::ScaleRight)) {
+        return PIPE_MTE1;
+    } else if constexpr (IsTileAt<First>(TileType::Mat)) {
+        return anyMat ? PIPE_MTE1 : PIPE_MTE3;
+    } else {
+        return PIPE_V;
+    }
+}
+} // namespace detail
+
+inline void set_async_pipes(bool enable)
+{
+    detail::AsyncPipesEnabled().store(enable, std::memory_order_relaxed);
+}
+
+inline bool async_pipes_enabled()
+{
+    return detail::AsyncPipesEnabled().load(std::memory_order_relaxed);
+}
+
+// Runs the instructions issued by this thread asynchronously on per-pipe workers until Finish, which drains every
+// pipe and rethrows the first error a pipe hit. Nested scopes share the outermost executor. The destructor never
+// throws: a scope left without Finish, typically while the kernel's own exception unwinds, still drains its pipes
+// but drops their errors in favour of that exception.
+class AsyncPipeScope {
+public:
+    AsyncPipeScope() : AsyncPipeScope(true)
+    {}
+
+    explicit AsyncPipeScope(bool enable)
+    {
+        if (enable && detail::CurrentExecutor() == nullptr) {
+            executor_ = std::make_unique<detail::PipeExecutor>();
+            detail::CurrentExecutor() = executor_.get();
+            ConcurrentWriters().fetch_add(PIPE_WRITERS);
+        }
+    }
+
+    ~AsyncPipeScope()
+    {
+        if (executor_) {
+            Close();
+        }
+    }
+
+    void Finish()
+    {
+        if (executor_) {
+            std::exception_ptr error;
+            try {
+                executor_->DrainAll();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            Close();
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    AsyncPipeScope(const AsyncPipeScope &) = delete;
+    AsyncPipeScope &operator=(const AsyncPipeScope &) = delete;
+
+private:
+    // Stops routing instructions to the executor and destroys it, which waits for the queued work and joins the
+    // workers; only then do the pipes stop counting as concurrent writers.
+    void Close() noexcept
+    {
+        detail::CurrentExecutor() = nullptr;
+        detail::LastToken() = PipeToken{};
+        executor_.reset();
+        ConcurrentWriters().fetch_sub(PIPE_WRITERS);
+    }
+
+    // The pipes of one core may store to global memory concurrently with each other.
+    static constexpr int64_t PIPE_WRITERS = detail::PIPE_NUM;
+
+    std::unique_ptr<detail::PipeExecutor> executor_;
+};
+
+inline PipeToken LastPipeToken()
+{
+    return detail::LastToken();
+}
+
+inline void WaitPipeToken(const PipeToken &token)
+{
+    if (token.worker) {
+        token.worker->WaitFor(token.seq);
+    }
+}
+
+inline void PipeSetFlag(pipe_t src, pipe_t dst, event_t id)
+{
+    if (timeline_enabled()) {
+        detail::TimelineSetFlag(src, dst, id);
+    }
+    if (auto *executor = detail::CurrentExecutor()) {
+        executor->SetFlag(src, dst, id);
+    }
+}
+
+inline void PipeWaitFlag(pipe_t src, pipe_t dst, event_t id)
+{
+    if (timeline_enabled()) {
+        detail::TimelineWaitFlag(src, dst, id);
+    }
+    if (auto *executor = detail::CurrentExecutor()) {
+        executor->WaitFlag(src, dst, id);
+    }
+}
+
+// Pipes execute in order, so a barrier on a single pipe is implied; PIPE_ALL drains everything.
+inline void PipeBarrier(pipe_t pipe)
+{
+    if (timeline_enabled()) {
+        detail::TimelineBarrier(pipe);
+    }
+    if (auto *executor = detail::CurrentExecutor(); executor != nullptr && pipe == PIPE_ALL) {
+        executor->DrainAll();
+    }
+}
+
+inline void PipeQuiesce() noexcept
+{
+    if (auto *executor = detail::CurrentExecutor()) {
+        executor->QuiesceAll();
+    }
+}
+
+inline void PipeDrainAll()
+{
+    if (auto *executor = detail::CurrentExecutor()) {
+        executor->DrainAll();
+    }
+}
+
+// Entry point of MAP_INSTR_IMPL on CPU. Runs impl(args...) inline unless an AsyncPipeScope is active, in which
+// case the call is queued on the pipe chosen from the operand types. Operands that are neither tiles, global
+// tensors nor plain values (FIFO handles, sort lists, ...) make the call synchronous after draining all pipes.
+// With profiling enabled the call is recorded under name wherever it runs; with the timeline enabled it is also
+// placed on the issuing core's virtual clock, in program order.
+template <typename RawImpl, typename... Args>
+void IssueInstr(const char *name, RawImpl rawImpl, Args &&... args)
+{
+    constexpr bool queueable =
+        sizeof...(Args) > 0 &&
+        ((detail::IsPipeTileArg<Args> || detail::IsPipeGlobalArg<Args> || detail::IsPipeValueArg<Args>)&&...);
+    if (timeline_enabled()) {
+        if constexpr (queueable) {
+            detail::TimelineInstr(name, detail::InstrPipe<Args...>(), args...);
+        } else {
+            detail::TimelineInstr(name, PIPE_S, args...);
+        }
+    }
+    auto impl = [name, rawImpl](auto &&... implArgs) mutable {
+        detail::TimelineNestGuard nested;
+        if (profiling_enabled()) {
+            detail::RunProfiled(name, rawImpl, std::forward<decltype(implArgs)>(implArgs)...);
+        } else {
+            rawImpl(std::forward<decltype(implArgs)>(implArgs)...);
+        }
+    };
+    detail::PipeExecutor *executor = detail::CurrentExecutor();
+    if (executor == nullptr) {
+        impl(std::forward<Args>(args)...);
+        return;
+    }
+    if constexpr (queueable) {
+        constexpr pipe_t pipe = detail::InstrPipe<Args...>();
+        std::tuple<detail::PipeCaptureT<Args>...> captured(args...);
+        detail::LastToken() = executor->Issue(pipe, [impl, captured]() mutable { std::apply(impl, captured); });
+    } else {
+        executor->DrainAll();
+        detail::LastToken() = PipeToken{};
+        impl(std::forward<Args>(args)...);
+    }
+}
+} // namespace pto::cpu
+
+#endif
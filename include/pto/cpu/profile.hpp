@@ -0,0 +1,374 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_PROFILE_HPP
+#define PTO_CPU_PROFILE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/common/pto_tile.hpp"
+
+// Opt-in instruction profiler for the CPU simulator. While enabled, every instruction issued through
+// MAP_INSTR_IMPL is timed where it runs (the issuing thread, or its pipe worker under AsyncPipeScope) together with
+// its operands and the bytes they cover. Records can be summarised per instruction or written as a Chrome trace
+// (chrome://tracing, ui.perfetto.dev). Enable with cpu::set_profiling(true), or set PTO_CPU_PROFILE=<path> to
+// profile the whole process and write the trace to <path> at exit.
+//
+// Times are inclusive: an instruction implemented with other instructions (the comm collectives, for instance)
+// also records those calls, nested inside its own span.
+namespace pto::cpu {
+struct InstrRecord {
+    const char *name;
+    uint64_t startNs;
+    uint64_t durNs;
+    uint32_t thread;
+    int64_t core;
+    uint64_t bytesRead;
+    uint64_t bytesWritten;
+    std::string operands;
+};
+
+// Per-instruction aggregate. histogram[b] counts calls that took [2^b, 2^(b+1)) ns.
+struct InstrStats {
+    static constexpr int BUCKETS = 40;
+
+    std::string name;
+    uint64_t calls = 0;
+    uint64_t totalNs = 0;
+    uint64_t minNs = UINT64_MAX;
+    uint64_t maxNs = 0;
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+    uint64_t histogram[BUCKETS] = {};
+};
+
+namespace detail {
+inline std::atomic<bool> &ProfilingEnabled()
+{
+    static std::atomic<bool> enabled{[]() {
+        const char *env = std::getenv("PTO_CPU_PROFILE");
+        return env != nullptr && env[0] != '\0' && env[0] != '0';
+    }()};
+    return enabled;
+}
+
+inline uint64_t ProfileClockNs()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+// Records of one thread. The profiler keeps every buffer alive, so records outlive the threads that made them.
+struct ProfileBuffer {
+    std::mutex mutex;
+    std::vector<InstrRecord> records;
+};
+
+class Profiler {
+public:
+    static Profiler &Instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    ProfileBuffer &ThreadBuffer(uint32_t &thread)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        thread = static_cast<uint32_t>(buffers_.size());
+        buffers_.push_back(std::make_shared<ProfileBuffer>());
+        return *buffers_.back();
+    }
+
+    std::vector<InstrRecord> Snapshot()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<InstrRecord> all;
+        for (auto &buffer : buffers_) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            all.insert(all.end(), buffer->records.begin(), buffer->records.end());
+        }
+        std::sort(all.begin(), all.end(),
+                  [](const InstrRecord &a, const InstrRecord &b) { return a.startNs < b.startNs; });
+        return all;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &buffer : buffers_) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            buffer->records.clear();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ProfileBuffer>> buffers_;
+};
+
+struct ThreadProfile {
+    uint32_t thread = 0;
+    ProfileBuffer *buffer = nullptr;
+};
+
+inline ThreadProfile &CurrentThreadProfile()
+{
+    thread_local ThreadProfile profile;
+    if (profile.buffer == nullptr) {
+        profile.buffer = &Profiler::Instance().ThreadBuffer(profile.thread);
+    }
+    return profile;
+}
+
+template <typename T>
+constexpr const char *DTypeName()
+{
+    using U = std::remove_cv_t<T>;
+    if constexpr (std::is_same_v<U, float>) {
+        return "f32";
+    } else if constexpr (std::is_same_v<U, double>) {
+        return "f64";
+    } else if constexpr (std::is_same_v<U, half>) {
+        return "f16";
+#ifdef CPU_SIM_BFLOAT_ENABLED
+    } else if constexpr (std::is_same_v<U, bfloat16_t>) {
+        return "bf16";
+#endif
+    } else if constexpr (std::is_same_v<U, float8_e4m3_t>) {
+        return "e4m3";
+    } else if constexpr (std::is_same_v<U, float8_e5m2_t>) {
+        return "e5m2";
+    } else if constexpr (std::is_same_v<U, float8_e8m0_t>) {
+        return "e8m0";
+    } else if constexpr (std::is_same_v<U, float4_e2m1x2_t>) {
+        return "e2m1x2";
+    } else if constexpr (std::is_same_v<U, float4_e1m2x2_t>) {
+        return "e1m2x2";
+    } else if constexpr (std::is_same_v<U, bool>) {
+        return "bool";
+    } else if constexpr (std::is_integral_v<U>) {
+        constexpr const char *names[2][4] = {{"u8", "u16", "u32", "u64"}, {"s8", "s16", "s32", "s64"}};
+        constexpr int width = sizeof(U) == 1 ? 0 : sizeof(U) == 2 ? 1 : sizeof(U) == 4 ? 2 : 3;
+        return names[std::is_signed_v<U> ? 1 : 0][width];
+    } else {
+        return "other";
+    }
+}
+
+inline const char *TileTypeName(TileType loc)
+{
+    switch (loc) {
+        case TileType::Vec:
+            return "Vec";
+        case TileType::Mat:
+            return "Mat";
+        case TileType::Left:
+            return "Left";
+        case TileType::Right:
+            return "Right";
+        case TileType::Acc:
+            return "Acc";
+        case TileType::Bias:
+            return "Bias";
+        case TileType::Scaling:
+            return "Scaling";
+        default:
+            return "Tile";
+    }
+}
+
+// Appends a description of one operand and returns the bytes it covers: the valid region of a tile, the whole
+// shape of a global tensor, nothing for scalars and handles.
+template <typename T>
+uint64_t DescribeOperand(std::ostringstream &out, const T &arg)
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T>>;
+    if constexpr (is_tile_data_v<U>) {
+        auto &tile = const_cast<U &>(arg);
+        const uint64_t rows = static_cast<uint64_t>(tile.GetValidRow());
+        const uint64_t cols = static_cast<uint64_t>(tile.GetValidCol());
+        out << ' ' << TileTypeName(U::Loc) << ':' << DTypeName<typename U::DType>() << '[' << U::Rows << 'x'
+            << U::Cols << " valid " << rows << 'x' << cols << (U::isRowMajor ? " row" : " col")
+            << (U::SFractal == SLayout::NoneBox ? "" : " boxed") << ']';
+        return rows * cols * sizeof(typename U::DType);
+    } else if constexpr (is_global_data_v<U>) {
+        auto &tensor = const_cast<U &>(arg);
+        uint64_t elems = 1;
+        out << " GM:" << DTypeName<typename U::RawDType>() << '[';
+        for (int d = 0; d < GlobalTensorDim::TOTAL_DIM; d++) {
+            const int64_t extent = tensor.GetShape(d);
+            elems *= static_cast<uint64_t>(extent);
+            out << (d == 0 ? "" : ",") << extent;
+        }
+        out << ']';
+        return elems * sizeof(typename U::RawDType);
+    } else {
+        return 0;
+    }
+}
+
+// The first operand is the destination of every PTO instruction; the others are read.
+template <typename First, typename... Rest>
+void DescribeOperands(InstrRecord &record, const First &first, const Rest &...rest)
+{
+    std::ostringstream out;
+    record.bytesWritten = DescribeOperand(out, first);
+    record.bytesRead = (DescribeOperand(out, rest) + ... + 0);
+    record.operands = out.str();
+}
+
+inline void DescribeOperands(InstrRecord &)
+{}
+} // namespace detail
+
+inline void set_profiling(bool enable)
+{
+    detail::ProfilingEnabled().store(enable, std::memory_order_relaxed);
+}
+
+inline bool profiling_enabled()
+{
+    return detail::ProfilingEnabled().load(std::memory_order_relaxed);
+}
+
+// Drops every record collected so far.
+inline void reset_profile()
+{
+    detail::Profiler::Instance().Clear();
+}
+
+// Every record collected so far, ordered by start time.
+inline std::vector<InstrRecord> profile_records()
+{
+    return detail::Profiler::Instance().Snapshot();
+}
+
+// Per-instruction aggregates, ordered by total time, largest first.
+inline std::vector<InstrStats> profile_summary()
+{
+    std::map<std::string, InstrStats> byName;
+    for (const InstrRecord &r : profile_records()) {
+        InstrStats &s = byName[r.name];
+        s.name = r.name;
+        s.calls++;
+        s.totalNs += r.durNs;
+        s.minNs = std::min(s.minNs, r.durNs);
+        s.maxNs = std::max(s.maxNs, r.durNs);
+        s.bytesRead += r.bytesRead;
+        s.bytesWritten += r.bytesWritten;
+        int bucket = 0;
+        while ((r.durNs >> (bucket + 1)) != 0 && bucket < InstrStats::BUCKETS - 1) {
+            bucket++;
+        }
+        s.histogram[bucket]++;
+    }
+    std::vector<InstrStats> stats;
+    for (auto &entry : byName) {
+        stats.push_back(entry.second);
+    }
+    std::sort(stats.begin(), stats.end(),
+              [](const InstrStats &a, const InstrStats &b) { return a.totalNs > b.totalNs; });
+    return stats;
+}
+
+inline void write_profile_summary(std::ostream &out)
+{
+    out << std::left << std::setw(16) << "instr" << std::right << std::setw(10) << "calls" << std::setw(12)
+        << "total ms" << std::setw(12) << "mean us" << std::setw(12) << "max us" << std::setw(12) << "GB/s"
+        << '\n';
+    for (const InstrStats &s : profile_summary()) {
+        const double totalMs = static_cast<double>(s.totalNs) / 1e6;
+        const double meanUs = static_cast<double>(s.totalNs) / 1e3 / static_cast<double>(s.calls);
+        const double gbps = s.totalNs == 0 ? 0.0 :
+                                             static_cast<double>(s.bytesRead + s.bytesWritten) /
+                                                 static_cast<double>(s.totalNs);
+        out << std::left << std::setw(16) << s.name << std::right << std::setw(10) << s.calls << std::fixed
+            << std::setprecision(3) << std::setw(12) << totalMs << std::setw(12) << meanUs << std::setw(12)
+            << static_cast<double>(s.maxNs) / 1e3 << std::setw(12) << gbps << '\n';
+    }
+}
+
+// Writes the records as Chrome trace events: one process per simulated core, one track per host thread.
+inline bool write_chrome_trace(const std::string &path)
+{
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    out << std::fixed << std::setprecision(3);
+    for (const InstrRecord &r : profile_records()) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"" << r.name << "\",\"cat\":\"pto\",\"ph\":\"X\",\"ts\":"
+            << static_cast<double>(r.startNs) / 1e3 << ",\"dur\":" << static_cast<double>(r.durNs) / 1e3
+            << ",\"pid\":" << r.core << ",\"tid\":" << r.thread << ",\"args\":{\"operands\":\"" << r.operands
+            << "\",\"bytes_read\":" << r.bytesRead << ",\"bytes_written\":" << r.bytesWritten << "}}";
+        first = false;
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+namespace detail {
+// Writes the PTO_CPU_PROFILE trace when the process exits.
+struct ProfileAtExit {
+    ~ProfileAtExit()
+    {
+        const char *path = std::getenv("PTO_CPU_PROFILE");
+        if (path != nullptr && path[0] != '\0' && !(path[0] == '1' && path[1] == '\0')) {
+            write_chrome_trace(path);
+        }
+    }
+};
+
+inline void ArmProfileAtExit()
+{
+    static ProfileAtExit atExit;
+}
+
+// Runs impl(args...) and records it.
+template <typename Impl, typename... Args>
+void RunProfiled(const char *name, Impl &impl, Args &&...args)
+{
+    ThreadProfile &profile = CurrentThreadProfile();
+    // After the profiler singleton exists, so the exit hook is destroyed first and still sees every record.
+    ArmProfileAtExit();
+    InstrRecord record;
+    record.name = name;
+    record.thread = profile.thread;
+    record.core = CurrentCore().blockIdx;
+    DescribeOperands(record, args...);
+    record.startNs = ProfileClockNs();
+    impl(std::forward<Args>(args)...);
+    record.durNs = ProfileClockNs() - record.startNs;
+    std::lock_guard<std::mutex> lock(profile.buffer->mutex);
+    profile.buffer->records.push_back(std::move(record));
+}
+} // namespace detail
+} // namespace pto::cpu
+
+#endif
@@ -0,0 +1,224 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_STRIDED_COPY_HPP
+#define PTO_CPU_STRIDED_COPY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/cpu/parallel.hpp"
+
+// Element-run copy helpers shared by the CPU data movers. A run is count elements apart by a fixed stride on
+// each side; unit-stride runs between bit-compatible types become a single memcpy.
+namespace pto::cpu {
+template <typename DstT, typename SrcT>
+inline constexpr bool IsBitwiseCopyable =
+    std::is_trivially_copyable_v<DstT> && sizeof(DstT) == sizeof(SrcT) &&
+    (std::is_same_v<std::remove_cv_t<DstT>, std::remove_cv_t<SrcT>> ||
+     (std::is_integral_v<DstT> && std::is_integral_v<std::remove_cv_t<SrcT>>));
+
+template <typename DstT, typename SrcT>
+PTO_INTERNAL void CopyRun(DstT *dst, const SrcT *src, std::size_t count, std::size_t dstStride = 1,
+                          std::size_t srcStride = 1)
+{
+    if (dstStride == 1 && srcStride == 1) {
+        if constexpr (IsBitwiseCopyable<DstT, SrcT>) {
+            if (count != 0) {
+                std::memcpy(dst, src, count * sizeof(DstT));
+            }
+        } else {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t i = 0; i < count; i++) {
+                dst[i] = src[i];
+            }
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        dst[i * dstStride] = src[i * srcStride];
+    }
+}
+
+namespace detail {
+constexpr std::size_t ATOMIC_LINE_BYTES = 64;
+constexpr std::size_t ATOMIC_STRIPES = 1024;
+
+// Striped locks guarding read-modify-write stores, one stripe per cache line of global memory.
+inline std::mutex &AtomicStripe(std::uintptr_t line)
+{
+    static std::mutex stripes[ATOMIC_STRIPES];
+    return stripes[line % ATOMIC_STRIPES];
+}
+
+inline std::uintptr_t CacheLineOf(const void *addr)
+{
+    return reinterpret_cast<std::uintptr_t>(addr) / ATOMIC_LINE_BYTES;
+}
+
+// *dst += value as a lock-free compare-exchange loop, which holds across processes mapping the same memory.
+template <typename DstT, typename SrcT>
+inline void AtomicAddElement(DstT *dst, SrcT value)
+{
+    static_assert(std::atomic_ref<DstT>::is_always_lock_free, "AtomicAdd: element type has no lock-free atomics");
+    std::atomic_ref<DstT> word(*dst);
+    DstT old = word.load(std::memory_order_relaxed);
+    while (!word.compare_exchange_weak(old, static_cast<DstT>(old + value), std::memory_order_relaxed)) {
+    }
+}
+} // namespace detail
+
+// dst[i * dstStride] += src[i * srcStride]. While other cores may write global memory each cache line is updated
+// under its stripe lock, so overlapping atomic stores from concurrent cores all land; between rank processes each
+// element is added with a compare-exchange instead.
+template <typename DstT, typename SrcT>
+PTO_INTERNAL void AddRun(DstT *dst, const SrcT *src, std::size_t count, std::size_t dstStride = 1,
+                         std::size_t srcStride = 1)
+{
+    if (GlobalMemoryCrossProcess()) {
+        for (std::size_t i = 0; i < count; i++) {
+            detail::AtomicAddElement(dst + i * dstStride, src[i * srcStride]);
+        }
+        return;
+    }
+    if (!GlobalMemoryShared()) {
+        if (dstStride == 1 && srcStride == 1) {
+            PTO_CPU_VECTORIZE_LOOP
+            for (std::size_t i = 0; i < count; i++) {
+                dst[i] = static_cast<DstT>(dst[i] + src[i]);
+            }
+        } else {
+            for (std::size_t i = 0; i < count; i++) {
+                dst[i * dstStride] = static_cast<DstT>(dst[i * dstStride] + src[i * srcStride]);
+            }
+        }
+        return;
+    }
+    std::size_t i = 0;
+    while (i < count) {
+        const std::uintptr_t line = detail::CacheLineOf(dst + i * dstStride);
+        std::lock_guard<std::mutex> lock(detail::AtomicStripe(line));
+        do {
+            dst[i * dstStride] = static_cast<DstT>(dst[i * dstStride] + src[i * srcStride]);
+            i++;
+        } while (i < count && detail::CacheLineOf(dst + i * dstStride) == line);
+    }
+}
+
+template <typename T>
+PTO_INTERNAL void FillRun(T *dst, std::size_t count, T value)
+{
+    std::fill(dst, dst + count, value);
+}
+
+// Shape and per-side strides of a 5-D global-to-global copy, outermost dimension first.
+constexpr int STRIDED_DIMS = 5;
+
+struct StridedLayout {
+    int64_t shape[STRIDED_DIMS];
+    int64_t dstStride[STRIDED_DIMS];
+    int64_t srcStride[STRIDED_DIMS];
+};
+
+// dst takes the shape; both tensors keep their own strides.
+template <typename DstTensor, typename SrcTensor>
+PTO_INTERNAL StridedLayout StridedLayoutOf(DstTensor &dst, SrcTensor &src)
+{
+    StridedLayout layout;
+    for (int d = 0; d < STRIDED_DIMS; d++) {
+        layout.shape[d] = dst.GetShape(d);
+        layout.dstStride[d] = dst.GetStride(d);
+        layout.srcStride[d] = src.GetStride(d);
+    }
+    return layout;
+}
+
+namespace detail {
+// Long runs are cut into blocks of this many elements so a single large run still spreads over the pool.
+constexpr int64_t STRIDED_COPY_BLOCK = 1 << 16;
+
+// Drops unit dimensions and merges each dimension into its outer neighbour when both sides are contiguous across
+// them. Returns the number of dimensions left, innermost last.
+inline int CoalesceStrided(StridedLayout &l)
+{
+    int kept = 0;
+    for (int d = 0; d < STRIDED_DIMS; d++) {
+        if (l.shape[d] == 1) {
+            continue;
+        }
+        const int p = kept - 1;
+        if (kept > 0 && l.dstStride[p] == l.dstStride[d] * l.shape[d] &&
+            l.srcStride[p] == l.srcStride[d] * l.shape[d]) {
+            l.shape[p] *= l.shape[d];
+            l.dstStride[p] = l.dstStride[d];
+            l.srcStride[p] = l.srcStride[d];
+            continue;
+        }
+        l.shape[kept] = l.shape[d];
+        l.dstStride[kept] = l.dstStride[d];
+        l.srcStride[kept] = l.srcStride[d];
+        kept++;
+    }
+    return kept;
+}
+} // namespace detail
+
+// Copies (or with accumulate, adds) a 5-D strided region. The innermost merged dimension is one CopyRun/AddRun,
+// a memcpy or vectorised add when both sides are unit-stride; the outer dimensions are walked with 64-bit offsets
+// and split across the thread pool.
+template <bool accumulate, typename DstT, typename SrcT>
+PTO_INTERNAL void CopyStrided(DstT *dst, const SrcT *src, StridedLayout layout)
+{
+    for (int d = 0; d < STRIDED_DIMS; d++) {
+        if (layout.shape[d] <= 0) {
+            return;
+        }
+    }
+    const int dims = detail::CoalesceStrided(layout);
+    const int inner = dims - 1;
+    const int64_t run = dims > 0 ? layout.shape[inner] : 1;
+    const int64_t dstStep = dims > 0 ? layout.dstStride[inner] : 1;
+    const int64_t srcStep = dims > 0 ? layout.srcStride[inner] : 1;
+    int64_t outer = 1;
+    for (int d = 0; d < inner; d++) {
+        outer *= layout.shape[d];
+    }
+    const int64_t blocks = (run + detail::STRIDED_COPY_BLOCK - 1) / detail::STRIDED_COPY_BLOCK;
+    const std::size_t total = static_cast<std::size_t>(outer * run);
+    parallel_for_1d(0, static_cast<std::size_t>(outer * blocks), total, [&](std::size_t task) {
+        int64_t rest = static_cast<int64_t>(task) / blocks;
+        const int64_t first = static_cast<int64_t>(task) % blocks * detail::STRIDED_COPY_BLOCK;
+        int64_t dstOff = first * dstStep;
+        int64_t srcOff = first * srcStep;
+        for (int d = inner - 1; d >= 0; d--) {
+            const int64_t idx = rest % layout.shape[d];
+            rest /= layout.shape[d];
+            dstOff += idx * layout.dstStride[d];
+            srcOff += idx * layout.srcStride[d];
+        }
+        const std::size_t count = static_cast<std::size_t>(std::min(detail::STRIDED_COPY_BLOCK, run - first));
+        if constexpr (accumulate) {
+            AddRun(dst + dstOff, src + srcOff, count, static_cast<std::size_t>(dstStep),
+                   static_cast<std::size_t>(srcStep));
+        } else {
+            CopyRun(dst + dstOff, src + srcOff, count, static_cast<std::size_t>(dstStep),
+                    static_cast<std::size_t>(srcStep));
+        }
+    });
+}
+} // namespace pto::cpu
+
+#endif
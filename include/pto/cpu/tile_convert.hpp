@@ -0,0 +1,212 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_TILE_CONVERT_HPP
+#define PTO_CPU_TILE_CONVERT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "pto/cpu/mx_formats.hpp"
+#include "pto/cpu/parallel.hpp"
+#include "pto/cpu/tile_offsets.hpp"
+
+// Layout-conversion engine behind TMOV, TEXTRACT and TINSERT. A move copies a rows x cols window of src at
+// (srcRow0, srcCol0) to dst at (dstRow0, dstCol0); the pair of tile types picks the kernel at compile time.
+namespace pto {
+enum class TileMoveKind
+{
+    Memcpy,  // same element type, unit stride in the same direction: every span is one memcpy (ND -> ND, ND -> Nz)
+    Blocked, // same element type, unit stride in opposite directions: blocks staged locally (ND -> Zn, DN -> ND)
+    Convert, // element type changes: an element loop along dst spans
+};
+
+template <typename DstTileData, typename SrcTileData>
+constexpr TileMoveKind ClassifyTileMove()
+{
+    if constexpr (!std::is_same_v<typename DstTileData::DType, typename SrcTileData::DType>) {
+        return TileMoveKind::Convert;
+    } else if constexpr (TileSpansAlongRows<DstTileData> == TileSpansAlongRows<SrcTileData>) {
+        return TileMoveKind::Memcpy;
+    } else {
+        return TileMoveKind::Blocked;
+    }
+}
+
+// Same element type, Rows, Cols and layout: identical byte images.
+template <typename DstTileData, typename SrcTileData>
+constexpr bool SameTileImage =
+    std::is_same_v<typename DstTileData::DType, typename SrcTileData::DType> &&
+    DstTileData::Rows == SrcTileData::Rows && DstTileData::Cols == SrcTileData::Cols &&
+    DstTileData::isRowMajor == SrcTileData::isRowMajor && DstTileData::SFractal == SrcTileData::SFractal &&
+    (DstTileData::SFractal == SLayout::NoneBox ||
+     (DstTileData::InnerRows == SrcTileData::InnerRows && DstTileData::InnerCols == SrcTileData::InnerCols));
+
+struct TileWindow {
+    size_t srcRow0;
+    size_t srcCol0;
+    size_t dstRow0;
+    size_t dstCol0;
+    size_t rows;
+    size_t cols;
+};
+
+// Edge of the square blocks of the Blocked kernel, one 32-byte sector per block line.
+template <typename T>
+constexpr size_t TILE_MOVE_BLOCK = std::max<size_t>(8, 32 / sizeof(T));
+
+// Offset of the element at line position pos of a line whose own term is lineOffset.
+template <typename TileData>
+PTO_INTERNAL size_t TileLineElementOffset(size_t lineOffset, size_t pos)
+{
+    if constexpr (TileSpansAlongRows<TileData>) {
+        return lineOffset + GetTileColOffset<TileData>(pos);
+    } else {
+        return lineOffset + GetTileRowOffset<TileData>(pos);
+    }
+}
+
+template <typename DstTileData, typename SrcTileData>
+void MoveTileMemcpy(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, const TileWindow &w)
+{
+    using T = typename DstTileData::DType;
+    constexpr bool alongRows = TileSpansAlongRows<DstTileData>;
+    constexpr size_t srcSpan = TileSpanLength<SrcTileData>;
+    const size_t lines = alongRows ? w.rows : w.cols;
+    const size_t extent = alongRows ? w.cols : w.rows;
+    const size_t dstLine0 = alongRows ? w.dstRow0 : w.dstCol0;
+    const size_t dstPos0 = alongRows ? w.dstCol0 : w.dstRow0;
+    const size_t srcLine0 = alongRows ? w.srcRow0 : w.srcCol0;
+    const size_t srcPos0 = alongRows ? w.srcCol0 : w.srcRow0;
+    cpu::parallel_for_rows(lines, extent, [&](size_t l) {
+        const size_t srcLine = alongRows ? GetTileRowOffset<SrcTileData>(srcLine0 + l) :
+                                           GetTileColOffset<SrcTileData>(srcLine0 + l);
+        const size_t dstLine = dstLine0 + l;
+        ForEachTileSpan<DstTileData>(dstLine, dstPos0, dstPos0 + extent, [&](size_t pos, size_t offset, size_t len) {
+            // A dst span may straddle a src fractal boundary when the two windows are not equally aligned.
+            for (size_t done = 0; done < len;) {
+                const size_t s = srcPos0 + (pos - dstPos0) + done;
+                const size_t piece = std::min(len - done, srcSpan - s % srcSpan);
+                std::memcpy(dst + offset + done, src + TileLineElementOffset<SrcTileData>(srcLine, s),
+                            piece * sizeof(T));
+                done += piece;
+            }
+        });
+    });
+}
+
+template <typename DstTileData, typename SrcTileData>
+void MoveTileBlocked(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, const TileWindow &w)
+{
+    using T = typename DstTileData::DType;
+    constexpr size_t B = TILE_MOVE_BLOCK<T>;
+    const size_t rowBlocks = (w.rows + B - 1) / B;
+    cpu::parallel_for_1d(0, rowBlocks, w.rows * w.cols, [&](size_t rb) {
+        T block[B][B];
+        const size_t i0 = rb * B;
+        const size_t rows = std::min(B, w.rows - i0);
+        for (size_t j0 = 0; j0 < w.cols; j0 += B) {
+            const size_t cols = std::min(B, w.cols - j0);
+            // Read along the unit stride of src ...
+            if constexpr (TileSpansAlongRows<SrcTileData>) {
+                for (size_t i = 0; i < rows; ++i) {
+                    const size_t line = GetTileRowOffset<SrcTileData>(w.srcRow0 + i0 + i);
+                    for (size_t j = 0; j < cols; ++j) {
+                        block[i][j] = src[line + GetTileColOffset<SrcTileData>(w.srcCol0 + j0 + j)];
+                    }
+                }
+            } else {
+                for (size_t j = 0; j < cols; ++j) {
+                    const size_t line = GetTileColOffset<SrcTileData>(w.srcCol0 + j0 + j);
+                    for (size_t i = 0; i < rows; ++i) {
+                        block[i][j] = src[line + GetTileRowOffset<SrcTileData>(w.srcRow0 + i0 + i)];
+                    }
+                }
+            }
+            // ... and write along the unit stride of dst.
+            if constexpr (TileSpansAlongRows<DstTileData>) {
+                for (size_t i = 0; i < rows; ++i) {
+                    const size_t line = GetTileRowOffset<DstTileData>(w.dstRow0 + i0 + i);
+                    for (size_t j = 0; j < cols; ++j) {
+                        dst[line + GetTileColOffset<DstTileData>(w.dstCol0 + j0 + j)] = block[i][j];
+                    }
+                }
+            } else {
+                for (size_t j = 0; j < cols; ++j) {
+                    const size_t line = GetTileColOffset<DstTileData>(w.dstCol0 + j0 + j);
+                    for (size_t i = 0; i < rows; ++i) {
+                        dst[line + GetTileRowOffset<DstTileData>(w.dstRow0 + i0 + i)] = block[i][j];
+                    }
+                }
+            }
+        }
+    });
+}
+
+// Walks dst spans of the window in parallel, calling fn(dstOffset, srcOffset, srcRow, srcCol) per element.
+template <typename DstTileData, typename SrcTileData, typename Fn>
+void ForEachTileMoveElement(const TileWindow &w, Fn &&fn)
+{
+    constexpr bool alongRows = TileSpansAlongRows<DstTileData>;
+    const size_t lines = alongRows ? w.rows : w.cols;
+    const size_t extent = alongRows ? w.cols : w.rows;
+    const size_t dstPos0 = alongRows ? w.dstCol0 : w.dstRow0;
+    cpu::parallel_for_rows(lines, extent, [&](size_t l) {
+        const size_t dstLine = (alongRows ? w.dstRow0 : w.dstCol0) + l;
+        ForEachTileSpan<DstTileData>(dstLine, dstPos0, dstPos0 + extent, [&](size_t pos, size_t offset, size_t len) {
+            for (size_t i = 0; i < len; ++i) {
+                const size_t r = alongRows ? w.srcRow0 + l : w.srcRow0 + (pos - dstPos0) + i;
+                const size_t c = alongRows ? w.srcCol0 + (pos - dstPos0) + i : w.srcCol0 + l;
+                fn(offset + i, GetTileElementOffset<SrcTileData>(r, c), r, c);
+            }
+        });
+    });
+}
+
+// dst(dstRow0 + r, dstCol0 + c) = src(srcRow0 + r, srcCol0 + c) for r < rows, c < cols.
+template <typename DstTileData, typename SrcTileData>
+void MoveTileWindow(typename DstTileData::TileDType dst, typename SrcTileData::TileDType src, const TileWindow &w)
+{
+    using DstT = typename DstTileData::DType;
+    if (w.rows == 0 || w.cols == 0) {
+        return;
+    }
+    if constexpr (IsMxFp4<DstT>) {
+        // Two elements share a byte, so the window moves nibble by nibble and on one thread.
+        for (size_t r = 0; r < w.rows; ++r) {
+            for (size_t c = 0; c < w.cols; ++c) {
+                MxSetNibble(dst, GetTileElementOffset<DstTileData>(w.dstRow0 + r, w.dstCol0 + c),
+                            MxNibble(src, GetTileElementOffset<SrcTileData>(w.srcRow0 + r, w.srcCol0 + c)));
+            }
+        }
+        return;
+    }
+    if constexpr (SameTileImage<DstTileData, SrcTileData>) {
+        if (w.srcRow0 == 0 && w.srcCol0 == 0 && w.dstRow0 == 0 && w.dstCol0 == 0 && w.rows == DstTileData::Rows &&
+            w.cols == DstTileData::Cols) {
+            std::memcpy(dst, src, sizeof(DstT) * DstTileData::Rows * DstTileData::Cols);
+            return;
+        }
+    }
+    constexpr TileMoveKind kind = ClassifyTileMove<DstTileData, SrcTileData>();
+    if constexpr (kind == TileMoveKind::Memcpy) {
+        MoveTileMemcpy<DstTileData, SrcTileData>(dst, src, w);
+    } else if constexpr (kind == TileMoveKind::Blocked) {
+        MoveTileBlocked<DstTileData, SrcTileData>(dst, src, w);
+    } else {
+        ForEachTileMoveElement<DstTileData, SrcTileData>(
+            w, [&](size_t d, size_t s, size_t, size_t) { dst[d] = static_cast<DstT>(src[s]); });
+    }
+}
+} // namespace pto
+
+#endif
@@ -11,33 +11,53 @@ See LICENSE in the root of the software repository for the full text of the Lice
 #ifndef TILE_OFFSETS_HPP
 #define TILE_OFFSETS_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <unistd.h>
+
+#include "pto/cpu/parallel.hpp"
+
 namespace pto {
 template <typename TileData>
 using TypeSum = std::conditional_t<std::is_same_v<typename TileData::DType, half>, float, typename TileData::DType>;
 
+// Fractal shape used for addressing. Tiles report 16 x 2 for every MX scale fractal (the only fractal two elements
+// wide), but a column-major one holds 2 K-rows by 16 N-columns (the MX_B_NN layout), so that a right-scale tile needs
+// only K / 32 rows.
+template <typename TileData>
+constexpr bool IsColMajorMxFractal =
+    TileData::SFractal == SLayout::ColMajor && TileData::InnerRows == 16 && TileData::InnerCols == 2;
+
+template <typename TileData>
+constexpr size_t TileInnerRows = IsColMajorMxFractal<TileData> ? TileData::InnerCols : TileData::InnerRows;
+
+template <typename TileData>
+constexpr size_t TileInnerCols = IsColMajorMxFractal<TileData> ? TileData::InnerRows : TileData::InnerCols;
+
 template <typename TileData>
-size_t GetTileElementOffsetSubfractals(size_t subTileR, size_t innerR, size_t subTileC, size_t innerC)
+constexpr size_t GetTileElementOffsetSubfractals(size_t subTileR, size_t innerR, size_t subTileC, size_t innerC)
 {
+    constexpr size_t innerRows = TileInnerRows<TileData>;
+    constexpr size_t innerCols = TileInnerCols<TileData>;
+    constexpr size_t innerNumel = innerRows * innerCols;
     if constexpr (!TileData::isRowMajor & (TileData::SFractal == SLayout::RowMajor)) {
         // Nz
-        return subTileC * TileData::Rows * TileData::InnerCols + subTileR * TileData::InnerNumel +
-               innerR * TileData::InnerCols + innerC;
+        return subTileC * TileData::Rows * innerCols + subTileR * innerNumel + innerR * innerCols + innerC;
     } else if constexpr (TileData::isRowMajor & (TileData::SFractal == SLayout::ColMajor)) {
         // Zn
-        return subTileR * TileData::Cols * TileData::InnerRows + subTileC * TileData::InnerNumel +
-               innerC * TileData::InnerRows + innerR;
+        return subTileR * TileData::Cols * innerRows + subTileC * innerNumel + innerC * innerRows + innerR;
     } else if constexpr (TileData::isRowMajor & (TileData::SFractal == SLayout::RowMajor)) {
         // Zz
-        return subTileR * TileData::Cols * TileData::InnerRows + subTileC * TileData::InnerNumel +
-               innerR * TileData::InnerCols + innerC;
+        return subTileR * TileData::Cols * innerRows + subTileC * innerNumel + innerR * innerCols + innerC;
     } else {
-        assert(false && "Invalid layout");
+        // Nn
+        return subTileC * TileData::Rows * innerCols + subTileR * innerNumel + innerC * innerRows + innerR;
     }
 }
 
 template <typename TileData>
-size_t GetTileElementOffsetPlain(size_t r, size_t c)
+constexpr size_t GetTileElementOffsetPlain(size_t r, size_t c)
 {
     if constexpr (TileData::isRowMajor) {
         return r * TileData::Cols + c;
@@ -46,18 +66,106 @@ size_t GetTileElementOffsetPlain(size_t r, size_t c)
     }
 }
 
+// Every boxed layout splits into a row term plus a column term: offset(r, c) = row[r] + col[c]. The two tables are
+// built at compile time from the Tile parameters, so element lookups need no division or modulo.
+template <typename TileData>
+struct TileOffsetTable {
+    static constexpr std::array<uint32_t, TileData::Rows> MakeRows()
+    {
+        std::array<uint32_t, TileData::Rows> rows{};
+        for (size_t r = 0; r < rows.size(); ++r) {
+            rows[r] = static_cast<uint32_t>(GetTileElementOffsetSubfractals<TileData>(
+                r / TileInnerRows<TileData>, r % TileInnerRows<TileData>, 0, 0));
+        }
+        return rows;
+    }
+
+    static constexpr std::array<uint32_t, TileData::Cols> MakeCols()
+    {
+        std::array<uint32_t, TileData::Cols> cols{};
+        for (size_t c = 0; c < cols.size(); ++c) {
+            cols[c] = static_cast<uint32_t>(GetTileElementOffsetSubfractals<TileData>(
+                0, 0, c / TileInnerCols<TileData>, c % TileInnerCols<TileData>));
+        }
+        return cols;
+    }
+
+    static constexpr std::array<uint32_t, TileData::Rows> row = MakeRows();
+    static constexpr std::array<uint32_t, TileData::Cols> col = MakeCols();
+};
+
+// Row and column terms of GetTileElementOffset; hoist one of them out of an inner loop.
 template <typename TileData>
-size_t GetTileElementOffset(size_t r, size_t c)
+constexpr size_t GetTileRowOffset(size_t r)
 {
-    if constexpr (TileData::SFractal == SLayout::NoneBox)
-        return GetTileElementOffsetPlain<TileData>(r, c);
-    else {
-        size_t subTileR = r / TileData::InnerRows;
-        size_t innerR = r % TileData::InnerRows;
-        return GetTileElementOffsetSubfractals<TileData>(r / TileData::InnerRows, r % TileData::InnerRows,
-                                                         c / TileData::InnerCols, c % TileData::InnerCols);
+    if constexpr (TileData::SFractal == SLayout::NoneBox) {
+        return GetTileElementOffsetPlain<TileData>(r, 0);
+    } else {
+        return TileOffsetTable<TileData>::row[r];
     }
 }
 
+template <typename TileData>
+constexpr size_t GetTileColOffset(size_t c)
+{
+    if constexpr (TileData::SFractal == SLayout::NoneBox) {
+        return GetTileElementOffsetPlain<TileData>(0, c);
+    } else {
+        return TileOffsetTable<TileData>::col[c];
+    }
+}
+
+template <typename TileData>
+constexpr size_t GetTileElementOffset(size_t r, size_t c)
+{
+    return GetTileRowOffset<TileData>(r) + GetTileColOffset<TileData>(c);
+}
+
+// Direction of unit stride: along a row for row-major, Nz and Zz tiles, along a column for col-major, Zn and Nn tiles.
+template <typename TileData>
+constexpr bool TileSpansAlongRows =
+    TileData::SFractal == SLayout::NoneBox ? TileData::isRowMajor : TileData::SFractal == SLayout::RowMajor;
+
+// Longest unit-stride run: a whole row or column of a plain tile, one fractal row or column of a boxed tile.
+template <typename TileData>
+constexpr size_t TileSpanLength =
+    TileData::SFractal == SLayout::NoneBox ?
+        (TileData::isRowMajor ? TileData::Cols : TileData::Rows) :
+        (TileSpansAlongRows<TileData> ? TileInnerCols<TileData> : TileInnerRows<TileData>);
+
+// Walks elements [begin, end) of one line (a row if TileSpansAlongRows, else a column) one fractal at a time,
+// calling fn(pos, offset, len) for the len elements at line positions [pos, pos + len), stored at
+// [offset, offset + len).
+template <typename TileData, typename Fn>
+void ForEachTileSpan(size_t line, size_t begin, size_t end, Fn &&fn)
+{
+    constexpr size_t span = TileSpanLength<TileData>;
+    constexpr bool alongRows = TileSpansAlongRows<TileData>;
+    const size_t base = alongRows ? GetTileRowOffset<TileData>(line) : GetTileColOffset<TileData>(line);
+    for (size_t pos = begin; pos < end;) {
+        const size_t len = std::min(end, (pos / span + 1) * span) - pos;
+        fn(pos, base + (alongRows ? GetTileColOffset<TileData>(pos) : GetTileRowOffset<TileData>(pos)), len);
+        pos += len;
+    }
+}
+
+template <typename TileData, typename Fn>
+void ForEachTileSpan(size_t line, size_t extent, Fn &&fn)
+{
+    ForEachTileSpan<TileData>(line, 0, extent, fn);
+}
+
+// Walks the validRow x validCol region in parallel over lines, calling fn(offset, len) for every unit-stride span.
+template <typename TileData, typename Fn>
+void ParallelForTileSpans(size_t validRow, size_t validCol, Fn &&fn)
+{
+    constexpr bool alongRows = TileSpansAlongRows<TileData>;
+    const size_t lines = alongRows ? validRow : validCol;
+    const size_t extent = alongRows ? validCol : validRow;
+    cpu::parallel_for_rows(lines, extent, [&](size_t line) {
+        ForEachTileSpan<TileData>(line, extent, [&](size_t, size_t offset, size_t len) { fn(offset, len); });
+    });
+}
+
 } // namespace pto
 #endif
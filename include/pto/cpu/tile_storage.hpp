@@ -0,0 +1,108 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_TILE_STORAGE_HPP
+#define PTO_CPU_TILE_STORAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace pto::cpu {
+// Element storage of a CPU tile. A tile owns a heap buffer of N elements until TASSIGN binds it to its address in
+// the core's simulated buffers (see pto/cpu/core_buffers.hpp); from then on it is a view and owns nothing. TRESHAPE
+// makes it a view of another tile's elements, sharing that tile's heap buffer if it has one. It converts to the
+// element pointer the tile exposes as its TileDType.
+template <typename T, std::size_t N>
+class TileStorage {
+public:
+    TileStorage() : heap_(std::make_shared_for_overwrite<T[]>(N)), data_(static_cast<T *>(heap_.get())), owner_(true)
+    {}
+
+    // A copy of an owning tile gets its own elements; a copy of a view aliases the same address.
+    TileStorage(const TileStorage &other) : heap_(other.heap_), data_(other.data_), owner_(other.owner_)
+    {
+        if (owner_) {
+            std::shared_ptr<T[]> elements = std::make_shared_for_overwrite<T[]>(N);
+            std::copy_n(other.data_, N, elements.get());
+            data_ = elements.get();
+            heap_ = std::move(elements);
+        }
+    }
+
+    TileStorage &operator=(const TileStorage &other)
+    {
+        if (this != &other) {
+            TileStorage copy(other);
+            heap_ = std::move(copy.heap_);
+            data_ = copy.data_;
+            owner_ = copy.owner_;
+        }
+        return *this;
+    }
+
+    // A move hands over the elements (or the view) and leaves other empty.
+    TileStorage(TileStorage &&other) noexcept
+        : heap_(std::move(other.heap_)), data_(std::exchange(other.data_, nullptr)),
+          owner_(std::exchange(other.owner_, false))
+    {}
+
+    TileStorage &operator=(TileStorage &&other) noexcept
+    {
+        if (this != &other) {
+            heap_ = std::move(other.heap_);
+            data_ = std::exchange(other.data_, nullptr);
+            owner_ = std::exchange(other.owner_, false);
+        }
+        return *this;
+    }
+
+    // Turns the storage into a view of view, dropping any owned elements.
+    TileStorage &operator=(T *view)
+    {
+        data_ = view;
+        heap_.reset();
+        owner_ = false;
+        return *this;
+    }
+
+    // Turns the storage into a view of other's elements reinterpreted as T. A heap buffer behind them stays alive
+    // for as long as either storage refers to it.
+    template <typename U, std::size_t M>
+    void Alias(const TileStorage<U, M> &other)
+    {
+        std::shared_ptr<void> heap = other.heap_;
+        data_ = reinterpret_cast<T *>(other.data_);
+        heap_ = std::move(heap);
+        owner_ = false;
+    }
+
+    operator T *&()
+    {
+        return data_;
+    }
+
+    operator T *const &() const
+    {
+        return data_;
+    }
+
+private:
+    template <typename U, std::size_t M>
+    friend class TileStorage;
+
+    std::shared_ptr<void> heap_; // buffer data_ points into, if on the heap
+    T *data_;
+    bool owner_; // heap_ holds this tile's own elements, copied along with it
+};
+} // namespace pto::cpu
+
+#endif
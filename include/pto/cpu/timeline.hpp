@@ -0,0 +1,691 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_TIMELINE_HPP
+#define PTO_CPU_TIMELINE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "pto/common/cpu_stub.hpp"
+#include "pto/common/pto_tile.hpp"
+
+// Cycle-approximate pipe timeline for the CPU simulator.
+//
+// While enabled, every instruction issued through MAP_INSTR_IMPL is also placed on a virtual clock of the core that
+// issued it. Each pipe (MTE2, V, MTE1, M, FIX, MTE3) runs its instructions in order; an instruction starts once it
+// is issued and its pipe is free, and lasts as long as the cost model says its operands take. set_flag/wait_flag
+// and pipe_barrier(PIPE_ALL) order the pipes exactly as they do on the device, so the result predicts how well a
+// kernel overlaps its pipes independently of how fast the host ran it. Instructions that are not tied to a pipe
+// (FIFO handles, sort lists, ...) wait for every pipe, like they do under AsyncPipeScope.
+//
+// The model is deliberately coarse: costs are bandwidth/latency estimates per architecture, cross-core sync
+// (FIFOs, ffts flags) is not modelled, and successive launches are laid end to end on each core. Kernels that rely
+// on program order instead of flags appear more overlapped than they could run. Enable with
+// cpu::set_timeline(true), or set PTO_CPU_TIMELINE=<dir> to model the whole process and write the pipeline logs
+// to <dir> at exit.
+namespace pto::cpu {
+// Throughput and fixed latency of each pipe, in cycles. Vector throughput applies to the largest operand.
+struct PipeCostModel {
+    const char *name;
+    double clockGHz;
+    uint32_t issueCycles;
+    double mte2BytesPerCycle;
+    uint32_t mte2Latency;
+    double mte3BytesPerCycle;
+    uint32_t mte3Latency;
+    double mte1BytesPerCycle;
+    uint32_t mte1Latency;
+    double fixBytesPerCycle;
+    uint32_t fixLatency;
+    double vectorBytesPerCycle;
+    uint32_t vectorLatency;
+    double cubeMacsPerCycle[3]; // by input element size: 1 byte, 2 bytes, 4 bytes
+    uint32_t cubeLatency;
+};
+
+inline PipeCostModel CostModelA2A3()
+{
+    return PipeCostModel{"A2A3", 1.8, 1, 64.0, 200, 64.0, 120, 256.0, 20, 128.0, 40, 256.0, 16,
+                         {8192.0, 4096.0, 1024.0}, 30};
+}
+
+inline PipeCostModel CostModelA5()
+{
+    return PipeCostModel{"A5", 1.8, 1, 128.0, 180, 128.0, 100, 512.0, 16, 256.0, 32, 256.0, 12,
+                         {16384.0, 8192.0, 2048.0}, 24};
+}
+
+// One instruction, or one flag operation, placed on a core's timeline.
+struct TimelineEvent {
+    uint64_t id;
+    const char *name;
+    std::string mnemonic;
+    pipe_t pipe;
+    uint64_t startCycle;
+    uint64_t endCycle;
+    int64_t core;
+    int64_t subblock;
+    bool cube;
+    bool sync;
+    uint64_t bytes;
+    uintptr_t src;
+    uintptr_t dst;
+};
+
+// Predicted occupancy of one pipe of one core over the core's whole timeline.
+struct PipeUtilization {
+    int64_t core;
+    int64_t subblock;
+    bool cube;
+    pipe_t pipe;
+    uint64_t instrs;
+    uint64_t busyCycles;
+    uint64_t spanCycles;
+};
+
+namespace detail {
+constexpr int PIPE_NUM = 8;
+
+inline std::atomic<bool> &TimelineEnabled()
+{
+    static std::atomic<bool> enabled{[]() {
+        const char *env = std::getenv("PTO_CPU_TIMELINE");
+        return env != nullptr && env[0] != '\0' && env[0] != '0';
+    }()};
+    return enabled;
+}
+
+inline PipeCostModel &CurrentCostModel()
+{
+#ifdef PTO_NPU_ARCH_A2A3
+    static PipeCostModel model = CostModelA2A3();
+#else
+    static PipeCostModel model = CostModelA5();
+#endif
+    return model;
+}
+
+// Instructions run by another instruction's implementation are part of its cost, not separate work.
+inline int &TimelineNesting()
+{
+    thread_local int depth = 0;
+    return depth;
+}
+
+struct TimelineNestGuard {
+    TimelineNestGuard()
+    {
+        TimelineNesting()++;
+    }
+    ~TimelineNestGuard()
+    {
+        TimelineNesting()--;
+    }
+    TimelineNestGuard(const TimelineNestGuard &) = delete;
+    TimelineNestGuard &operator=(const TimelineNestGuard &) = delete;
+};
+
+// What an instruction moves or computes: the largest tile (or, without tiles, global tensor) it touches, and the
+// multiply-accumulates of a Left x Right product.
+struct InstrWork {
+    uint64_t tileBytes = 0;
+    uint64_t globalBytes = 0;
+    uint64_t m = 0;
+    uint64_t k = 0;
+    uint64_t n = 0;
+    uint32_t cubeElemBytes = 0;
+    bool dstMat = false;
+    bool srcMat = false;
+    uintptr_t src = 0;
+    uintptr_t dst = 0;
+
+    uint64_t Bytes() const
+    {
+        return tileBytes != 0 ? tileBytes : globalBytes;
+    }
+};
+
+template <typename T>
+void AddOperandWork(InstrWork &work, const T &arg, bool isDst)
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T>>;
+    uintptr_t address = 0;
+    if constexpr (is_tile_data_v<U>) {
+        auto &tile = const_cast<U &>(arg);
+        const uint64_t rows = static_cast<uint64_t>(tile.GetValidRow());
+        const uint64_t cols = static_cast<uint64_t>(tile.GetValidCol());
+        work.tileBytes = std::max<uint64_t>(work.tileBytes, rows * cols * sizeof(typename U::DType));
+        if constexpr (U::Loc == TileType::Left) {
+            work.m = rows;
+            work.k = cols;
+            work.cubeElemBytes = sizeof(typename U::DType);
+        } else if constexpr (U::Loc == TileType::Right) {
+            work.n = cols;
+        } else if constexpr (U::Loc == TileType::Mat) {
+            (isDst ? work.dstMat : work.srcMat) = true;
+        }
+        address = reinterpret_cast<uintptr_t>(static_cast<const void *>(tile.data()));
+    } else if constexpr (is_global_data_v<U>) {
+        auto &tensor = const_cast<U &>(arg);
+        uint64_t elems = 1;
+        for (int d = 0; d < GlobalTensorDim::TOTAL_DIM; d++) {
+            elems *= static_cast<uint64_t>(tensor.GetShape(d));
+        }
+        work.globalBytes = std::max<uint64_t>(work.globalBytes, elems * sizeof(typename U::RawDType));
+        address = reinterpret_cast<uintptr_t>(static_cast<const void *>(tensor.data()));
+    }
+    if (isDst) {
+        work.dst = address;
+    } else if (work.src == 0) {
+        work.src = address;
+    }
+}
+
+// The first operand is the destination of every PTO instruction.
+template <typename First, typename... Rest>
+InstrWork DescribeWork(const First &first, const Rest &...rest)
+{
+    InstrWork work;
+    AddOperandWork(work, first, true);
+    (AddOperandWork(work, rest, false), ...);
+    return work;
+}
+
+inline InstrWork DescribeWork()
+{
+    return InstrWork{};
+}
+
+// Relative cost of a vector instruction per byte: transcendental and sorting units are slower than add/mul.
+inline double VectorCostFactor(const char *name)
+{
+    static constexpr std::pair<const char *, double> factors[] = {
+        {"TEXP", 4.0},    {"TLOG", 4.0},    {"TSQRT", 4.0},    {"TRSQRT", 4.0},  {"TDIV", 4.0},
+        {"TDIVS", 4.0},   {"TRECIP", 4.0},  {"TPOW", 8.0},     {"TSORT32", 8.0}, {"TMRGSORT", 4.0},
+        {"TCVT", 2.0},    {"TGATHER", 2.0}, {"TSCATTER", 2.0}, {"TTRANS", 2.0},  {"TROWSUM", 1.5},
+        {"TROWMAX", 1.5}, {"TROWMIN", 1.5}, {"TCOLSUM", 1.5},  {"TCOLMAX", 1.5}, {"TCOLMIN", 1.5},
+    };
+    for (const auto &[op, factor] : factors) {
+        if (std::strcmp(op, name) == 0) {
+            return factor;
+        }
+    }
+    return 1.0;
+}
+
+inline uint64_t Cycles(double amount, double perCycle)
+{
+    return static_cast<uint64_t>(std::ceil(amount / perCycle));
+}
+
+inline uint64_t InstrCycles(const PipeCostModel &model, pipe_t pipe, const char *name, const InstrWork &work)
+{
+    const double bytes = static_cast<double>(work.Bytes());
+    switch (pipe) {
+        case PIPE_MTE2:
+            return model.mte2Latency + Cycles(bytes, model.mte2BytesPerCycle);
+        case PIPE_MTE3:
+            return model.mte3Latency + Cycles(bytes, model.mte3BytesPerCycle);
+        case PIPE_MTE1:
+            return model.mte1Latency + Cycles(bytes, model.mte1BytesPerCycle);
+        case PIPE_FIX:
+            return model.fixLatency + Cycles(bytes, model.fixBytesPerCycle);
+        case PIPE_M:
+            if (work.m != 0 && work.n != 0) {
+                const int width = work.cubeElemBytes <= 1 ? 0 : work.cubeElemBytes == 2 ? 1 : 2;
+                return model.cubeLatency +
+                       Cycles(static_cast<double>(work.m * work.k * work.n), model.cubeMacsPerCycle[width]);
+            }
+            return model.cubeLatency + Cycles(bytes, model.vectorBytesPerCycle);
+        case PIPE_V:
+            return model.vectorLatency + Cycles(bytes * VectorCostFactor(name), model.vectorBytesPerCycle);
+        default:
+            return model.issueCycles;
+    }
+}
+
+// Instruction names as the device logs print them.
+inline std::string InstrMnemonic(pipe_t pipe, const char *name, const InstrWork &work)
+{
+    switch (pipe) {
+        case PIPE_MTE2:
+            return work.dstMat ? "MOV_OUT_TO_L1" : "MOV_OUT_TO_UB";
+        case PIPE_MTE3:
+            return work.srcMat ? "MOV_L1_TO_OUT" : "MOV_UB_TO_OUT";
+        case PIPE_MTE1:
+            return "LOAD_L1_TO_L0";
+        case PIPE_FIX:
+            return work.dstMat ? "FIX_L0C_TO_L1" : "FIX_L0C_TO_OUT";
+        case PIPE_M:
+            return "MMAD";
+        default:
+            break;
+    }
+    std::string mnemonic = name[0] == 'T' ? std::string(name + 1) : std::string(name);
+    for (char &c : mnemonic) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return pipe == PIPE_V ? "V" + mnemonic : mnemonic;
+}
+
+inline const char *PipeLogName(pipe_t pipe)
+{
+    switch (pipe) {
+        case PIPE_V:
+            return "VEC";
+        case PIPE_MTE1:
+            return "MTE1";
+        case PIPE_MTE2:
+            return "MTE2";
+        case PIPE_MTE3:
+            return "MTE3";
+        case PIPE_M:
+            return "CUBE";
+        case PIPE_FIX:
+            return "FIXP";
+        default:
+            return "SCALAR";
+    }
+}
+
+// Virtual clock of one simulated core. Only the thread running the core advances it; the mutex lets snapshots
+// read the events while it does.
+class CoreClock {
+public:
+    CoreClock(int64_t core, int64_t subblock, bool cube) : core_(core), subblock_(subblock), cube_(cube)
+    {}
+
+    void Instr(const PipeCostModel &model, pipe_t pipe, const char *name, const InstrWork &work)
+    {
+        uint64_t start = 0;
+        uint64_t end = 0;
+        if (IsScalar(pipe)) {
+            issue_ = std::max(issue_, AllPipesFree());
+            start = issue_;
+            end = start + model.issueCycles;
+            issue_ = end;
+        } else {
+            issue_ += model.issueCycles;
+            start = std::max(pipeFree_[pipe], issue_);
+            end = start + InstrCycles(model, pipe, name, work);
+            pipeFree_[pipe] = end;
+        }
+        Record(name, InstrMnemonic(pipe, name, work), pipe, start, end, false, work.Bytes(), work.src, work.dst);
+    }
+
+    // The flag is set once every earlier instruction of src has finished.
+    void SetFlag(pipe_t src, pipe_t dst, event_t id)
+    {
+        const uint64_t at = IsScalar(src) ? issue_ : std::max(pipeFree_[src], issue_);
+        flags_[FlagKey(src, dst, id)].push_back(at);
+        Record("set_flag", "SET_FLAG", IsScalar(src) ? PIPE_S : src, at, at, true, 0, 0, 0);
+    }
+
+    // dst (or the scalar unit) stalls until the matching set_flag; an unmatched wait does not stall.
+    void WaitFlag(pipe_t src, pipe_t dst, event_t id)
+    {
+        std::deque<uint64_t> &sets = flags_[FlagKey(src, dst, id)];
+        uint64_t ready = 0;
+        if (!sets.empty()) {
+            ready = sets.front();
+            sets.pop_front();
+        }
+        uint64_t start = issue_;
+        if (IsScalar(dst)) {
+            issue_ = std::max(issue_, ready);
+        } else {
+            start = std::max(pipeFree_[dst], issue_);
+            pipeFree_[dst] = std::max(start, ready);
+        }
+        Record("wait_flag", "WAIT_FLAG", IsScalar(dst) ? PIPE_S : dst, start, std::max(start, ready), true, 0, 0,
+               0);
+    }
+
+    void Barrier(pipe_t pipe)
+    {
+        if (pipe == PIPE_ALL) {
+            issue_ = std::max(issue_, AllPipesFree());
+        }
+    }
+
+    void AppendTo(std::vector<TimelineEvent> &out)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.insert(out.end(), events_.begin(), events_.end());
+    }
+
+private:
+    static bool IsScalar(pipe_t pipe)
+    {
+        return pipe < 0 || pipe >= PIPE_NUM || pipe == PIPE_S || pipe == PIPE_ALL;
+    }
+
+    static int FlagKey(pipe_t src, pipe_t dst, event_t id)
+    {
+        return (src * PIPE_NUM + dst) * EVENT_ID_MAX + static_cast<int>(id) % EVENT_ID_MAX;
+    }
+
+    uint64_t AllPipesFree() const
+    {
+        return *std::max_element(std::begin(pipeFree_), std::end(pipeFree_));
+    }
+
+    void Record(const char *name, std::string mnemonic, pipe_t pipe, uint64_t start, uint64_t end, bool sync,
+                uint64_t bytes, uintptr_t src, uintptr_t dst)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(TimelineEvent{nextId_++, name, std::move(mnemonic), pipe, start, end, core_, subblock_,
+                                        cube_, sync, bytes, src, dst});
+    }
+
+    int64_t core_;
+    int64_t subblock_;
+    bool cube_;
+    uint64_t issue_ = 0;
+    uint64_t pipeFree_[PIPE_NUM] = {};
+    std::map<int, std::deque<uint64_t>> flags_;
+    uint64_t nextId_ = 0;
+    std::mutex mutex_;
+    std::vector<TimelineEvent> events_;
+};
+
+// Clocks of every simulated core seen so far, keyed by block, subblock and core kind.
+class Timeline {
+public:
+    static Timeline &Instance()
+    {
+        static Timeline timeline;
+        return timeline;
+    }
+
+    CoreClock &Clock(const CoreContext &core)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &clock = clocks_[std::make_tuple(core.blockIdx, core.subblockId, core.isCube)];
+        if (!clock) {
+            clock = std::make_unique<CoreClock>(core.blockIdx, core.subblockId, core.isCube);
+        }
+        return *clock;
+    }
+
+    std::vector<TimelineEvent> Snapshot()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TimelineEvent> all;
+        for (auto &entry : clocks_) {
+            entry.second->AppendTo(all);
+        }
+        return all;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        clocks_.clear();
+        generation_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t Generation() const
+    {
+        return generation_.load(std::memory_order_relaxed);
+    }
+
+    void RegisterBuffer(const std::string &name, uintptr_t addr, uint64_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_[name] = {addr, bytes};
+    }
+
+    std::map<std::string, std::pair<uintptr_t, uint64_t>> Buffers()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffers_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::tuple<int64_t, int64_t, bool>, std::unique_ptr<CoreClock>> clocks_;
+    std::map<std::string, std::pair<uintptr_t, uint64_t>> buffers_;
+    std::atomic<uint64_t> generation_{0};
+};
+
+// Clock of the core run by the calling thread, cached until the thread switches cores or the timeline is reset.
+inline CoreClock &CurrentClock()
+{
+    struct Cache {
+        CoreClock *clock = nullptr;
+        std::tuple<int64_t, int64_t, bool> key;
+        uint64_t generation = 0;
+    };
+    thread_local Cache cache;
+    const CoreContext &core = CurrentCore();
+    const auto key = std::make_tuple(core.blockIdx, core.subblockId, core.isCube);
+    Timeline &timeline = Timeline::Instance();
+    if (cache.clock == nullptr || cache.key != key || cache.generation != timeline.Generation()) {
+        cache.clock = &timeline.Clock(core);
+        cache.key = key;
+        cache.generation = timeline.Generation();
+    }
+    return *cache.clock;
+}
+} // namespace detail
+
+inline void set_timeline(bool enable)
+{
+    detail::TimelineEnabled().store(enable, std::memory_order_relaxed);
+}
+
+inline bool timeline_enabled()
+{
+    return detail::TimelineEnabled().load(std::memory_order_relaxed);
+}
+
+// Selects the architecture the timeline models. Call while no kernel is running.
+inline void set_cost_model(const PipeCostModel &model)
+{
+    detail::CurrentCostModel() = model;
+}
+
+inline const PipeCostModel &cost_model()
+{
+    return detail::CurrentCostModel();
+}
+
+// Drops every core's timeline and restarts the clocks at cycle 0. Call while no kernel is running.
+inline void reset_timeline()
+{
+    detail::Timeline::Instance().Clear();
+}
+
+// Names a global buffer so pipeline logs can attribute the transfers that touch it (device_addrs.toml).
+inline void timeline_register_buffer(const std::string &name, const void *addr, uint64_t bytes)
+{
+    detail::Timeline::Instance().RegisterBuffer(name, reinterpret_cast<uintptr_t>(addr), bytes);
+}
+
+// Every event modelled so far, ordered by core, then start cycle.
+inline std::vector<TimelineEvent> timeline_events()
+{
+    std::vector<TimelineEvent> events = detail::Timeline::Instance().Snapshot();
+    std::stable_sort(events.begin(), events.end(), [](const TimelineEvent &a, const TimelineEvent &b) {
+        return std::tie(a.core, a.cube, a.subblock, a.startCycle) < std::tie(b.core, b.cube, b.subblock, b.startCycle);
+    });
+    return events;
+}
+
+// Busy cycles of every pipe that ran an instruction, per core, against the core's last completion cycle.
+inline std::vector<PipeUtilization> timeline_utilization()
+{
+    std::map<std::tuple<int64_t, bool, int64_t>, uint64_t> spans;
+    std::map<std::tuple<int64_t, bool, int64_t, pipe_t>, PipeUtilization> pipes;
+    for (const TimelineEvent &e : timeline_events()) {
+        uint64_t &span = spans[std::make_tuple(e.core, e.cube, e.subblock)];
+        span = std::max(span, e.endCycle);
+        if (e.sync) {
+            continue;
+        }
+        PipeUtilization &u = pipes[std::make_tuple(e.core, e.cube, e.subblock, e.pipe)];
+        u = PipeUtilization{e.core, e.subblock, e.cube, e.pipe, u.instrs + 1,
+                            u.busyCycles + (e.endCycle - e.startCycle), 0};
+    }
+    std::vector<PipeUtilization> result;
+    for (auto &[key, u] : pipes) {
+        u.spanCycles = spans[std::make_tuple(u.core, u.cube, u.subblock)];
+        result.push_back(u);
+    }
+    return result;
+}
+
+inline void write_timeline_summary(std::ostream &out)
+{
+    const PipeCostModel &model = cost_model();
+    out << "pipe timeline (" << model.name << " cost model, " << model.clockGHz << " GHz)\n";
+    out << std::left << std::setw(14) << "core" << std::setw(8) << "pipe" << std::right << std::setw(10) << "instrs"
+        << std::setw(14) << "busy cycles" << std::setw(14) << "span cycles" << std::setw(10) << "util %"
+        << std::setw(12) << "span us" << '\n';
+    for (const PipeUtilization &u : timeline_utilization()) {
+        const std::string core =
+            "core" + std::to_string(u.core) + (u.cube ? ".cube" : ".vec" + std::to_string(u.subblock));
+        const double util = u.spanCycles == 0 ? 0.0 : 100.0 * static_cast<double>(u.busyCycles) / u.spanCycles;
+        out << std::left << std::setw(14) << core << std::setw(8) << detail::PipeLogName(u.pipe) << std::right
+            << std::setw(10) << u.instrs << std::setw(14) << u.busyCycles << std::setw(14) << u.spanCycles
+            << std::fixed << std::setprecision(1) << std::setw(10) << util << std::setprecision(3) << std::setw(12)
+            << static_cast<double>(u.spanCycles) / (model.clockGHz * 1e3) << '\n';
+    }
+}
+
+// Writes the timeline as device-style instruction logs, one pair per core, for
+// kernels/manual/common/flash_atten/scripts/pipeline_log_analysis.py: core<b>.cubecore0 / core<b>.veccore<s>
+// .instr_popped_log.dump holds start cycles, .instr_log.dump completion cycles, paired by id. Registered buffers go
+// to device_addrs.toml.
+inline bool write_pipeline_logs(const std::string &dir)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    std::map<std::string, std::vector<TimelineEvent>> byCore;
+    for (TimelineEvent &e : timeline_events()) {
+        const std::string core = "core" + std::to_string(e.core) +
+                                 (e.cube ? ".cubecore0" : ".veccore" + std::to_string(e.subblock));
+        byCore[core].push_back(std::move(e));
+    }
+    // The analysis script takes a cube and a vector log of every core; a kernel may only use one kind.
+    std::vector<std::string> blocks;
+    for (const auto &entry : byCore) {
+        blocks.push_back(entry.first.substr(0, entry.first.find('.')));
+    }
+    for (const std::string &block : blocks) {
+        byCore[block + ".cubecore0"];
+        byCore[block + ".veccore0"];
+    }
+    auto writeLog = [](const std::string &path, std::vector<TimelineEvent> &events, bool atEnd) {
+        std::stable_sort(events.begin(), events.end(), [atEnd](const TimelineEvent &a, const TimelineEvent &b) {
+            return atEnd ? a.endCycle < b.endCycle : a.startCycle < b.startCycle;
+        });
+        std::ofstream out(path);
+        char line[256];
+        for (const TimelineEvent &e : events) {
+            std::snprintf(line, sizeof(line),
+                          "[%llu] (PC: 0x%llx) %s : (0x00000000) %s id:%llu Src:0x%llx Dst:0x%llx\n",
+                          static_cast<unsigned long long>(atEnd ? e.endCycle : e.startCycle),
+                          static_cast<unsigned long long>(e.id * 4), detail::PipeLogName(e.pipe), e.mnemonic.c_str(),
+                          static_cast<unsigned long long>(e.id), static_cast<unsigned long long>(e.src),
+                          static_cast<unsigned long long>(e.dst));
+            out << line;
+        }
+        return static_cast<bool>(out);
+    };
+    bool ok = !ec;
+    for (auto &[core, events] : byCore) {
+        ok = writeLog(dir + "/" + core + ".instr_popped_log.dump", events, false) && ok;
+        ok = writeLog(dir + "/" + core + ".instr_log.dump", events, true) && ok;
+    }
+    std::ofstream addrs(dir + "/device_addrs.toml");
+    for (const auto &[name, range] : detail::Timeline::Instance().Buffers()) {
+        addrs << "[\"" << name << "\"]\naddr = \"0x" << std::hex << range.first << std::dec
+              << "\"\nsize_bytes = " << range.second << "\n\n";
+    }
+    return ok && static_cast<bool>(addrs);
+}
+
+namespace detail {
+// Writes the PTO_CPU_TIMELINE logs when the process exits.
+struct TimelineAtExit {
+    ~TimelineAtExit()
+    {
+        const char *dir = std::getenv("PTO_CPU_TIMELINE");
+        if (dir != nullptr && dir[0] != '\0' && !(dir[0] == '1' && dir[1] == '\0')) {
+            write_pipeline_logs(dir);
+            write_timeline_summary(std::cerr);
+        }
+    }
+};
+
+inline void ArmTimelineAtExit()
+{
+    static TimelineAtExit atExit;
+}
+
+// Places one instruction issued by the calling thread on its core's timeline.
+template <typename... Args>
+void TimelineInstr(const char *name, pipe_t pipe, const Args &...args)
+{
+    if (TimelineNesting() > 0) {
+        return;
+    }
+    CoreClock &clock = CurrentClock();
+    // After the timeline singleton exists, so the exit hook is destroyed first and still sees every clock.
+    ArmTimelineAtExit();
+    clock.Instr(CurrentCostModel(), pipe, name, DescribeWork(args...));
+}
+
+inline void TimelineSetFlag(pipe_t src, pipe_t dst, event_t id)
+{
+    if (TimelineNesting() == 0) {
+        CurrentClock().SetFlag(src, dst, id);
+    }
+}
+
+inline void TimelineWaitFlag(pipe_t src, pipe_t dst, event_t id)
+{
+    if (TimelineNesting() == 0) {
+        CurrentClock().WaitFlag(src, dst, id);
+    }
+}
+
+inline void TimelineBarrier(pipe_t pipe)
+{
+    if (TimelineNesting() == 0) {
+        CurrentClock().Barrier(pipe);
+    }
+}
+} // namespace detail
+} // namespace pto::cpu
+
+#endif
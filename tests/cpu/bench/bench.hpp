@@ -0,0 +1,77 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#ifndef PTO_CPU_BENCH_HPP
+#define PTO_CPU_BENCH_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pto/pto-inst.hpp>
+
+// pto_cpu_bench: per-instruction microbenchmarks of the CPU simulator. Every case runs one instruction (or one
+// collective) on a fixed shape, dtype and layout; the driver sweeps the cases over thread counts and reports
+// GB/s and GFLOP/s.
+namespace pto::bench {
+struct Case {
+    std::string name;  // <instr>/<dtype>/<rows>x<cols>[/<layout>]
+    std::string group; // elementwise, reduce, expand, memory, cube, sort, gather, comm
+    uint64_t bytes;    // bytes read plus bytes written by one call
+    uint64_t flops;    // arithmetic operations of one call, 0 for data movement
+    bool threaded;     // runs on the parallel_for pool, so its time depends on the thread count
+    std::function<void(uint64_t iters)> run;
+};
+
+inline std::vector<Case> &Registry()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+inline void AddCase(Case c)
+{
+    Registry().push_back(std::move(c));
+}
+
+void RegisterVectorCases();
+void RegisterMemoryCases();
+void RegisterCubeCases();
+void RegisterCommCases();
+
+template <typename T>
+std::string CaseName(const char *instr, int rows, int cols, const char *layout = nullptr)
+{
+    std::string name = std::string(instr) + "/" + cpu::detail::DTypeName<T>() + "/" + std::to_string(rows) + "x" +
+                       std::to_string(cols);
+    return layout == nullptr ? name : name + "/" + layout;
+}
+
+// Fills every element of a tile, padding included, with small positive values so exp, div and sqrt stay finite.
+template <typename TileData>
+void FillTile(TileData &tile)
+{
+    using T = typename TileData::DType;
+    for (int i = 0; i < TileData::Rows * TileData::Cols; ++i) {
+        tile.data()[i] = static_cast<T>(1 + (i % 7) * 0.125f);
+    }
+}
+
+// Keeps the compiler from dropping a benchmarked call whose result is never read.
+template <typename T>
+void KeepAlive(const T *p)
+{
+    asm volatile("" : : "g"(p) : "memory");
+}
+} // namespace pto::bench
+
+#endif
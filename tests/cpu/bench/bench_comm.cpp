@@ -0,0 +1,112 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "bench.hpp"
+
+// Comm cases: collectives across thread ranks. Each run launches the ranks once and repeats the collective, so the
+// launch cost is amortized over the iterations. Ranks are threads of their own, so these cases ignore the
+// parallel_for thread count.
+namespace pto::bench {
+namespace {
+using namespace pto::comm;
+
+constexpr int kRanks = 4;
+constexpr int kMaxRanks = 16;
+constexpr std::size_t kWindowBytes = 4 << 20;
+using SignalBlock = GlobalTensor<int32_t, Shape<1, 1, 1, 1, 2 * kMaxRanks>, Stride<1, 1, 1, 2 * kMaxRanks, 1>>;
+using StageTile = Tile<TileType::Vec, float, 16, 64, BLayout::RowMajor, -1, -1>;
+
+template <int R, int C>
+struct CommSetup {
+    using Global = GlobalTensor<float, Shape<1, 1, 1, R, C>, Stride<1, 1, 1, C, 1>>;
+
+    explicit CommSetup(cpu::RankContext &ctx)
+    {
+        float *srcLocal = ctx.Alloc<float>(R * C);
+        float *dstLocal = ctx.Alloc<float>(R * C);
+        int32_t *sigLocal = ctx.Alloc<int32_t>(CollectiveSignalWords(kMaxRanks));
+        for (int i = 0; i < R * C; ++i) {
+            srcLocal[i] = static_cast<float>(i % 13);
+        }
+        ctx.PeerTensors(src, srcLocal, [](float *p) { return Global(p); });
+        ctx.PeerTensors(dst, dstLocal, [](float *p) { return Global(p); });
+        ctx.PeerTensors(sig, sigLocal, [](int32_t *p) { return SignalBlock(p); });
+    }
+
+    Global src[kMaxRanks];
+    Global dst[kMaxRanks];
+    SignalBlock sig[kMaxRanks];
+};
+
+const char *AlgoName(CollectiveAlgo algo)
+{
+    switch (algo) {
+        case CollectiveAlgo::Ring:
+            return "ring";
+        case CollectiveAlgo::Tree:
+            return "tree";
+        default:
+            return "direct";
+    }
+}
+
+// Bytes are the per-rank payload counted once for every rank, the usual "algorithm bandwidth" of a collective.
+template <int R, int C>
+void AddAllReduce(CollectiveAlgo algo)
+{
+    const std::string layout = std::to_string(kRanks) + "ranks/" + AlgoName(algo);
+    const uint64_t elems = static_cast<uint64_t>(R) * C;
+    AddCase({CaseName<float>("TALLREDUCE", R, C, layout.c_str()), "comm", elems * sizeof(float) * kRanks,
+             elems * (kRanks - 1), false, [algo](uint64_t iters) {
+                 cpu::LaunchRanks(kRanks, kWindowBytes, cpu::RankMode::Thread, [algo, iters](cpu::RankContext &ctx) {
+                     CommSetup<R, C> setup(ctx);
+                     ParallelGroup<SignalBlock> signals(setup.sig, ctx.Size(), ctx.Rank());
+                     ParallelGroup<typename CommSetup<R, C>::Global> srcGroup(setup.src, ctx.Size(), ctx.Rank());
+                     ParallelGroup<typename CommSetup<R, C>::Global> dstGroup(setup.dst, ctx.Size(), ctx.Rank());
+                     StageTile acc(16, 64);
+                     StageTile ping(16, 64);
+                     StageTile pong(16, 64);
+                     for (uint64_t i = 0; i < iters; ++i) {
+                         TALLREDUCE(srcGroup, dstGroup, signals, ctx.Rank(), acc, ping, pong, ReduceOp::Sum, algo);
+                     }
+                 });
+             }});
+}
+
+template <int R, int C>
+void AddBroadcast(CollectiveAlgo algo)
+{
+    const std::string layout = std::to_string(kRanks) + "ranks/" + AlgoName(algo);
+    const uint64_t elems = static_cast<uint64_t>(R) * C;
+    AddCase({CaseName<float>("TBROADCAST", R, C, layout.c_str()), "comm", elems * sizeof(float) * kRanks, 0, false,
+             [algo](uint64_t iters) {
+                 cpu::LaunchRanks(kRanks, kWindowBytes, cpu::RankMode::Thread, [algo, iters](cpu::RankContext &ctx) {
+                     CommSetup<R, C> setup(ctx);
+                     ParallelGroup<SignalBlock> signals(setup.sig, ctx.Size(), ctx.Rank());
+                     ParallelGroup<typename CommSetup<R, C>::Global> group(setup.dst, ctx.Size(), 0);
+                     StageTile ping(16, 64);
+                     StageTile pong(16, 64);
+                     for (uint64_t i = 0; i < iters; ++i) {
+                         TBROADCAST(group, setup.src[ctx.Rank()], signals, ctx.Rank(), ping, pong, algo);
+                     }
+                 });
+             }});
+}
+} // namespace
+
+void RegisterCommCases()
+{
+    for (CollectiveAlgo algo : {CollectiveAlgo::Ring, CollectiveAlgo::Tree, CollectiveAlgo::Direct}) {
+        AddAllReduce<64, 256>(algo);
+        AddAllReduce<256, 256>(algo);
+        AddBroadcast<256, 256>(algo);
+    }
+}
+} // namespace pto::bench
@@ -0,0 +1,99 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "bench.hpp"
+
+#include <memory>
+
+// Cube cases: TMATMUL and TMATMUL_MX on L0A/L0B fractal tiles into an L0C accumulator.
+namespace pto::bench {
+namespace {
+template <typename In, typename Out, int M, int K, int N>
+void AddMatmul()
+{
+    struct Tiles {
+        Tiles()
+        {
+            FillTile(left);
+            FillTile(right);
+        }
+
+        TileLeft<In, M, K, M, K> left;
+        TileRight<In, K, N, K, N> right;
+        TileAcc<Out, M, N, M, N> acc;
+    };
+    auto tiles = std::make_shared<Tiles>();
+    const uint64_t bytes = (static_cast<uint64_t>(M) * K + static_cast<uint64_t>(K) * N) * sizeof(In) +
+                           static_cast<uint64_t>(M) * N * sizeof(Out);
+    AddCase({CaseName<In>("TMATMUL", M, N, ("k" + std::to_string(K)).c_str()), "cube", bytes, 2ull * M * N * K, true,
+             [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TMATMUL(tiles->acc, tiles->left, tiles->right);
+                 }
+                 KeepAlive(tiles->acc.data());
+             }});
+}
+
+// Fills an MX element or scale tile with raw codes: small normal fp8/fp4 values and e8m0 scales near 2^0.
+template <typename TileData>
+void FillMxTile(TileData &tile, unsigned char code)
+{
+    constexpr int perByte = static_cast<int>(MxFormat<typename TileData::DType>::elementsPerByte);
+    constexpr int bytes = TileData::Rows * TileData::Cols / perByte;
+    for (int i = 0; i < bytes; ++i) {
+        tile.data()[i].bits = static_cast<unsigned char>(code + i % 3);
+    }
+}
+
+template <typename In, int M, int K, int N>
+void AddMatmulMx(unsigned char code)
+{
+    struct Tiles {
+        explicit Tiles(unsigned char code)
+        {
+            FillMxTile(left, code);
+            FillMxTile(right, code);
+            FillMxTile(leftScale, 126);
+            FillMxTile(rightScale, 126);
+        }
+
+        TileLeft<In, M, K, M, K> left;
+        TileRight<In, K, N, K, N> right;
+        TileLeftScale<float8_e8m0_t, M, K / MX_SCALE_BLOCK, M, K / MX_SCALE_BLOCK> leftScale;
+        TileRightScale<float8_e8m0_t, K / MX_SCALE_BLOCK, N, K / MX_SCALE_BLOCK, N> rightScale;
+        TileAcc<float, M, N, M, N> acc;
+    };
+    auto tiles = std::make_shared<Tiles>(code);
+    constexpr uint64_t perByte = MxFormat<In>::elementsPerByte;
+    const uint64_t bytes = (static_cast<uint64_t>(M) * K + static_cast<uint64_t>(K) * N) / perByte +
+                           (static_cast<uint64_t>(M) + N) * (K / MX_SCALE_BLOCK) + static_cast<uint64_t>(M) * N * 4;
+    AddCase({CaseName<In>("TMATMUL_MX", M, N, ("k" + std::to_string(K)).c_str()), "cube", bytes, 2ull * M * N * K,
+             true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TMATMUL_MX(tiles->acc, tiles->left, tiles->leftScale, tiles->right, tiles->rightScale);
+                 }
+                 KeepAlive(tiles->acc.data());
+             }});
+}
+} // namespace
+
+void RegisterCubeCases()
+{
+    AddMatmul<half, float, 32, 32, 32>();
+    AddMatmul<half, float, 64, 64, 64>();
+    AddMatmul<half, float, 128, 128, 128>();
+    AddMatmul<float, float, 32, 32, 32>();
+    AddMatmul<float, float, 64, 64, 64>();
+    AddMatmul<float, float, 128, 128, 128>();
+    AddMatmul<int8_t, int32_t, 64, 64, 64>();
+    AddMatmulMx<float8_e4m3_t, 128, 128, 256>(0x30);
+    AddMatmulMx<float4_e2m1x2_t, 256, 256, 256>(0x23);
+}
+} // namespace pto::bench
@@ -0,0 +1,254 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+// Usage: pto_cpu_bench [--list] [--filter REGEX] [--threads 1,4,...] [--min-time MS] [--json OUT]
+//                      [--baseline FILE] [--tolerance FRACTION]
+//
+// Every selected case runs once per thread count: one warmup call, an iteration count calibrated so that a batch
+// takes at least --min-time, then the median of kBatches batches. --json writes one result object per line;
+// --baseline compares against such a file and exits with status 1 when a case is slower by more than --tolerance.
+namespace {
+using pto::bench::Case;
+using Clock = std::chrono::steady_clock;
+
+constexpr int kBatches = 5;
+
+struct Options {
+    std::string filter = ".*";
+    std::vector<unsigned> threads;
+    double minTimeMs = 50.0;
+    std::string jsonPath;
+    std::string baselinePath;
+    double tolerance = 0.15;
+    bool list = false;
+};
+
+struct Result {
+    std::string name;
+    std::string group;
+    unsigned threads;
+    double ns;
+    double gbps;
+    double gflops;
+};
+
+[[noreturn]] void Usage(const char *msg)
+{
+    std::cerr << "pto_cpu_bench: " << msg << "\n"
+              << "usage: pto_cpu_bench [--list] [--filter REGEX] [--threads 1,4,...] [--min-time MS] [--json OUT]\n"
+              << "                     [--baseline FILE] [--tolerance FRACTION]\n";
+    std::exit(2);
+}
+
+std::vector<unsigned> ParseThreads(const std::string &text)
+{
+    std::vector<unsigned> threads;
+    std::stringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        const unsigned long n = std::strtoul(item.c_str(), nullptr, 10);
+        if (n == 0) {
+            Usage("--threads takes a comma-separated list of positive counts");
+        }
+        threads.push_back(static_cast<unsigned>(n));
+    }
+    return threads;
+}
+
+Options ParseOptions(int argc, char **argv)
+{
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                Usage(("missing value for " + arg).c_str());
+            }
+            return argv[++i];
+        };
+        if (arg == "--list") {
+            opt.list = true;
+        } else if (arg == "--filter") {
+            opt.filter = value();
+        } else if (arg == "--threads") {
+            opt.threads = ParseThreads(value());
+        } else if (arg == "--min-time") {
+            opt.minTimeMs = std::strtod(value().c_str(), nullptr);
+        } else if (arg == "--json") {
+            opt.jsonPath = value();
+        } else if (arg == "--baseline") {
+            opt.baselinePath = value();
+        } else if (arg == "--tolerance") {
+            opt.tolerance = std::strtod(value().c_str(), nullptr);
+        } else {
+            Usage(("unknown option " + arg).c_str());
+        }
+    }
+    if (opt.threads.empty()) {
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        opt.threads = hw > 1 ? std::vector<unsigned>{1, hw} : std::vector<unsigned>{1};
+    }
+    return opt;
+}
+
+double TimeBatch(const Case &c, uint64_t iters)
+{
+    const auto start = Clock::now();
+    c.run(iters);
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+Result Measure(const Case &c, unsigned threads, double minTimeMs)
+{
+    c.run(1);
+    const double minNs = minTimeMs * 1e6;
+    uint64_t iters = 1;
+    double ns = TimeBatch(c, iters);
+    while (ns < minNs && iters < (1ull << 40)) {
+        // Grow toward the target with some headroom, at most 100x per step so one noisy sample cannot overshoot.
+        const double scale = ns <= 0.0 ? 100.0 : std::min(100.0, std::max(2.0, 1.2 * minNs / ns));
+        iters = static_cast<uint64_t>(iters * scale);
+        ns = TimeBatch(c, iters);
+    }
+    std::vector<double> perIter;
+    perIter.push_back(ns / iters);
+    for (int b = 1; b < kBatches; ++b) {
+        perIter.push_back(TimeBatch(c, iters) / iters);
+    }
+    std::nth_element(perIter.begin(), perIter.begin() + kBatches / 2, perIter.end());
+    const double median = perIter[kBatches / 2];
+    return {c.name, c.group, threads, median, c.bytes / median, c.flops / median};
+}
+
+std::string JsonLine(const Result &r)
+{
+    char buf[512];
+    std::snprintf(buf, sizeof(buf),
+                  "{\"name\": \"%s\", \"group\": \"%s\", \"threads\": %u, \"ns\": %.1f, \"gbps\": %.4f, "
+                  "\"gflops\": %.4f}",
+                  r.name.c_str(), r.group.c_str(), r.threads, r.ns, r.gbps, r.gflops);
+    return buf;
+}
+
+// Reads the ns of every (name, threads) pair from a file written by --json.
+std::map<std::pair<std::string, unsigned>, double> ReadBaseline(const std::string &path)
+{
+    std::ifstream in(path);
+    if (!in) {
+        Usage(("cannot read baseline " + path).c_str());
+    }
+    static const std::regex entry(R"re("name":\s*"([^"]*)".*"threads":\s*(\d+).*"ns":\s*([0-9.eE+-]+))re");
+    std::map<std::pair<std::string, unsigned>, double> baseline;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::smatch m;
+        if (std::regex_search(line, m, entry)) {
+            baseline[{m[1].str(), static_cast<unsigned>(std::stoul(m[2].str()))}] = std::stod(m[3].str());
+        }
+    }
+    return baseline;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const Options opt = ParseOptions(argc, argv);
+    pto::bench::RegisterVectorCases();
+    pto::bench::RegisterMemoryCases();
+    pto::bench::RegisterCubeCases();
+    pto::bench::RegisterCommCases();
+
+    std::regex filter;
+    try {
+        filter = std::regex(opt.filter);
+    } catch (const std::regex_error &) {
+        Usage("invalid --filter regex");
+    }
+    std::vector<const Case *> selected;
+    for (const Case &c : pto::bench::Registry()) {
+        if (std::regex_search(c.name, filter)) {
+            selected.push_back(&c);
+        }
+    }
+    if (opt.list) {
+        for (const Case *c : selected) {
+            std::printf("%-12s %s\n", c->group.c_str(), c->name.c_str());
+        }
+        return 0;
+    }
+
+    std::vector<Result> results;
+    std::printf("%-44s %7s %14s %10s %10s\n", "case", "threads", "ns/iter", "GB/s", "GFLOP/s");
+    for (const Case *c : selected) {
+        for (unsigned threads : opt.threads) {
+            // Cases that do not use the parallel_for pool only run once, under the first thread count.
+            if (!c->threaded && threads != opt.threads.front()) {
+                continue;
+            }
+            pto::cpu::set_thread_count(threads);
+            try {
+                results.push_back(Measure(*c, c->threaded ? threads : 1, opt.minTimeMs));
+            } catch (const std::exception &e) {
+                std::fprintf(stderr, "%s: %s\n", c->name.c_str(), e.what());
+                return 1;
+            }
+            const Result &r = results.back();
+            std::printf("%-44s %7u %14.1f %10.3f %10.3f\n", r.name.c_str(), r.threads, r.ns, r.gbps, r.gflops);
+            std::fflush(stdout);
+        }
+    }
+    pto::cpu::set_thread_count(0);
+
+    if (!opt.jsonPath.empty()) {
+        std::ofstream out(opt.jsonPath);
+        for (const Result &r : results) {
+            out << JsonLine(r) << "\n";
+        }
+        if (!out) {
+            std::fprintf(stderr, "pto_cpu_bench: cannot write %s\n", opt.jsonPath.c_str());
+            return 1;
+        }
+    }
+
+    if (opt.baselinePath.empty()) {
+        return 0;
+    }
+    const auto baseline = ReadBaseline(opt.baselinePath);
+    int regressions = 0;
+    for (const Result &r : results) {
+        const auto it = baseline.find({r.name, r.threads});
+        if (it == baseline.end()) {
+            continue;
+        }
+        const double change = r.ns / it->second - 1.0;
+        if (change > opt.tolerance) {
+            std::printf("REGRESSION %-44s %7u %+7.1f%% (%.1f -> %.1f ns)\n", r.name.c_str(), r.threads,
+                        change * 100.0, it->second, r.ns);
+            ++regressions;
+        }
+    }
+    std::printf("%d regression(s) against %s (tolerance %.0f%%)\n", regressions, opt.baselinePath.c_str(),
+                opt.tolerance * 100.0);
+    return regressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "bench.hpp"
+
+#include <memory>
+#include <vector>
+
+// TLOAD/TSTORE cases for every global layout and tile layout pair the CPU backend moves: ND <-> row-major tiles,
+// DN <-> column-major tiles, and ND -> Nz/Zn fractal tiles in L1.
+namespace pto::bench {
+namespace {
+template <typename T, int R, int C>
+using NDGlobal = GlobalTensor<T, Shape<1, 1, 1, R, C>, Stride<1, 1, 1, C, 1>>;
+
+template <typename T, int R, int C>
+using DNGlobal = GlobalTensor<T, Shape<1, 1, 1, R, C>, Stride<1, 1, 1, 1, R>, Layout::DN>;
+
+template <typename T, int R, int C>
+using RowTile = Tile<TileType::Vec, T, R, C, BLayout::RowMajor, -1, -1>;
+
+template <typename T, int R, int C>
+using ColTile = Tile<TileType::Vec, T, R, C, BLayout::ColMajor, -1, -1>;
+
+template <typename T, int R, int C>
+using NzTile = Tile<TileType::Mat, T, R, C, BLayout::ColMajor, -1, -1, SLayout::RowMajor, 512>;
+
+template <typename T, int R, int C>
+using ZnTile = Tile<TileType::Mat, T, R, C, BLayout::RowMajor, -1, -1, SLayout::ColMajor, 512>;
+
+template <typename TileData, typename GlobalData, bool store>
+void AddTransfer(const char *instr, const char *layout)
+{
+    using T = typename TileData::DType;
+    constexpr int R = TileData::Rows;
+    constexpr int C = TileData::Cols;
+    struct Buffers {
+        Buffers() : gm(static_cast<std::size_t>(R) * C, static_cast<T>(1.0f)), tile(R, C)
+        {
+            FillTile(tile);
+        }
+
+        std::vector<T> gm;
+        TileData tile;
+    };
+    auto buffers = std::make_shared<Buffers>();
+    AddCase({CaseName<T>(instr, R, C, layout), "memory", 2ull * R * C * sizeof(T), 0, true,
+             [buffers](uint64_t iters) {
+                 GlobalData global(buffers->gm.data());
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     if constexpr (store) {
+                         TSTORE(global, buffers->tile);
+                     } else {
+                         TLOAD(buffers->tile, global);
+                     }
+                 }
+                 KeepAlive(buffers->gm.data());
+                 KeepAlive(buffers->tile.data());
+             }});
+}
+
+template <typename T, int R, int C>
+void AddTransferShape()
+{
+    AddTransfer<RowTile<T, R, C>, NDGlobal<T, R, C>, false>("TLOAD", "ND");
+    AddTransfer<ColTile<T, R, C>, DNGlobal<T, R, C>, false>("TLOAD", "DN");
+    AddTransfer<NzTile<T, R, C>, NDGlobal<T, R, C>, false>("TLOAD", "ND2NZ");
+    AddTransfer<ZnTile<T, R, C>, NDGlobal<T, R, C>, false>("TLOAD", "ND2ZN");
+    AddTransfer<RowTile<T, R, C>, NDGlobal<T, R, C>, true>("TSTORE", "ND");
+    AddTransfer<ColTile<T, R, C>, DNGlobal<T, R, C>, true>("TSTORE", "DN");
+}
+} // namespace
+
+void RegisterMemoryCases()
+{
+    AddTransferShape<float, 64, 128>();
+    AddTransferShape<float, 128, 256>();
+    AddTransferShape<half, 64, 128>();
+    AddTransferShape<half, 128, 256>();
+}
+} // namespace pto::bench
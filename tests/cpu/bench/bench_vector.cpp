@@ -0,0 +1,220 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "bench.hpp"
+
+#include <memory>
+
+// Vector-pipe cases: elementwise, reductions, expands, sort/merge and gather/scatter.
+namespace pto::bench {
+namespace {
+template <typename T, int R, int C>
+using VecTile = Tile<TileType::Vec, T, R, C, BLayout::RowMajor, -1, -1>;
+
+// Tiles of a case live as long as its run function, so the timed loop only issues instructions.
+template <typename T, int R, int C>
+struct BinaryTiles {
+    BinaryTiles() : dst(R, C), src0(R, C), src1(R, C)
+    {
+        FillTile(src0);
+        FillTile(src1);
+    }
+
+    VecTile<T, R, C> dst;
+    VecTile<T, R, C> src0;
+    VecTile<T, R, C> src1;
+};
+
+template <typename T, int R, int C, typename Op>
+void AddElementwise(const char *instr, int operands, Op op)
+{
+    constexpr uint64_t elems = static_cast<uint64_t>(R) * C;
+    auto tiles = std::make_shared<BinaryTiles<T, R, C>>();
+    AddCase({CaseName<T>(instr, R, C), "elementwise", (operands + 1) * elems * sizeof(T), elems, true,
+             [tiles, op](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     op(*tiles);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+}
+
+template <typename T, int R, int C>
+void AddElementwiseShape()
+{
+    using Tiles = BinaryTiles<T, R, C>;
+    AddElementwise<T, R, C>("TADD", 2, [](Tiles &t) { TADD(t.dst, t.src0, t.src1); });
+    AddElementwise<T, R, C>("TMUL", 2, [](Tiles &t) { TMUL(t.dst, t.src0, t.src1); });
+    if constexpr (!std::is_integral_v<T>) {
+        AddElementwise<T, R, C>("TDIV", 2, [](Tiles &t) { TDIV(t.dst, t.src0, t.src1); });
+        AddElementwise<T, R, C>("TADDS", 1, [](Tiles &t) { TADDS(t.dst, t.src0, static_cast<T>(0.5f)); });
+        AddElementwise<T, R, C>("TEXP", 1, [](Tiles &t) { TEXP(t.dst, t.src0); });
+        AddElementwise<T, R, C>("TSQRT", 1, [](Tiles &t) { TSQRT(t.dst, t.src0); });
+    }
+}
+
+template <typename T, int R, int C>
+void AddReduceShape()
+{
+    constexpr uint64_t elems = static_cast<uint64_t>(R) * C;
+    auto tiles = std::make_shared<BinaryTiles<T, R, C>>();
+    auto colSum = std::make_shared<VecTile<T, 1, C>>(1, C);
+    AddCase({CaseName<T>("TROWSUM", R, C), "reduce", (elems + R) * sizeof(T), elems, true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TROWSUM(tiles->dst, tiles->src0, tiles->src1);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+    AddCase({CaseName<T>("TROWMAX", R, C), "reduce", (elems + R) * sizeof(T), elems, true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TROWMAX(tiles->dst, tiles->src0, tiles->src1);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+    AddCase({CaseName<T>("TCOLSUM", R, C), "reduce", (elems + C) * sizeof(T), elems, true,
+             [tiles, colSum](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TCOLSUM(*colSum, tiles->src0);
+                 }
+                 KeepAlive(colSum->data());
+             }});
+}
+
+template <typename T, int R, int C>
+void AddExpandShape()
+{
+    constexpr uint64_t elems = static_cast<uint64_t>(R) * C;
+    auto tiles = std::make_shared<BinaryTiles<T, R, C>>();
+    AddCase({CaseName<T>("TEXPANDS", R, C), "expand", elems * sizeof(T), 0, true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TEXPANDS(tiles->dst, static_cast<T>(1.0f));
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+    AddCase({CaseName<T>("TROWEXPAND", R, C), "expand", (elems + R) * sizeof(T), 0, true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TROWEXPAND(tiles->dst, tiles->src0);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+    AddCase({CaseName<T>("TCOLEXPAND", R, C), "expand", (elems + C) * sizeof(T), 0, true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TCOLEXPAND(tiles->dst, tiles->src0);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+}
+
+// TSORT32 sorts every 32-element block into (value, index) pairs; TMRGSORT then merges runs of blockLen.
+template <int R, int C>
+void AddSortShape()
+{
+    constexpr uint64_t elems = static_cast<uint64_t>(R) * C;
+    struct SortTiles {
+        SortTiles() : src(R, C), idx(R, C), sorted(R, 2 * C), merged(1, 2 * R * C), runs(1, 2 * R * C)
+        {
+            FillTile(src);
+            for (int i = 0; i < R * C; ++i) {
+                idx.data()[i] = static_cast<uint32_t>(i);
+            }
+            // Four runs of R * C / 4 sorted (value, index) pairs.
+            for (int i = 0; i < R * C; ++i) {
+                runs.data()[2 * i] = static_cast<float>(R * C - i % (R * C / 4));
+                runs.data()[2 * i + 1] = static_cast<float>(i);
+            }
+        }
+
+        VecTile<float, R, C> src;
+        VecTile<uint32_t, R, C> idx;
+        VecTile<float, R, 2 * C> sorted;
+        VecTile<float, 1, 2 * R * C> merged;
+        VecTile<float, 1, 2 * R * C> runs;
+    };
+    auto tiles = std::make_shared<SortTiles>();
+    AddCase({CaseName<float>("TSORT32", R, C), "sort", elems * (2 * sizeof(float) + sizeof(uint32_t)),
+             elems * 5, true, [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TSORT32(tiles->sorted, tiles->src, tiles->idx);
+                 }
+                 KeepAlive(tiles->sorted.data());
+             }});
+    AddCase({CaseName<float>("TMRGSORT", 1, R * C, "4runs"), "sort", elems * 4 * sizeof(float), elems * 2, true,
+             [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TMRGSORT(tiles->merged, tiles->runs, static_cast<uint32_t>(R * C / 4 * 2));
+                 }
+                 KeepAlive(tiles->merged.data());
+             }});
+}
+
+template <typename T, int R, int C>
+void AddGatherShape()
+{
+    constexpr uint64_t elems = static_cast<uint64_t>(R) * C;
+    struct GatherTiles {
+        GatherTiles() : src(R, C), dst(R, C), flatIdx(R, C), rowIdx(R, C)
+        {
+            FillTile(src);
+            for (int i = 0; i < R * C; ++i) {
+                // A fixed stride through the source, so consecutive reads do not hit consecutive addresses.
+                flatIdx.data()[i] = static_cast<int32_t>((static_cast<int64_t>(i) * 97) % (R * C));
+                rowIdx.data()[i] = static_cast<uint16_t>(R - 1 - i / C);
+            }
+        }
+
+        VecTile<T, R, C> src;
+        VecTile<T, R, C> dst;
+        VecTile<int32_t, R, C> flatIdx;
+        VecTile<uint16_t, R, C> rowIdx;
+    };
+    auto tiles = std::make_shared<GatherTiles>();
+    AddCase({CaseName<T>("TGATHER", R, C, "index"), "gather", elems * (2 * sizeof(T) + sizeof(int32_t)), 0, true,
+             [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TGATHER(tiles->dst, tiles->src, tiles->flatIdx);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+    AddCase({CaseName<T>("TSCATTER", R, C, "rows"), "gather", elems * (2 * sizeof(T) + sizeof(uint16_t)), 0, true,
+             [tiles](uint64_t iters) {
+                 for (uint64_t i = 0; i < iters; ++i) {
+                     TSCATTER(tiles->dst, tiles->src, tiles->rowIdx);
+                 }
+                 KeepAlive(tiles->dst.data());
+             }});
+}
+} // namespace
+
+void RegisterVectorCases()
+{
+    AddElementwiseShape<float, 16, 64>();
+    AddElementwiseShape<float, 64, 128>();
+    AddElementwiseShape<float, 128, 256>();
+    AddElementwiseShape<half, 16, 64>();
+    AddElementwiseShape<half, 64, 128>();
+    AddElementwiseShape<half, 128, 256>();
+    AddElementwiseShape<int32_t, 64, 128>();
+    AddElementwiseShape<int32_t, 128, 256>();
+
+    AddReduceShape<float, 64, 128>();
+    AddReduceShape<float, 128, 256>();
+    AddReduceShape<half, 128, 256>();
+
+    AddExpandShape<float, 64, 128>();
+    AddExpandShape<float, 128, 256>();
+    AddExpandShape<half, 128, 256>();
+
+    AddSortShape<8, 32>();
+    AddSortShape<32, 64>();
+
+    AddGatherShape<float, 64, 128>();
+    AddGatherShape<float, 128, 256>();
+}
+} // namespace pto::bench
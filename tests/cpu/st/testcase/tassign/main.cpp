@@ -0,0 +1,42 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <gtest/gtest.h>
+#include "tassign_kernel.h"
+
+TEST(TAssign, Alias)
+{
+    ASSERT_TRUE(RunAssignAlias());
+}
+
+TEST(TAssign, Copies)
+{
+    ASSERT_TRUE(RunAssignCopies());
+}
+
+TEST(TAssign, Moves)
+{
+    ASSERT_TRUE(RunAssignMoves());
+}
+
+TEST(TAssign, PingPong)
+{
+    ASSERT_TRUE(RunAssignPingPong(false));
+}
+
+TEST(TAssign, PingPongAsyncPipes)
+{
+    ASSERT_TRUE(RunAssignPingPong(true));
+}
+
+TEST(TAssign, PerCore)
+{
+    ASSERT_TRUE(RunAssignPerCore());
+}
@@ -0,0 +1,172 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "tassign_kernel.h"
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+#include <barrier>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace pto;
+
+namespace {
+constexpr int kRows = 16;
+constexpr int kCols = 64;
+constexpr int kCount = kRows * kCols;
+constexpr std::size_t kTileBytes = kCount * sizeof(float);
+
+using GlobalData = GlobalTensor<float, Shape<1, 1, 1, kRows, kCols>, Stride<1, 1, 1, kCols, 1>>;
+using TileData = Tile<TileType::Vec, float, kRows, kCols>;
+
+bool AllEqual(const TileData &tile, float value)
+{
+    for (int i = 0; i < kCount; ++i) {
+        if (tile.data()[i] != value) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+bool RunAssignAlias()
+{
+    bool ok = false;
+    cpu::LaunchKernel(1, [&]() {
+        TileData a;
+        TileData b;
+        TileData c;
+        TileData unassigned;
+        TASSIGN(a, 0x0);
+        TASSIGN(b, 0x0);
+        TASSIGN(c, kTileBytes);
+        TEXPANDS(c, 2.0f);
+        TEXPANDS(unassigned, 3.0f);
+        TEXPANDS(a, 1.0f);
+        ok = a.data() == b.data() && AllEqual(b, 1.0f) && AllEqual(c, 2.0f) && AllEqual(unassigned, 3.0f);
+
+        // Straddles the second half of a and the first half of c.
+        TileData straddle;
+        TASSIGN(straddle, kTileBytes / 2);
+        TEXPANDS(straddle, 4.0f);
+        ok = ok && b.data()[0] == 1.0f && b.data()[kCount - 1] == 4.0f && c.data()[0] == 4.0f &&
+             c.data()[kCount - 1] == 2.0f;
+    });
+    return ok;
+}
+
+bool RunAssignCopies()
+{
+    TileData owner;
+    TEXPANDS(owner, 1.0f);
+    TileData ownerCopy(owner);
+    const bool copied = AllEqual(ownerCopy, 1.0f);
+    TEXPANDS(ownerCopy, 2.0f);
+
+    TileData view;
+    TASSIGN(view, 0x0);
+    TEXPANDS(view, 5.0f);
+    TileData viewCopy(view);
+    TEXPANDS(viewCopy, 6.0f);
+
+    // Tiles no longer carry their elements inline.
+    using LargeTile = Tile<TileType::Vec, float, 256, 256>;
+    return copied && AllEqual(owner, 1.0f) && AllEqual(ownerCopy, 2.0f) && viewCopy.data() == view.data() &&
+           AllEqual(view, 6.0f) && sizeof(LargeTile) < 64;
+}
+
+bool RunAssignMoves()
+{
+    static_assert(std::is_nothrow_move_constructible_v<TileData> && std::is_nothrow_move_assignable_v<TileData>);
+    TileData owner;
+    TEXPANDS(owner, 1.0f);
+    const float *elements = owner.data();
+    TileData moved(std::move(owner));
+    TileData assigned;
+    assigned = std::move(moved);
+
+    TileData view;
+    TASSIGN(view, 0x0);
+    const float *address = view.data();
+    TileData movedView(std::move(view));
+    return assigned.data() == elements && AllEqual(assigned, 1.0f) && movedView.data() == address;
+}
+
+bool RunAssignPingPong(bool asyncPipes)
+{
+    constexpr int kSlices = 8;
+    std::vector<float> in(kSlices * kCount);
+    std::vector<float> out(kSlices * kCount, 0.0f);
+    for (int i = 0; i < kSlices * kCount; ++i) {
+        in[i] = static_cast<float>(i);
+    }
+
+    cpu::set_async_pipes(asyncPipes);
+    cpu::LaunchKernel(1, [&]() {
+        TileData src[2];
+        TileData dst;
+        TASSIGN(src[0], 0x0);
+        TASSIGN(src[1], kTileBytes);
+        for (int s = 0; s < kSlices; ++s) {
+            const int buf = s % 2;
+            // dst alternates between two addresses by re-assignment.
+            TASSIGN(dst, (2 + buf) * kTileBytes);
+            GlobalData inGlobal(in.data() + s * kCount);
+            GlobalData outGlobal(out.data() + s * kCount);
+            if (s >= 2) {
+                wait_flag(PIPE_V, PIPE_MTE2, buf);
+            }
+            TLOAD(src[buf], inGlobal);
+            set_flag(PIPE_MTE2, PIPE_V, buf);
+            wait_flag(PIPE_MTE2, PIPE_V, buf);
+            TADDS(dst, src[buf], 1.0f);
+            set_flag(PIPE_V, PIPE_MTE2, buf);
+            set_flag(PIPE_V, PIPE_MTE3, buf);
+            wait_flag(PIPE_V, PIPE_MTE3, buf);
+            TSTORE(outGlobal, dst);
+        }
+        wait_flag(PIPE_V, PIPE_MTE2, 0);
+        wait_flag(PIPE_V, PIPE_MTE2, 1);
+    });
+    cpu::set_async_pipes(false);
+
+    for (int i = 0; i < kSlices * kCount; ++i) {
+        if (out[i] != in[i] + 1.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RunAssignPerCore()
+{
+    constexpr int kBlocks = 4;
+    std::vector<float> out(kBlocks * kCount, -1.0f);
+    std::barrier allFilled(kBlocks);
+    cpu::LaunchKernel(kBlocks, [&]() {
+        const int block = static_cast<int>(get_block_idx());
+        TileData tile;
+        TASSIGN(tile, 0x0);
+        TEXPANDS(tile, static_cast<float>(block));
+        // Every core has written its buffer before any of them reads it back.
+        allFilled.arrive_and_wait();
+        GlobalData outGlobal(out.data() + block * kCount);
+        TSTORE(outGlobal, tile);
+    });
+
+    for (int i = 0; i < kBlocks * kCount; ++i) {
+        if (out[i] != static_cast<float>(i / kCount)) {
+            return false;
+        }
+    }
+    return true;
+}
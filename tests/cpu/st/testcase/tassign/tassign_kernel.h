@@ -0,0 +1,29 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#pragma once
+
+// TASSIGN tests for the simulated on-chip buffers. Each returns false if tile storage did not behave as it does on
+// the device.
+
+// Test 1: tiles assigned to the same address alias, tiles at disjoint addresses and unassigned tiles do not
+bool RunAssignAlias();
+
+// Test 2: copies of an unassigned tile own their elements, copies of an assigned tile alias it
+bool RunAssignCopies();
+
+// Test 3: a load/add/store loop over ping-pong buffers, with a tile re-assigned every iteration
+bool RunAssignPingPong(bool asyncPipes);
+
+// Test 4: cores of one launch assign the same address without seeing each other's data
+bool RunAssignPerCore();
+
+// Test 5: moving a tile hands over its elements or its address instead of copying them
+bool RunAssignMoves();
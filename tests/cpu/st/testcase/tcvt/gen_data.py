@@ -16,6 +16,20 @@ import numpy as np
 np.random.seed(19)
 
 
+def narrow_with_mode(x, mode):
+    """float32 -> float16 with a directed rounding mode, saturating to the finite range."""
+    near = x.astype(np.float16)
+    back = near.astype(np.float32)
+    down = np.where(back > x, np.nextafter(near, np.float16(-np.inf)), near)
+    up = np.where(back < x, np.nextafter(near, np.float16(np.inf)), near)
+    if mode == "RoundMode::CAST_ODD":
+        odd_down = (down.view(np.uint16) & 1) == 1
+        result = np.where(back == x, near, np.where(odd_down, down, up))
+    else:
+        result = up
+    return np.clip(result.astype(np.float32), -65504, 65504).astype(np.float16)
+
+
 def gen_golden(param):
     m, n = param.m, param.n
 
@@ -33,6 +47,22 @@ def gen_golden(param):
                 golden = np.rint(x1_gm).astype(param.dsttype)
         else:
             golden = x1_gm.astype(param.dsttype)
+    elif param.mode == "RoundMode::CAST_ROUND":
+        x1_gm = np.concatenate([np.random.uniform(-300, 300, m * n - 4), [2.5, -2.5, 0.5, -1.5]])
+        x1_gm = x1_gm.astype(param.srctype).reshape(m, n)
+        rounded = np.where(x1_gm >= 0, np.floor(x1_gm + 0.5), np.ceil(x1_gm - 0.5))
+        info = np.iinfo(param.dsttype)
+        golden = np.clip(rounded, info.min, info.max).astype(param.dsttype)
+    elif param.mode == "RoundMode::CAST_TRUNC":
+        x1_gm = np.random.uniform(-70000, 70000, [m, n]).astype(param.srctype)
+        golden = np.trunc(x1_gm).astype(np.int64).astype(param.dsttype)
+    elif param.mode == "RoundMode::CAST_FLOOR":
+        x1_gm = np.random.uniform(-200, 200, [m, n]).astype(param.srctype)
+        golden = np.floor(x1_gm.astype(np.float32)).astype(np.int64).astype(param.dsttype)
+    else:
+        x1_gm = (np.random.standard_normal([m, n]) * 1000).astype(param.srctype)
+        x1_gm[0, :4] = [70000.0, -70000.0, 1.0 + 2.0 ** -12, 65504.5]
+        golden = narrow_with_mode(x1_gm, param.mode)
     x1_gm.tofile("./x1_gm.bin")
     golden.tofile("./golden.bin")
 
@@ -55,7 +85,12 @@ if __name__ == "__main__":
         "TCVTTest.case6",
         "TCVTTest.case7",
         "TCVTTest.case8",
-        "TCVTTest.case9"
+        "TCVTTest.case9",
+        "TCVTTest.case10",
+        "TCVTTest.case11",
+        "TCVTTest.case12",
+        "TCVTTest.case13",
+        "TCVTTest.case14"
     ]
 
     case_params_list = [
@@ -67,7 +102,12 @@ if __name__ == "__main__":
         TCvtParams(np.float32, np.int32, 4, 4096, "RoundMode::CAST_RINT"),
         TCvtParams(np.int16, np.float32, 64, 64, "RoundMode::CAST_RINT"),
         TCvtParams(np.float32, np.float16, 64, 64, "RoundMode::CAST_RINT"),
-        TCvtParams(np.float16, np.uint8, 64, 64, "RoundMode::CAST_RINT")
+        TCvtParams(np.float16, np.uint8, 64, 64, "RoundMode::CAST_RINT"),
+        TCvtParams(np.float32, np.int8, 32, 64, "RoundMode::CAST_ROUND"),
+        TCvtParams(np.float32, np.float16, 32, 64, "RoundMode::CAST_ODD"),
+        TCvtParams(np.float32, np.int16, 16, 128, "RoundMode::CAST_TRUNC"),
+        TCvtParams(np.float16, np.int8, 32, 64, "RoundMode::CAST_FLOOR"),
+        TCvtParams(np.float32, np.float16, 16, 64, "RoundMode::CAST_CEIL")
     ]
 
     for i, case_name in enumerate(case_name_list):
@@ -14,10 +14,17 @@ See LICENSE in the root of the software repository for the full text of the Lice
 
 using namespace std;
 using namespace PtoTestCommon;
+using namespace pto;
 
 template <typename D, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
 void launchTCVT(D *dst, S *src, void *stream);
 
+template <typename D, typename S, int kGRows_, int kGCols_, RoundMode kMode, SaturationMode kSat>
+void launchTCVTSat(D *dst, S *src, void *stream);
+
+template <typename D, typename S, int kGRows_, int kGCols_, RoundMode kMode>
+void launchTCVTDefaultSat(D *dst, S *src, void *stream);
+
 class TCVTTest : public testing::Test {
 protected:
     void SetUp() override
@@ -35,8 +42,8 @@ std::string GetGoldenDir()
     return fullPath;
 }
 
-template <typename D, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
-void test_tcvt()
+template <typename D, typename S, int kGRows_, int kGCols_, typename LaunchFn>
+void test_tcvt_with(LaunchFn launch)
 {
     uint32_t M = kGRows_;
     uint32_t N = kGCols_;
@@ -61,7 +68,7 @@ void test_tcvt()
     CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/x1_gm.bin", srcFileSize, srcHost, srcFileSize));
 
     aclrtMemcpy(srcDevice, srcFileSize, srcHost, srcFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
-    launchTCVT<D, S, kGRows_, kGCols_, kTRows_, kTCols_>(dstDevice, srcDevice, stream);
+    launch(dstDevice, srcDevice, stream);
 
     aclrtSynchronizeStream(stream);
     aclrtMemcpy(dstHost, dstFileSize, dstDevice, dstFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
@@ -88,6 +95,12 @@ void test_tcvt()
     EXPECT_TRUE(ret);
 }
 
+template <typename D, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
+void test_tcvt()
+{
+    test_tcvt_with<D, S, kGRows_, kGCols_>(launchTCVT<D, S, kGRows_, kGCols_, kTRows_, kTCols_>);
+}
+
 TEST_F(TCVTTest, case1)
 {
     test_tcvt<int32_t, float, 128, 128, 128, 128>();
@@ -131,4 +144,33 @@ TEST_F(TCVTTest, case8)
 TEST_F(TCVTTest, case9)
 {
     test_tcvt<uint8_t, aclFloat16, 64, 64, 64, 64>();
-}
\ No newline at end of file
+}
+
+TEST_F(TCVTTest, case10)
+{
+    test_tcvt_with<int8_t, float, 32, 64>(
+        launchTCVTSat<int8_t, float, 32, 64, RoundMode::CAST_ROUND, SaturationMode::ON>);
+}
+
+TEST_F(TCVTTest, case11)
+{
+    test_tcvt_with<aclFloat16, float, 32, 64>(
+        launchTCVTSat<aclFloat16, float, 32, 64, RoundMode::CAST_ODD, SaturationMode::ON>);
+}
+
+TEST_F(TCVTTest, case12)
+{
+    test_tcvt_with<int16_t, float, 16, 128>(
+        launchTCVTSat<int16_t, float, 16, 128, RoundMode::CAST_TRUNC, SaturationMode::OFF>);
+}
+
+TEST_F(TCVTTest, case13)
+{
+    test_tcvt_with<int8_t, aclFloat16, 32, 64>(launchTCVTDefaultSat<int8_t, aclFloat16, 32, 64, RoundMode::CAST_FLOOR>);
+}
+
+TEST_F(TCVTTest, case14)
+{
+    test_tcvt_with<aclFloat16, float, 16, 64>(
+        launchTCVTSat<aclFloat16, float, 16, 64, RoundMode::CAST_CEIL, SaturationMode::ON>);
+}
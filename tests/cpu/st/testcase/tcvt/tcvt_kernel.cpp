@@ -15,7 +15,8 @@ See LICENSE in the root of the software repository for the full text of the Lice
 using namespace std;
 using namespace pto;
 
-template <typename T, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
+template <typename T, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_, RoundMode kMode,
+          SaturationMode... kSat>
 __global__ AICORE void runTCVT(__gm__ T *out, __gm__ S *src)
 {
     using DynShapeDim4 = pto::Shape<1, 1, 1, kGRows_, kGCols_>;
@@ -41,7 +42,7 @@ __global__ AICORE void runTCVT(__gm__ T *out, __gm__ S *src)
     set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
     wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
 
-    TCVT(dstTile, srcTile, RoundMode::CAST_RINT);
+    TCVT(dstTile, srcTile, kMode, kSat...);
 
     set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
     wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
@@ -51,18 +52,37 @@ __global__ AICORE void runTCVT(__gm__ T *out, __gm__ S *src)
     out = dstGlobal.data();
 }
 
-template <typename D, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
-void launchTCVT(D *dst, S *src, void *stream)
+template <typename D, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_, RoundMode kMode,
+          SaturationMode... kSat>
+void launchTCVTMode(D *dst, S *src)
 {
     if constexpr (std::is_same_v<D, aclFloat16>) {
-        runTCVT<half, S, kGRows_, kGCols_, kTRows_, kTCols_>((half *)dst, src);
+        runTCVT<half, S, kGRows_, kGCols_, kTRows_, kTCols_, kMode, kSat...>((half *)dst, src);
     } else if constexpr (std::is_same_v<S, aclFloat16>) {
-        runTCVT<D, half, kGRows_, kGCols_, kTRows_, kTCols_>(dst, (half *)src);
+        runTCVT<D, half, kGRows_, kGCols_, kTRows_, kTCols_, kMode, kSat...>(dst, (half *)src);
     } else {
-        runTCVT<D, S, kGRows_, kGCols_, kTRows_, kTCols_>(dst, src);
+        runTCVT<D, S, kGRows_, kGCols_, kTRows_, kTCols_, kMode, kSat...>(dst, src);
     }
 }
 
+template <typename D, typename S, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
+void launchTCVT(D *dst, S *src, void *stream)
+{
+    launchTCVTMode<D, S, kGRows_, kGCols_, kTRows_, kTCols_, RoundMode::CAST_RINT>(dst, src);
+}
+
+template <typename D, typename S, int kGRows_, int kGCols_, RoundMode kMode, SaturationMode kSat>
+void launchTCVTSat(D *dst, S *src, void *stream)
+{
+    launchTCVTMode<D, S, kGRows_, kGCols_, kGRows_, kGCols_, kMode, kSat>(dst, src);
+}
+
+template <typename D, typename S, int kGRows_, int kGCols_, RoundMode kMode>
+void launchTCVTDefaultSat(D *dst, S *src, void *stream)
+{
+    launchTCVTMode<D, S, kGRows_, kGCols_, kGRows_, kGCols_, kMode>(dst, src);
+}
+
 template void launchTCVT<int32_t, float, 128, 128, 128, 128>(int32_t *dst, float *src, void *stream);
 template void launchTCVT<float, int32_t, 256, 64, 256, 64>(float *dst, int32_t *src, void *stream);
 template void launchTCVT<int16_t, float, 16, 32, 16, 32>(int16_t *dst, float *src, void *stream);
@@ -71,4 +91,17 @@ template void launchTCVT<int32_t, int16_t, 2, 512, 2, 512>(int32_t *dst, int16_t
 template void launchTCVT<int32_t, float, 4, 4096, 4, 4096>(int32_t *dst, float *src, void *stream);
 template void launchTCVT<float, int16_t, 64, 64, 64, 64>(float *dst, int16_t *src, void *stream);
 template void launchTCVT<aclFloat16, float, 64, 64, 64, 64>(aclFloat16 *dst, float *src, void *stream);
-template void launchTCVT<uint8_t, aclFloat16, 64, 64, 64, 64>(uint8_t *dst, aclFloat16 *src, void *stream);
\ No newline at end of file
+template void launchTCVT<uint8_t, aclFloat16, 64, 64, 64, 64>(uint8_t *dst, aclFloat16 *src, void *stream);
+template void launchTCVTSat<int8_t, float, 32, 64, RoundMode::CAST_ROUND, SaturationMode::ON>(int8_t *dst, float *src,
+                                                                                              void *stream);
+template void launchTCVTSat<aclFloat16, float, 32, 64, RoundMode::CAST_ODD, SaturationMode::ON>(aclFloat16 *dst,
+                                                                                                float *src,
+                                                                                                void *stream);
+template void launchTCVTSat<int16_t, float, 16, 128, RoundMode::CAST_TRUNC, SaturationMode::OFF>(int16_t *dst,
+                                                                                                 float *src,
+                                                                                                 void *stream);
+template void launchTCVTDefaultSat<int8_t, aclFloat16, 32, 64, RoundMode::CAST_FLOOR>(int8_t *dst, aclFloat16 *src,
+                                                                                     void *stream);
+template void launchTCVTSat<aclFloat16, float, 16, 64, RoundMode::CAST_CEIL, SaturationMode::ON>(aclFloat16 *dst,
+                                                                                                 float *src,
+                                                                                                 void *stream);
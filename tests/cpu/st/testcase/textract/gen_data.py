@@ -11,6 +11,7 @@
 # --------------------------------------------------------------------------------
 
 import os
+import struct
 import numpy as np
 
 print_C_case = True
@@ -47,6 +48,55 @@ class textractParams:
 def gen_case_name(param):
     return f"case_{type2str(param.src_type)}_{type2str(param.dst_type)}_{param.rows}_{param.cols}_{param.valid_rows}_{param.valid_cols}_IDX_{param.idx_row}_{param.idx_col}_L_{param.src_layout}_{param.dst_layout}"
 
+def quant_word(scale, int8_signed):
+    """QUANT_PRE word: M1 = top 19 bits of the fp32 scale, offset 0, bit 46 selects int8 (vs uint8) output."""
+    word = struct.unpack('<I', struct.pack('<f', scale))[0] & 0xFFFFE000
+    if int8_signed:
+        word |= 1 << 46
+    return word
+
+
+def fixpipe(acc, scales, relu, dst_type):
+    val = acc.astype(np.float32) * scales[None, :].astype(np.float32)
+    if relu:
+        val = np.maximum(val, 0)
+    if dst_type == np.int8:
+        return np.clip(np.clip(np.round(val), -256, 255), -128, 127).astype(np.int8)
+    if dst_type == np.float16:
+        return np.clip(val, -65504, 65504).astype(np.float16)
+    return val.astype(dst_type)
+
+
+def gen_acc_golden_data(param):
+    """C = A * B in the Acc tile, then the window of C at (idx_row, idx_col) through the fixpipe."""
+    m, k, n = param.m, param.k, param.n
+    x1_gm = np.random.randint(-4, 5, [m, k]).astype(param.src_type)
+    x2_gm = np.random.randint(-4, 5, [k, n]).astype(param.src_type)
+    acc_type = np.int32 if param.src_type == np.int8 else np.float32
+    acc = (x1_gm.astype(acc_type) @ x2_gm.astype(acc_type))[param.idx_row:, param.idx_col:]
+
+    dst_n = n - param.idx_col
+    if param.mode == "vector":
+        scales = np.random.choice([0.25, 0.5, 1.0, 2.0, 3.0], dst_n).astype(np.float32)
+    else:
+        scales = np.full(dst_n, param.scale, dtype=np.float32)
+    words = np.array([quant_word(s, param.dst_type == np.int8) for s in scales], dtype=np.uint64)
+
+    x1_gm.tofile("./x1_gm.bin")
+    x2_gm.tofile("./x2_gm.bin")
+    words.tofile("./quant_gm.bin")
+    fixpipe(acc, scales, param.relu, param.dst_type).tofile("./golden.bin")
+
+
+class textractAccParams:
+    def __init__(self, name, src_type, dst_type, m, k, n, idx_row, idx_col, mode, scale=1.0, relu=False):
+        self.name = name
+        self.src_type, self.dst_type = src_type, dst_type
+        self.m, self.k, self.n = m, k, n
+        self.idx_row, self.idx_col = idx_row, idx_col
+        self.mode, self.scale, self.relu = mode, scale, relu
+
+
 if __name__ == "__main__":
     case_params_list = [
         textractParams(np.float16, np.float16, 32, 32, 32, 32, 0, 0, 0, 0),
@@ -89,4 +139,23 @@ if __name__ == "__main__":
 
         os.chdir(original_dir)
 
+    acc_params_list = [
+        textractAccParams("case_acc_f32_to_f16_IDX_8_16", np.float16, np.float16, 40, 32, 48, 8, 16, "cast"),
+        textractAccParams("case_acc_relu_f32_IDX_16_16", np.float32, np.float32, 31, 16, 33, 16, 16, "cast",
+                          relu=True),
+        textractAccParams("case_acc_scalar_quant_s32_to_s8_IDX_16_32", np.int8, np.int8, 48, 64, 96, 16, 32,
+                          "scalar", 0.5),
+        textractAccParams("case_acc_vector_quant_relu_s32_to_f16_IDX_0_32", np.int8, np.float16, 32, 64, 96, 0, 32,
+                          "vector", relu=True),
+    ]
 
+    for acc_param in acc_params_list:
+        full_name = "TEXTRACTTest." + acc_param.name
+        if not os.path.exists(full_name):
+            os.makedirs(full_name)
+        original_dir = os.getcwd()
+        os.chdir(full_name)
+
+        gen_acc_golden_data(acc_param)
+
+        os.chdir(original_dir)
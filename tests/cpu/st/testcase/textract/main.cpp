@@ -131,6 +131,168 @@ void textract_test()
     EXPECT_TRUE(ret);
 }
 
+template <typename T>
+AICORE constexpr inline T CeilAlign(T num_1, T num_2)
+{
+    if (num_2 == 0) {
+        return 0;
+    }
+    return (num_1 + num_2 - 1) / num_2 * num_2;
+}
+
+enum class AccExtractMode
+{
+    Cast,        // TEXTRACT, the fixpipe only converts the type
+    Relu,        // TEXTRACT<..., reluMode>
+    ScalarQuant, // TEXTRACT with a per-tensor QUANT_PRE word
+    VectorQuant, // TEXTRACT_FP with one QUANT_PRE word per dst column
+};
+
+// C = A * B lands in an Acc tile, then the window of C at (idxRow, idxCol) is extracted into an Nz Mat tile through
+// the fixpipe and stored.
+template <typename OutT, typename InT, typename AccT, int validM, int validK, int validN, uint16_t idxRow,
+          uint16_t idxCol, AccExtractMode mode, ReluPreMode relu>
+AICORE inline void runTEXTRACTAcc(__gm__ OutT *out, __gm__ InT *src0, __gm__ InT *src1, __gm__ uint64_t *quant)
+{
+    constexpr int blockAlign = (sizeof(InT) == 1) ? 32 : 16;
+    constexpr int M = CeilAlign<int>(validM, 16);
+    constexpr int N = CeilAlign<int>(validN, blockAlign);
+    constexpr int K = CeilAlign<int>(validK, blockAlign);
+    constexpr int validMDst = validM - idxRow;
+    constexpr int validNDst = validN - idxCol;
+    constexpr int MDst = CeilAlign<int>(validMDst, 16);
+    constexpr int NDst = CeilAlign<int>(validNDst, 32 / sizeof(OutT));
+
+    using GlobalDataSrc0 = GlobalTensor<InT, pto::Shape<1, 1, 1, validM, validK>,
+                                        pto::Stride<validM * validK, validM * validK, validM * validK, validK, 1>>;
+    using GlobalDataSrc1 = GlobalTensor<InT, pto::Shape<1, 1, 1, validK, validN>,
+                                        pto::Stride<validK * validN, validK * validN, validK * validN, validN, 1>>;
+    using GlobalDataQuant = GlobalTensor<uint64_t, pto::Shape<1, 1, 1, 1, validNDst>,
+                                         pto::Stride<validNDst, validNDst, validNDst, validNDst, 1>>;
+    using GlobalDataOut =
+        GlobalTensor<OutT, pto::Shape<1, 1, 1, validMDst, validNDst>,
+                     pto::Stride<validMDst * validNDst, validMDst * validNDst, validMDst * validNDst, validNDst, 1>>;
+
+    using TileMatAData = Tile<TileType::Mat, InT, M, K, BLayout::ColMajor, validM, validK, SLayout::RowMajor, 512>;
+    using TileMatBData = Tile<TileType::Mat, InT, K, N, BLayout::ColMajor, validK, validN, SLayout::RowMajor, 512>;
+    using LeftTile = TileLeft<InT, M, K, validM, validK>;
+    using RightTile = TileRight<InT, K, N, validK, validN>;
+    using AccTile = TileAcc<AccT, M, N, validM, validN>;
+    using DstTile =
+        Tile<TileType::Mat, OutT, MDst, NDst, BLayout::ColMajor, validMDst, validNDst, SLayout::RowMajor, 512>;
+    using ScalingTile = Tile<TileType::Scaling, uint64_t, 1, NDst, BLayout::RowMajor, 1, validNDst>;
+
+    GlobalDataSrc0 src0Global(src0);
+    GlobalDataSrc1 src1Global(src1);
+    GlobalDataOut dstGlobal(out);
+
+    TileMatAData aMatTile;
+    TileMatBData bMatTile;
+    LeftTile aTile;
+    RightTile bTile;
+    AccTile cTile;
+    DstTile dstTile;
+    TASSIGN(aMatTile, 0x0);
+    TASSIGN(bMatTile, 0x10000);
+    TASSIGN(dstTile, 0x20000);
+    TASSIGN(aTile, 0x0);
+    TASSIGN(bTile, 0x0);
+    TASSIGN(cTile, 0x0);
+
+    TLOAD(aMatTile, src0Global);
+    TLOAD(bMatTile, src1Global);
+    set_flag(PIPE_MTE2, PIPE_MTE1, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_MTE1, EVENT_ID0);
+    TMOV(aTile, aMatTile);
+    TMOV(bTile, bMatTile);
+    set_flag(PIPE_MTE1, PIPE_M, EVENT_ID0);
+    wait_flag(PIPE_MTE1, PIPE_M, EVENT_ID0);
+    TMATMUL(cTile, aTile, bTile);
+    set_flag(PIPE_M, PIPE_FIX, EVENT_ID0);
+    wait_flag(PIPE_M, PIPE_FIX, EVENT_ID0);
+
+    if constexpr (mode == AccExtractMode::Cast) {
+        TEXTRACT(dstTile, cTile, idxRow, idxCol);
+    } else if constexpr (mode == AccExtractMode::Relu) {
+        TEXTRACT<DstTile, AccTile, relu>(dstTile, cTile, idxRow, idxCol);
+    } else if constexpr (mode == AccExtractMode::ScalarQuant) {
+        TEXTRACT<DstTile, AccTile, relu>(dstTile, cTile, quant[0], idxRow, idxCol);
+    } else {
+        GlobalDataQuant quantGlobal(quant);
+        ScalingTile scalingTile;
+        TASSIGN(scalingTile, 0x0);
+        TLOAD(scalingTile, quantGlobal);
+        TEXTRACT_FP<DstTile, AccTile, ScalingTile, relu>(dstTile, cTile, scalingTile, idxRow, idxCol);
+    }
+    set_flag(PIPE_FIX, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_FIX, PIPE_MTE3, EVENT_ID0);
+    TSTORE(dstGlobal, dstTile);
+}
+
+template <typename OutT, typename InT, typename AccT, int validM, int validK, int validN, uint16_t idxRow,
+          uint16_t idxCol, AccExtractMode mode, ReluPreMode relu = ReluPreMode::NoRelu>
+void textract_acc_test()
+{
+    size_t aFileSize = validM * validK * sizeof(InT);
+    size_t bFileSize = validK * validN * sizeof(InT);
+    size_t quantFileSize = (validN - idxCol) * sizeof(uint64_t);
+    size_t dstFileSize = (validM - idxRow) * (validN - idxCol) * sizeof(OutT);
+
+    aclInit(nullptr);
+    aclrtSetDevice(0);
+    aclrtStream stream;
+    aclrtCreateStream(&stream);
+
+    uint8_t *dstHost, *src0Host, *src1Host, *quantHost;
+    uint8_t *dstDevice, *src0Device, *src1Device, *quantDevice;
+
+    aclrtMallocHost((void **)(&dstHost), dstFileSize);
+    aclrtMallocHost((void **)(&src0Host), aFileSize);
+    aclrtMallocHost((void **)(&src1Host), bFileSize);
+    aclrtMallocHost((void **)(&quantHost), quantFileSize);
+
+    aclrtMalloc((void **)&dstDevice, dstFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src0Device, aFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src1Device, bFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&quantDevice, quantFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/x1_gm.bin", aFileSize, src0Host, aFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/x2_gm.bin", bFileSize, src1Host, bFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/quant_gm.bin", quantFileSize, quantHost, quantFileSize));
+
+    aclrtMemcpy(src0Device, aFileSize, src0Host, aFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(src1Device, bFileSize, src1Host, bFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(quantDevice, quantFileSize, quantHost, quantFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    runTEXTRACTAcc<OutT, InT, AccT, validM, validK, validN, idxRow, idxCol, mode, relu>(
+        (OutT *)dstDevice, (InT *)src0Device, (InT *)src1Device, (uint64_t *)quantDevice);
+
+    aclrtSynchronizeStream(stream);
+    aclrtMemcpy(dstHost, dstFileSize, dstDevice, dstFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
+
+    WriteFile(GetGoldenDir() + "/output.bin", dstHost, dstFileSize);
+
+    std::vector<OutT> golden(dstFileSize / sizeof(OutT));
+    size_t goldenSize = 0;
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/golden.bin", goldenSize, golden.data(), dstFileSize));
+
+    bool ret = ResultCmp(golden, (OutT *)dstHost, 0.001f);
+
+    aclrtFree(dstDevice);
+    aclrtFree(src0Device);
+    aclrtFree(src1Device);
+    aclrtFree(quantDevice);
+
+    aclrtFreeHost(dstHost);
+    aclrtFreeHost(src0Host);
+    aclrtFreeHost(src1Host);
+    aclrtFreeHost(quantHost);
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(0);
+    aclFinalize();
+
+    EXPECT_TRUE(ret);
+}
+
 TEST_F(TEXTRACTTest, case_half_half_32_32_32_32_IDX_0_0_L_0_0)
 {
     textract_test<half, half, 32, 32, 32, 32, 0, 0, 0, 0>();
@@ -245,3 +407,24 @@ TEST_F(TEXTRACTTest, case_float_float_128_96_125_93_IDX_8_16_L_2_2)
 {
     textract_test<float, float, 128, 96, 125, 93, 8, 16, 2, 2>();
 }
+
+TEST_F(TEXTRACTTest, case_acc_f32_to_f16_IDX_8_16)
+{
+    textract_acc_test<half, half, float, 40, 32, 48, 8, 16, AccExtractMode::Cast>();
+}
+
+TEST_F(TEXTRACTTest, case_acc_relu_f32_IDX_16_16)
+{
+    textract_acc_test<float, float, float, 31, 16, 33, 16, 16, AccExtractMode::Relu, ReluPreMode::NormalRelu>();
+}
+
+TEST_F(TEXTRACTTest, case_acc_scalar_quant_s32_to_s8_IDX_16_32)
+{
+    textract_acc_test<int8_t, int8_t, int32_t, 48, 64, 96, 16, 32, AccExtractMode::ScalarQuant>();
+}
+
+TEST_F(TEXTRACTTest, case_acc_vector_quant_relu_s32_to_f16_IDX_0_32)
+{
+    textract_acc_test<half, int8_t, int32_t, 32, 64, 96, 0, 32, AccExtractMode::VectorQuant,
+                      ReluPreMode::NormalRelu>();
+}
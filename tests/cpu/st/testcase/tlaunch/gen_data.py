@@ -0,0 +1,56 @@
+#!/usr/bin/python3
+# coding=utf-8
+# --------------------------------------------------------------------------------
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# --------------------------------------------------------------------------------
+
+import os
+import numpy as np
+np.random.seed(19)
+
+
+def gen_golden_data_tlaunch(param):
+    row, col = [param.row, param.col]
+
+    input1 = np.random.randint(1, 10, size=[row, col]).astype(param.dtype)
+    input2 = np.random.randint(1, 10, size=[row, col]).astype(param.dtype)
+    golden = ((input1 + input2) * param.cores).astype(param.dtype)
+
+    input1.tofile("input1.bin")
+    input2.tofile("input2.bin")
+    golden.tofile("golden.bin")
+
+
+class TLaunchParams:
+    def __init__(self, name, dtype, row, col, cores=1):
+        self.name = name
+        self.dtype = dtype
+        self.row = row
+        self.col = col
+        self.cores = cores
+
+
+if __name__ == "__main__":
+    case_params_list = [
+        TLaunchParams("TLAUNCHTest.case_blocks_float_8x16x64", np.float32, 8 * 16, 64),
+        TLaunchParams("TLAUNCHTest.case_blocks_int32_24x8x32", np.int32, 24 * 8, 32),
+        TLaunchParams("TLAUNCHTest.case_mix_v2c1_float_4x2x16x64", np.float32, 4 * 2 * 16, 64),
+        TLaunchParams("TLAUNCHTest.case_async_flags_float_8x16x64", np.float32, 8 * 16, 64),
+        TLaunchParams("TLAUNCHTest.case_async_events_float_1x64x64", np.float32, 64, 64),
+        TLaunchParams("TLAUNCHTest.case_atomic_add_float_8x64x64", np.float32, 64, 64, cores=8),
+        TLaunchParams("TLAUNCHTest.case_atomic_add_int32_24x16x32", np.int32, 16, 32, cores=24),
+    ]
+
+    for param in case_params_list:
+        if not os.path.exists(param.name):
+            os.makedirs(param.name)
+        original_dir = os.getcwd()
+        os.chdir(param.name)
+        gen_golden_data_tlaunch(param)
+        os.chdir(original_dir)
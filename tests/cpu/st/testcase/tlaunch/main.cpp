@@ -0,0 +1,138 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "test_common.h"
+#include <pto/pto-inst.hpp>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace PtoTestCommon;
+
+class TLAUNCHTest : public testing::Test {
+protected:
+    void SetUp() override
+    {}
+    void TearDown() override
+    {}
+};
+
+std::string GetGoldenDir()
+{
+    const testing::TestInfo *testInfo = testing::UnitTest::GetInstance()->current_test_info();
+    const std::string caseName = testInfo->name();
+    std::string suiteName = testInfo->test_suite_name();
+    std::string fullPath = "../" + suiteName + "." + caseName;
+    return fullPath;
+}
+
+template <typename T, int kBlockDim, int kRowsPerCore, int kCols>
+void LaunchTAddBlocks(T *out, T *src0, T *src1, void *stream);
+
+template <typename T, int kBlockDim, int kRowsPerCore, int kCols>
+void LaunchTAddMix(T *out, T *src0, T *src1, void *stream);
+
+template <typename T, int kBlockDim, int kRowsPerCore, int kCols, bool kUseEvents>
+void LaunchTAddAsync(T *out, T *src0, T *src1, void *stream);
+
+template <typename T, int kBlockDim, int kRows, int kCols>
+void LaunchTAddAtomic(T *out, T *src0, T *src1, void *stream);
+
+bool RunAsyncPipeError(bool kernelThrows);
+
+template <typename T, int kRows, int kCols, typename LaunchFn>
+void test_tlaunch(LaunchFn launch)
+{
+    size_t fileSize = kRows * kCols * sizeof(T);
+
+    aclInit(nullptr);
+    aclrtSetDevice(0);
+    aclrtStream stream;
+    aclrtCreateStream(&stream);
+
+    T *dstHost, *src0Host, *src1Host;
+    T *dstDevice, *src0Device, *src1Device;
+
+    aclrtMallocHost((void **)(&dstHost), fileSize);
+    aclrtMallocHost((void **)(&src0Host), fileSize);
+    aclrtMallocHost((void **)(&src1Host), fileSize);
+
+    aclrtMalloc((void **)&dstDevice, fileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src0Device, fileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src1Device, fileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/input1.bin", fileSize, src0Host, fileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/input2.bin", fileSize, src1Host, fileSize));
+
+    aclrtMemcpy(src0Device, fileSize, src0Host, fileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(src1Device, fileSize, src1Host, fileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    launch(dstDevice, src0Device, src1Device, stream);
+
+    aclrtSynchronizeStream(stream);
+    aclrtMemcpy(dstHost, fileSize, dstDevice, fileSize, ACL_MEMCPY_DEVICE_TO_HOST);
+
+    WriteFile(GetGoldenDir() + "/output.bin", dstHost, fileSize);
+
+    aclrtFree(dstDevice);
+    aclrtFree(src0Device);
+    aclrtFree(src1Device);
+
+    aclrtFreeHost(dstHost);
+    aclrtFreeHost(src0Host);
+    aclrtFreeHost(src1Host);
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(0);
+    aclFinalize();
+
+    std::vector<T> golden(fileSize);
+    std::vector<T> devFinal(fileSize);
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/golden.bin", fileSize, golden.data(), fileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/output.bin", fileSize, devFinal.data(), fileSize));
+
+    bool ret = ResultCmp<T>(golden, devFinal, 0.001f);
+
+    EXPECT_TRUE(ret);
+}
+
+TEST_F(TLAUNCHTest, case_blocks_float_8x16x64)
+{
+    test_tlaunch<float, 8 * 16, 64>(LaunchTAddBlocks<float, 8, 16, 64>);
+}
+TEST_F(TLAUNCHTest, case_blocks_int32_24x8x32)
+{
+    test_tlaunch<int32_t, 24 * 8, 32>(LaunchTAddBlocks<int32_t, 24, 8, 32>);
+}
+TEST_F(TLAUNCHTest, case_mix_v2c1_float_4x2x16x64)
+{
+    test_tlaunch<float, 4 * 2 * 16, 64>(LaunchTAddMix<float, 4, 16, 64>);
+}
+TEST_F(TLAUNCHTest, case_async_flags_float_8x16x64)
+{
+    test_tlaunch<float, 8 * 16, 64>(LaunchTAddAsync<float, 8, 16, 64, false>);
+}
+TEST_F(TLAUNCHTest, case_async_events_float_1x64x64)
+{
+    test_tlaunch<float, 64, 64>(LaunchTAddAsync<float, 1, 64, 64, true>);
+}
+TEST_F(TLAUNCHTest, case_atomic_add_float_8x64x64)
+{
+    test_tlaunch<float, 64, 64>(LaunchTAddAtomic<float, 8, 64, 64>);
+}
+TEST_F(TLAUNCHTest, case_atomic_add_int32_24x16x32)
+{
+    test_tlaunch<int32_t, 16, 32>(LaunchTAddAtomic<int32_t, 24, 16, 32>);
+}
+TEST(TLAUNCHPipes, pipe_error_reported)
+{
+    ASSERT_TRUE(RunAsyncPipeError(false));
+}
+TEST(TLAUNCHPipes, pipe_error_while_kernel_unwinds)
+{
+    ASSERT_TRUE(RunAsyncPipeError(true));
+}
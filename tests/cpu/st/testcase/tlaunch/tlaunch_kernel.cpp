@@ -0,0 +1,170 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+#include <stdexcept>
+#include <string>
+
+using namespace pto;
+
+// Each core adds the kRowsPerCore x kCols slice selected by its block (and vector subblock) index.
+template <typename T, int kRowsPerCore, int kCols>
+AICORE void runTAddSlice(__gm__ T __out__ *out, __gm__ T __in__ *src0, __gm__ T __in__ *src1, int64_t sliceIdx)
+{
+    using DynShapeDim5 = Shape<1, 1, 1, kRowsPerCore, kCols>;
+    using DynStridDim5 = Stride<1, 1, 1, kCols, 1>;
+    using GlobalData = GlobalTensor<T, DynShapeDim5, DynStridDim5>;
+    using TileData = Tile<TileType::Vec, T, kRowsPerCore, kCols, BLayout::RowMajor, -1, -1>;
+    TileData src0Tile(kRowsPerCore, kCols);
+    TileData src1Tile(kRowsPerCore, kCols);
+    TileData dstTile(kRowsPerCore, kCols);
+    TASSIGN(src0Tile, 0x0);
+    TASSIGN(src1Tile, 0x4000);
+    TASSIGN(dstTile, 0x8000);
+
+    const size_t offset = static_cast<size_t>(sliceIdx) * kRowsPerCore * kCols;
+    GlobalData src0Global(src0 + offset);
+    GlobalData src1Global(src1 + offset);
+    GlobalData dstGlobal(out + offset);
+
+    TLOAD(src0Tile, src0Global);
+    TLOAD(src1Tile, src1Global);
+    set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    TADD(dstTile, src0Tile, src1Tile);
+    set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    TSTORE(dstGlobal, dstTile);
+}
+
+template <typename T, int kBlockDim, int kRowsPerCore, int kCols>
+void LaunchTAddBlocks(T *out, T *src0, T *src1, void *stream)
+{
+    (void)stream;
+    cpu::LaunchKernel(kBlockDim, [&]() {
+        runTAddSlice<T, kRowsPerCore, kCols>(out, src0, src1, get_block_idx());
+    });
+}
+
+template <typename T, int kBlockDim, int kRowsPerCore, int kCols>
+void LaunchTAddMix(T *out, T *src0, T *src1, void *stream)
+{
+    (void)stream;
+    cpu::LaunchMixKernel(
+        kBlockDim, VecCubeRatio::V2C1_VECS, [&]() {},
+        [&]() {
+            const int64_t slice = get_block_idx() * get_subblockdim() + get_subblockid();
+            runTAddSlice<T, kRowsPerCore, kCols>(out, src0, src1, slice);
+        });
+}
+
+// Same slice add ordered by the RecordEvent tokens of the instructions instead of set_flag/wait_flag.
+template <typename T, int kRowsPerCore, int kCols>
+AICORE void runTAddSliceEvents(__gm__ T __out__ *out, __gm__ T __in__ *src0, __gm__ T __in__ *src1, int64_t sliceIdx)
+{
+    using DynShapeDim5 = Shape<1, 1, 1, kRowsPerCore, kCols>;
+    using DynStridDim5 = Stride<1, 1, 1, kCols, 1>;
+    using GlobalData = GlobalTensor<T, DynShapeDim5, DynStridDim5>;
+    using TileData = Tile<TileType::Vec, T, kRowsPerCore, kCols, BLayout::RowMajor, -1, -1>;
+    TileData src0Tile(kRowsPerCore, kCols);
+    TileData src1Tile(kRowsPerCore, kCols);
+    TileData dstTile(kRowsPerCore, kCols);
+    TASSIGN(src0Tile, 0x0);
+    TASSIGN(src1Tile, 0x4000);
+    TASSIGN(dstTile, 0x8000);
+
+    const size_t offset = static_cast<size_t>(sliceIdx) * kRowsPerCore * kCols;
+    GlobalData src0Global(src0 + offset);
+    GlobalData src1Global(src1 + offset);
+    GlobalData dstGlobal(out + offset);
+
+    RecordEvent load0 = TLOAD(src0Tile, src0Global);
+    RecordEvent load1 = TLOAD(src1Tile, src1Global);
+    RecordEvent add = TADD(dstTile, src0Tile, src1Tile, load0, load1);
+    TSTORE(dstGlobal, dstTile, add);
+}
+
+template <typename T, int kBlockDim, int kRowsPerCore, int kCols, bool kUseEvents>
+void LaunchTAddAsync(T *out, T *src0, T *src1, void *stream)
+{
+    (void)stream;
+    cpu::set_async_pipes(true);
+    cpu::LaunchKernel(kBlockDim, [&]() {
+        if constexpr (kUseEvents) {
+            runTAddSliceEvents<T, kRowsPerCore, kCols>(out, src0, src1, get_block_idx());
+        } else {
+            runTAddSlice<T, kRowsPerCore, kCols>(out, src0, src1, get_block_idx());
+        }
+    });
+    cpu::set_async_pipes(false);
+}
+
+// Every core adds its own copy of src0 + src1 into the same output with an atomic store, as split-K does.
+template <typename T, int kBlockDim, int kRows, int kCols>
+void LaunchTAddAtomic(T *out, T *src0, T *src1, void *stream)
+{
+    (void)stream;
+    using GlobalData = GlobalTensor<T, Shape<1, 1, 1, kRows, kCols>, Stride<1, 1, 1, kCols, 1>>;
+    using TileData = Tile<TileType::Vec, T, kRows, kCols, BLayout::RowMajor, -1, -1>;
+    std::fill(out, out + kRows * kCols, T(0));
+    cpu::LaunchKernel(kBlockDim, [&]() {
+        TileData src0Tile(kRows, kCols);
+        TileData src1Tile(kRows, kCols);
+        TileData dstTile(kRows, kCols);
+        TASSIGN(src0Tile, 0x0);
+        TASSIGN(src1Tile, 0x4000);
+        TASSIGN(dstTile, 0x8000);
+        GlobalData src0Global(src0);
+        GlobalData src1Global(src1);
+        GlobalData dstGlobal(out);
+
+        TLOAD(src0Tile, src0Global);
+        TLOAD(src1Tile, src1Global);
+        set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+        wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+        TADD(dstTile, src0Tile, src1Tile);
+        set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+        wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+        TSTORE<TileData, GlobalData, AtomicType::AtomicAdd>(dstGlobal, dstTile);
+    });
+}
+
+// Queues an instruction that fails on its pipe, then either returns or throws itself. The launch must report the
+// pipe's error in the first case and the kernel's own in the second, rather than terminate.
+bool RunAsyncPipeError(bool kernelThrows)
+{
+    using TileData = Tile<TileType::Vec, float, 16, 64>;
+    cpu::set_async_pipes(true);
+    bool ok = false;
+    try {
+        cpu::LaunchKernel(1, [&]() {
+            TileData tile;
+            cpu::IssueInstr("TFAIL", [](TileData &) { throw std::runtime_error("pipe"); }, tile);
+            if (kernelThrows) {
+                throw std::logic_error("kernel");
+            }
+        });
+    } catch (const std::logic_error &e) {
+        ok = kernelThrows && std::string(e.what()) == "kernel";
+    } catch (const std::runtime_error &e) {
+        ok = !kernelThrows && std::string(e.what()) == "pipe";
+    }
+    cpu::set_async_pipes(false);
+    return ok;
+}
+
+template void LaunchTAddBlocks<float, 8, 16, 64>(float *out, float *src0, float *src1, void *stream);
+template void LaunchTAddBlocks<int32_t, 24, 8, 32>(int32_t *out, int32_t *src0, int32_t *src1, void *stream);
+template void LaunchTAddMix<float, 4, 16, 64>(float *out, float *src0, float *src1, void *stream);
+template void LaunchTAddAsync<float, 8, 16, 64, false>(float *out, float *src0, float *src1, void *stream);
+template void LaunchTAddAsync<float, 1, 64, 64, true>(float *out, float *src0, float *src1, void *stream);
+template void LaunchTAddAtomic<float, 8, 64, 64>(float *out, float *src0, float *src1, void *stream);
+template void LaunchTAddAtomic<int32_t, 24, 16, 32>(int32_t *out, int32_t *src0, int32_t *src1, void *stream);
@@ -0,0 +1,128 @@
+#!/usr/bin/python3
+# coding=utf-8
+# --------------------------------------------------------------------------------
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# --------------------------------------------------------------------------------
+
+import os
+import numpy as np
+np.random.seed(23)
+
+SCALE_FACTOR = 32
+
+# (exponent bits, mantissa bits, bias) of the fp8 and fp4 element formats
+FORMATS = {
+    "e4m3": (4, 3, 7),
+    "e5m2": (5, 2, 15),
+    "e2m1": (2, 1, 1),
+    "e1m2": (1, 2, 1),
+}
+FP4_FORMATS = ("e2m1", "e1m2")
+
+
+def decode_minifloat(code, exp_bits, man_bits, bias):
+    man = code & ((1 << man_bits) - 1)
+    exp = (code >> man_bits) & ((1 << exp_bits) - 1)
+    sign = -1.0 if (code >> (exp_bits + man_bits)) & 1 else 1.0
+    if exp == 0:
+        return sign * man * 2.0 ** (1 - bias - man_bits)
+    return sign * (1.0 + man / 2.0 ** man_bits) * 2.0 ** (exp - bias)
+
+
+def random_codes(fmt, shape):
+    """Codes of normal numbers with magnitude in [2^-2, 4): no NaN or infinity, and sums that stay well scaled."""
+    if fmt in FP4_FORMATS:
+        # Every fp4 code is a finite number.
+        return np.random.randint(0, 16, shape).astype(np.uint8)
+    exp_bits, man_bits, bias = FORMATS[fmt]
+    exp = np.random.randint(bias - 2, bias + 2, shape)
+    man = np.random.randint(0, 1 << man_bits, shape)
+    sign = np.random.randint(0, 2, shape)
+    return ((sign << (exp_bits + man_bits)) | (exp << man_bits) | man).astype(np.uint8)
+
+
+def decode(fmt, codes):
+    exp_bits, man_bits, bias = FORMATS[fmt]
+    table = np.array([decode_minifloat(c, exp_bits, man_bits, bias) for c in range(1 << (1 + exp_bits + man_bits))],
+                     dtype=np.float64)
+    return table[codes]
+
+
+def to_gm(fmt, codes):
+    """fp4 GM holds two elements per byte in storage order, the even element in the low nibble."""
+    flat = codes.reshape(-1)
+    if fmt in FP4_FORMATS:
+        return (flat[0::2] | (flat[1::2] << 4)).astype(np.uint8)
+    return flat
+
+
+def matmul_reference(a, b):
+    # (m, k, 1) * (1, k, n) -> (m, k, n) -> sum over k, without BLAS
+    return (a[:, :, None] * b[None, :, :]).sum(axis=1)
+
+
+def gen_golden_data(param):
+    m, k, n = param.m, param.k, param.n
+    scale_k = k // SCALE_FACTOR
+
+    a_codes = random_codes(param.atype, [m, k])
+    b_codes = random_codes(param.btype, [k, n])
+    scale_a = np.random.randint(124, 131, [m, scale_k]).astype(np.uint8)
+    scale_b = np.random.randint(124, 131, [scale_k, n]).astype(np.uint8)
+    bias = np.random.randint(1, 10, [n]).astype(np.float32)
+
+    a = decode(param.atype, a_codes) * np.repeat(2.0 ** (scale_a.astype(np.float64) - 127), SCALE_FACTOR, axis=1)
+    b = decode(param.btype, b_codes) * np.repeat(2.0 ** (scale_b.astype(np.float64) - 127), SCALE_FACTOR, axis=0)
+    golden = matmul_reference(a, b)
+    if param.is_bias:
+        golden += bias
+
+    # A and scaleA are ND; B and scaleB are DN, i.e. stored as their transposes.
+    to_gm(param.atype, a_codes).tofile("./x1_gm.bin")
+    to_gm(param.btype, b_codes.transpose().copy()).tofile("./x2_gm.bin")
+    scale_a.tofile("./scale1_gm.bin")
+    scale_b.transpose().copy().tofile("./scale2_gm.bin")
+    bias.tofile("./bias_gm.bin")
+    golden.astype(np.float32).tofile("./golden.bin")
+
+
+class tmatmulMxParams:
+    def __init__(self, atype, btype, m, k, n, is_bias):
+        self.atype = atype
+        self.btype = btype
+        self.m = m
+        self.k = k
+        self.n = n
+        self.is_bias = is_bias
+
+
+if __name__ == "__main__":
+    case_name_list = [
+        "TMATMULMXTest.case1",
+        "TMATMULMXTest.case2",
+        "TMATMULMXTest.case_gemv_3",
+        "TMATMULMXTest.case4",
+        "TMATMULMXTest.case5_fp4",
+    ]
+
+    case_params_list = [
+        tmatmulMxParams("e4m3", "e4m3", 64, 256, 64, False),
+        tmatmulMxParams("e5m2", "e4m3", 32, 128, 96, True),
+        tmatmulMxParams("e4m3", "e5m2", 1, 192, 64, False),
+        tmatmulMxParams("e5m2", "e5m2", 80, 64, 32, True),
+        tmatmulMxParams("e2m1", "e1m2", 50, 128, 64, True),
+    ]
+
+    for i, case_name in enumerate(case_name_list):
+        if not os.path.exists(case_name):
+            os.makedirs(case_name)
+        original_dir = os.getcwd()
+        os.chdir(case_name)
+        gen_golden_data(case_params_list[i])
+        os.chdir(original_dir)
@@ -0,0 +1,142 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "test_common.h"
+#include <pto/pto-inst.hpp>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace PtoTestCommon;
+
+template <int32_t tilingKey>
+void LaunchTMATMUL_MX(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1, uint8_t *bias,
+                      void *stream);
+
+class TMATMULMXTest : public testing::Test {
+protected:
+    void SetUp() override
+    {}
+    void TearDown() override
+    {}
+};
+
+std::string GetGoldenDir()
+{
+    const testing::TestInfo *testInfo = testing::UnitTest::GetInstance()->current_test_info();
+    const std::string caseName = testInfo->name();
+    std::string suiteName = testInfo->test_suite_name();
+    std::string fullPath = "../" + suiteName + "." + caseName;
+    return fullPath;
+}
+
+// A and B hold one byte per fp8 element or two fp4 elements per byte, the scales one e8m0 byte per 32 elements of K.
+template <int32_t key>
+void tmatmul_mx_test(uint32_t M, uint32_t K, uint32_t N, bool isFp4 = false)
+{
+    const uint32_t scaleK = K / 32;
+    const uint32_t elementsPerByte = isFp4 ? 2 : 1;
+    size_t aFileSize = M * K / elementsPerByte;
+    size_t bFileSize = K * N / elementsPerByte;
+    size_t scaleAFileSize = M * scaleK;
+    size_t scaleBFileSize = scaleK * N;
+    size_t biasFileSize = N * sizeof(float);
+    size_t cFileSize = M * N * sizeof(float);
+
+    aclInit(nullptr);
+    aclrtSetDevice(0);
+    aclrtStream stream;
+    aclrtCreateStream(&stream);
+
+    uint8_t *dstHost, *src0Host, *src1Host, *scale0Host, *scale1Host, *biasHost;
+    uint8_t *dstDevice, *src0Device, *src1Device, *scale0Device, *scale1Device, *biasDevice;
+
+    aclrtMallocHost((void **)(&dstHost), cFileSize);
+    aclrtMallocHost((void **)(&src0Host), aFileSize);
+    aclrtMallocHost((void **)(&src1Host), bFileSize);
+    aclrtMallocHost((void **)(&scale0Host), scaleAFileSize);
+    aclrtMallocHost((void **)(&scale1Host), scaleBFileSize);
+    aclrtMallocHost((void **)(&biasHost), biasFileSize);
+
+    aclrtMalloc((void **)&dstDevice, cFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src0Device, aFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src1Device, bFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&scale0Device, scaleAFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&scale1Device, scaleBFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&biasDevice, biasFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/x1_gm.bin", aFileSize, src0Host, aFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/x2_gm.bin", bFileSize, src1Host, bFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/scale1_gm.bin", scaleAFileSize, scale0Host, scaleAFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/scale2_gm.bin", scaleBFileSize, scale1Host, scaleBFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/bias_gm.bin", biasFileSize, biasHost, biasFileSize));
+
+    aclrtMemcpy(src0Device, aFileSize, src0Host, aFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(src1Device, bFileSize, src1Host, bFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(scale0Device, scaleAFileSize, scale0Host, scaleAFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(scale1Device, scaleBFileSize, scale1Host, scaleBFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(biasDevice, biasFileSize, biasHost, biasFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    LaunchTMATMUL_MX<key>(dstDevice, src0Device, src1Device, scale0Device, scale1Device, biasDevice, stream);
+
+    aclrtSynchronizeStream(stream);
+    aclrtMemcpy(dstHost, cFileSize, dstDevice, cFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
+
+    WriteFile(GetGoldenDir() + "/output_z.bin", dstHost, cFileSize);
+
+    aclrtFree(dstDevice);
+    aclrtFree(src0Device);
+    aclrtFree(src1Device);
+    aclrtFree(scale0Device);
+    aclrtFree(scale1Device);
+    aclrtFree(biasDevice);
+
+    aclrtFreeHost(dstHost);
+    aclrtFreeHost(src0Host);
+    aclrtFreeHost(src1Host);
+    aclrtFreeHost(scale0Host);
+    aclrtFreeHost(scale1Host);
+    aclrtFreeHost(biasHost);
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(0);
+    aclFinalize();
+
+    std::vector<float> golden(cFileSize);
+    std::vector<float> devFinal(cFileSize);
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/golden.bin", cFileSize, golden.data(), cFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/output_z.bin", cFileSize, devFinal.data(), cFileSize));
+
+    bool ret = ResultCmp(golden, devFinal, 0.001f);
+
+    EXPECT_TRUE(ret);
+}
+
+TEST_F(TMATMULMXTest, case1)
+{
+    tmatmul_mx_test<1>(64, 256, 64);
+}
+
+TEST_F(TMATMULMXTest, case2)
+{
+    tmatmul_mx_test<2>(32, 128, 96);
+}
+
+TEST_F(TMATMULMXTest, case_gemv_3)
+{
+    tmatmul_mx_test<3>(1, 192, 64);
+}
+
+TEST_F(TMATMULMXTest, case4)
+{
+    tmatmul_mx_test<4>(80, 64, 32);
+}
+
+TEST_F(TMATMULMXTest, case5_fp4)
+{
+    tmatmul_mx_test<5>(50, 128, 64, true);
+}
@@ -0,0 +1,169 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+
+using namespace pto;
+
+constexpr int SCALE_FACTOR = 32;
+
+// C = (scaleA x A) * (scaleB x B) over K in baseK steps, like the A5 MX matmul kernels: A and scaleA are ND, B and
+// scaleB are DN in GM. Every step TEXTRACTs one baseK slice of the operands and their scales into L0. fp4 operands
+// hold two elements per byte, so their shapes count elements and their GM buffers are half as many bytes.
+template <typename AType, typename BType, int M, int K, int N, int validM, int baseK, bool isBias, bool isGemv>
+__global__ AICORE void RunTMATMUL_MX(__gm__ float *out, __gm__ AType *src0, __gm__ BType *src1,
+                                     __gm__ float8_e8m0_t *scale0, __gm__ float8_e8m0_t *scale1, __gm__ float *bias)
+{
+    constexpr int scaleK = K / SCALE_FACTOR;
+    constexpr int baseScaleK = baseK / SCALE_FACTOR;
+
+    using GlobalDataSrc0 =
+        GlobalTensor<AType, Shape<1, 1, 1, validM, K>, Stride<validM * K, validM * K, validM * K, K, 1>>;
+    using GlobalDataSrc1 = GlobalTensor<BType, Shape<1, 1, 1, K, N>, Stride<K * N, K * N, K * N, 1, K>, Layout::DN>;
+    using GlobalDataScale0 = GlobalTensor<float8_e8m0_t, Shape<1, 1, 1, validM, scaleK>,
+                                          Stride<validM * scaleK, validM * scaleK, validM * scaleK, scaleK, 1>>;
+    using GlobalDataScale1 = GlobalTensor<float8_e8m0_t, Shape<1, 1, 1, scaleK, N>,
+                                          Stride<scaleK * N, scaleK * N, scaleK * N, 1, scaleK>, Layout::DN>;
+    using GlobalDataBias = GlobalTensor<float, Shape<1, 1, 1, 1, N>, Stride<N, N, N, N, 1>>;
+    using GlobalDataOut =
+        GlobalTensor<float, Shape<1, 1, 1, validM, N>, Stride<validM * N, validM * N, validM * N, N, 1>>;
+
+    using TileMatA = Tile<TileType::Mat, AType, M, K, BLayout::ColMajor, validM, K, SLayout::RowMajor, 512>;
+    using TileMatB = Tile<TileType::Mat, BType, K, N, BLayout::RowMajor, K, N, SLayout::ColMajor, 512>;
+    using TileScaleA = Tile<TileType::Mat, float8_e8m0_t, M, scaleK, BLayout::ColMajor, validM, scaleK>;
+    using TileScaleB = Tile<TileType::Mat, float8_e8m0_t, scaleK, N, BLayout::RowMajor, scaleK, N>;
+
+    using LeftTile = TileLeft<AType, M, baseK, validM, baseK>;
+    using RightTile = TileRight<BType, baseK, N, baseK, N>;
+    using LeftScaleTile = TileLeftScale<float8_e8m0_t, M, baseScaleK, validM, baseScaleK>;
+    using RightScaleTile = TileRightScale<float8_e8m0_t, baseScaleK, N, baseScaleK, N>;
+    using AccTile = TileAcc<float, M, N, validM, N>;
+    using BiasTile = Tile<TileType::Bias, float, 1, N, BLayout::RowMajor, 1, N>;
+
+    GlobalDataSrc0 src0Global(src0);
+    GlobalDataSrc1 src1Global(src1);
+    GlobalDataScale0 scale0Global(scale0);
+    GlobalDataScale1 scale1Global(scale1);
+    GlobalDataOut dstGlobal(out);
+
+    TileMatA aMatTile;
+    TileMatB bMatTile;
+    TileScaleA aScaleMatTile;
+    TileScaleB bScaleMatTile;
+    TASSIGN(aMatTile, 0x0);
+    TASSIGN(bMatTile, 0x10000);
+    TASSIGN(aScaleMatTile, 0x20000);
+    TASSIGN(bScaleMatTile, 0x30000);
+
+    LeftTile aTile;
+    RightTile bTile;
+    LeftScaleTile aScaleTile;
+    RightScaleTile bScaleTile;
+    AccTile cTile;
+    BiasTile biasTile;
+    TASSIGN(aTile, 0x0);
+    TASSIGN(bTile, 0x0);
+    TASSIGN(aScaleTile, 0x0);
+    TASSIGN(bScaleTile, 0x0);
+    TASSIGN(cTile, 0x0);
+    TASSIGN(biasTile, 0x0);
+
+    /******************************TLOAD*****************************/
+    TLOAD(aMatTile, src0Global);
+    TLOAD(bMatTile, src1Global);
+    TLOAD(aScaleMatTile, scale0Global);
+    TLOAD(bScaleMatTile, scale1Global);
+    if constexpr (isBias) {
+        GlobalDataBias biasGlobal(bias);
+        TLOAD(biasTile, biasGlobal);
+    }
+
+    set_flag(PIPE_MTE2, PIPE_MTE1, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_MTE1, EVENT_ID0);
+
+    for (int kIter = 0; kIter < K / baseK; kIter++) {
+        /******************************TEXTRACT*****************************/
+        TEXTRACT(aTile, aMatTile, 0, kIter * baseK);
+        TEXTRACT(aScaleTile, aScaleMatTile, 0, kIter * baseScaleK);
+        TEXTRACT(bTile, bMatTile, kIter * baseK, 0);
+        TEXTRACT(bScaleTile, bScaleMatTile, kIter * baseScaleK, 0);
+
+        set_flag(PIPE_MTE1, PIPE_M, EVENT_ID0);
+        wait_flag(PIPE_MTE1, PIPE_M, EVENT_ID0);
+
+        /******************************TMATMUL_MX*****************************/
+        if constexpr (isGemv) {
+            if (kIter != 0) {
+                TGEMV_MX(cTile, cTile, aTile, aScaleTile, bTile, bScaleTile);
+            } else if constexpr (isBias) {
+                TGEMV_MX(cTile, aTile, aScaleTile, bTile, bScaleTile, biasTile);
+            } else {
+                TGEMV_MX(cTile, aTile, aScaleTile, bTile, bScaleTile);
+            }
+        } else {
+            if (kIter != 0) {
+                TMATMUL_MX(cTile, cTile, aTile, aScaleTile, bTile, bScaleTile);
+            } else if constexpr (isBias) {
+                TMATMUL_MX(cTile, aTile, aScaleTile, bTile, bScaleTile, biasTile);
+            } else {
+                TMATMUL_MX(cTile, aTile, aScaleTile, bTile, bScaleTile);
+            }
+        }
+
+        set_flag(PIPE_M, PIPE_MTE1, EVENT_ID0);
+        wait_flag(PIPE_M, PIPE_MTE1, EVENT_ID0);
+    }
+
+    set_flag(PIPE_M, PIPE_FIX, EVENT_ID0);
+    wait_flag(PIPE_M, PIPE_FIX, EVENT_ID0);
+    /********************************TSTORE****************************/
+    TSTORE(dstGlobal, cTile);
+
+    out = dstGlobal.data();
+}
+
+template <int32_t tilingKey>
+void LaunchTMATMUL_MX(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1, uint8_t *bias,
+                      void *stream)
+{
+    auto *dst = reinterpret_cast<float *>(out);
+    auto *sA = reinterpret_cast<float8_e8m0_t *>(scale0);
+    auto *sB = reinterpret_cast<float8_e8m0_t *>(scale1);
+    auto *biasData = reinterpret_cast<float *>(bias);
+    if constexpr (tilingKey == 1) {
+        RunTMATMUL_MX<float8_e4m3_t, float8_e4m3_t, 64, 256, 64, 64, 128, false, false>(
+            dst, reinterpret_cast<float8_e4m3_t *>(src0), reinterpret_cast<float8_e4m3_t *>(src1), sA, sB, biasData);
+    } else if constexpr (tilingKey == 2) {
+        RunTMATMUL_MX<float8_e5m2_t, float8_e4m3_t, 32, 128, 96, 32, 64, true, false>(
+            dst, reinterpret_cast<float8_e5m2_t *>(src0), reinterpret_cast<float8_e4m3_t *>(src1), sA, sB, biasData);
+    } else if constexpr (tilingKey == 3) {
+        RunTMATMUL_MX<float8_e4m3_t, float8_e5m2_t, 32, 192, 64, 1, 64, false, true>(
+            dst, reinterpret_cast<float8_e4m3_t *>(src0), reinterpret_cast<float8_e5m2_t *>(src1), sA, sB, biasData);
+    } else if constexpr (tilingKey == 4) {
+        RunTMATMUL_MX<float8_e5m2_t, float8_e5m2_t, 96, 64, 32, 80, 64, true, false>(
+            dst, reinterpret_cast<float8_e5m2_t *>(src0), reinterpret_cast<float8_e5m2_t *>(src1), sA, sB, biasData);
+    } else if constexpr (tilingKey == 5) {
+        RunTMATMUL_MX<float4_e2m1x2_t, float4_e1m2x2_t, 64, 128, 64, 50, 64, true, false>(
+            dst, reinterpret_cast<float4_e2m1x2_t *>(src0), reinterpret_cast<float4_e1m2x2_t *>(src1), sA, sB,
+            biasData);
+    }
+}
+
+template void LaunchTMATMUL_MX<1>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1,
+                                  uint8_t *bias, void *stream);
+template void LaunchTMATMUL_MX<2>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1,
+                                  uint8_t *bias, void *stream);
+template void LaunchTMATMUL_MX<3>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1,
+                                  uint8_t *bias, void *stream);
+template void LaunchTMATMUL_MX<4>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1,
+                                  uint8_t *bias, void *stream);
+template void LaunchTMATMUL_MX<5>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *scale0, uint8_t *scale1,
+                                  uint8_t *bias, void *stream);
@@ -194,6 +194,7 @@ if __name__ == "__main__":
         # TMRGSORTTest.case_multi
         TmrgsortParams("TMRGSORTTest.case_multi1", np.float32, 1, 128, 128, 128, 128, 4, 512, 0),
         TmrgsortParams("TMRGSORTTest.case_multi2", np.float16, 1, 128, 128, 128, 128, 4, 512, 0),
+        TmrgsortParams("TMRGSORTTest.case_multi3", np.float32, 1, 2048, 2048, 2048, 2048, 4, 8192, 0),
 
         # TMRGSORTTest.case_exhausted
         TmrgsortParams("TMRGSORTTest.case_exhausted1", np.float32, 1, 64, 64, 0, 0, 2, 128, 0),
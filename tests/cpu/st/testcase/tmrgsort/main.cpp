@@ -278,6 +278,11 @@ TEST_F(TMRGSORTTest, case_multi2)
     TMrgsortMulti<uint16_t, 1, 128, 1, 128, 128, 128, 128, 512, 4, false>();
 }
 
+TEST_F(TMRGSORTTest, case_multi3)
+{
+    TMrgsortMulti<float, 1, 2048, 1, 2048, 2048, 2048, 2048, 8192, 4, false>();
+}
+
 TEST_F(TMRGSORTTest, case_exhausted1)
 {
     TMrgsortMulti<float, 1, 64, 1, 64, 64, 0, 0, 128, 2, true>();
@@ -308,6 +308,9 @@ template void LanchTMrgsortMulti<float, 1, 128, 1, 128, 128, 128, 128, 512, 4, f
 template void LanchTMrgsortMulti<uint16_t, 1, 128, 1, 128, 128, 128, 128, 512, 4, false>(float *out, float *src0,
                                                                                          float *src1, float *src2,
                                                                                          float *src3, void *stream);
+template void LanchTMrgsortMulti<float, 1, 2048, 1, 2048, 2048, 2048, 2048, 8192, 4, false>(float *out, float *src0,
+                                                                                            float *src1, float *src2,
+                                                                                            float *src3, void *stream);
 template void LanchTMrgsortMulti<float, 1, 128, 1, 128, 128, 128, 64, 448, 4, false>(float *out, float *src0,
                                                                                      float *src1, float *src2,
                                                                                      float *src3, void *stream);
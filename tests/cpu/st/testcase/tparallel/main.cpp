@@ -0,0 +1,27 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <gtest/gtest.h>
+#include "tparallel_kernel.h"
+
+TEST(TParallel, Resize)
+{
+    ASSERT_TRUE(RunPoolResize());
+}
+
+TEST(TParallel, Inline)
+{
+    ASSERT_TRUE(RunPoolInline());
+}
+
+TEST(TParallel, Restart)
+{
+    ASSERT_TRUE(RunPoolRestart());
+}
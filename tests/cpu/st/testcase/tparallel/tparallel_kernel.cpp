@@ -0,0 +1,70 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "tparallel_kernel.h"
+#include <pto/cpu/parallel.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace pto;
+
+namespace {
+constexpr std::size_t kIterations = 64;
+constexpr std::size_t kWorkElems = kIterations * PTO_CPU_PARALLEL_THRESHOLD_ELEMS;
+constexpr auto kJoinTimeout = std::chrono::seconds(5);
+
+// Threads that ran a parallel region. Every iteration waits until `expected` threads have joined, so the caller
+// cannot finish the region alone before the workers are scheduled.
+std::set<std::thread::id> RegionThreads(unsigned expected)
+{
+    std::mutex mutex;
+    std::condition_variable joined;
+    std::set<std::thread::id> threads;
+    cpu::parallel_for_1d(0, kIterations, kWorkElems, [&](std::size_t) {
+        std::unique_lock<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+        joined.notify_all();
+        joined.wait_for(lock, kJoinTimeout, [&]() { return threads.size() >= expected; });
+    });
+    return threads;
+}
+
+bool RegionRunsOn(unsigned threads)
+{
+    cpu::set_thread_count(threads);
+    const bool ok = cpu::get_thread_count() == threads && RegionThreads(threads).size() == threads;
+    cpu::set_thread_count(0);
+    return ok;
+}
+} // namespace
+
+bool RunPoolResize()
+{
+    return RegionRunsOn(3) && RegionRunsOn(2) && RegionRunsOn(4);
+}
+
+bool RunPoolInline()
+{
+    cpu::set_thread_count(1);
+    const std::set<std::thread::id> threads = RegionThreads(1);
+    cpu::set_thread_count(0);
+    return threads.size() == 1 && *threads.begin() == std::this_thread::get_id();
+}
+
+bool RunPoolRestart()
+{
+    const bool before = RegionRunsOn(3);
+    cpu::shutdown_thread_pool();
+    return before && RegionRunsOn(3);
+}
@@ -0,0 +1,23 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#pragma once
+
+// Thread-pool configuration tests for cpu::parallel_for_1d. Each returns false if the pool did not follow its
+// configuration.
+
+// Test 1: set_thread_count resizes the pool on the next parallel region, growing and shrinking it
+bool RunPoolResize();
+
+// Test 2: a pool of one thread runs every iteration inline on the calling thread
+bool RunPoolInline();
+
+// Test 3: shutdown_thread_pool joins the workers and the next parallel region restarts them
+bool RunPoolRestart();
@@ -0,0 +1,32 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <gtest/gtest.h>
+#include "tprofile_kernel.h"
+
+TEST(TProfile, Summary)
+{
+    ASSERT_TRUE(RunProfileSummary());
+}
+
+TEST(TProfile, AsyncPipes)
+{
+    ASSERT_TRUE(RunProfileAsyncPipes());
+}
+
+TEST(TProfile, ChromeTrace)
+{
+    ASSERT_TRUE(RunProfileChromeTrace("tprofile_trace.json"));
+}
+
+TEST(TProfile, Disabled)
+{
+    ASSERT_TRUE(RunProfileDisabled());
+}
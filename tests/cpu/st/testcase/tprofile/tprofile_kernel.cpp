@@ -0,0 +1,188 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "tprofile_kernel.h"
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using namespace pto;
+
+namespace {
+constexpr int kRows = 16;
+constexpr int kCols = 64;
+constexpr int kCount = kRows * kCols;
+constexpr uint64_t kTileBytes = kCount * sizeof(float);
+
+using GlobalData = GlobalTensor<float, Shape<1, 1, 1, kRows, kCols>, Stride<1, 1, 1, kCols, 1>>;
+using TileData = Tile<TileType::Vec, float, kRows, kCols, BLayout::RowMajor, -1, -1>;
+
+// out[slice] = a[slice] + b[slice]
+void AddSlice(float *out, float *a, float *b, int slice)
+{
+    TileData aTile(kRows, kCols);
+    TileData bTile(kRows, kCols);
+    TileData outTile(kRows, kCols);
+    GlobalData aGlobal(a + slice * kCount);
+    GlobalData bGlobal(b + slice * kCount);
+    GlobalData outGlobal(out + slice * kCount);
+    TLOAD(aTile, aGlobal);
+    TLOAD(bTile, bGlobal);
+    set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    TADD(outTile, aTile, bTile);
+    set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    TSTORE(outGlobal, outTile);
+}
+
+struct Buffers {
+    explicit Buffers(int slices) : a(slices * kCount, 1.0f), b(slices * kCount, 2.0f), out(slices * kCount, 0.0f)
+    {}
+
+    bool Summed() const
+    {
+        for (float v : out) {
+            if (v != 3.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<float> a;
+    std::vector<float> b;
+    std::vector<float> out;
+};
+
+std::vector<cpu::InstrRecord> RecordsOf(const char *name)
+{
+    std::vector<cpu::InstrRecord> found;
+    for (const cpu::InstrRecord &r : cpu::profile_records()) {
+        if (std::strcmp(r.name, name) == 0) {
+            found.push_back(r);
+        }
+    }
+    return found;
+}
+
+const cpu::InstrStats *StatsOf(const std::vector<cpu::InstrStats> &stats, const char *name)
+{
+    for (const cpu::InstrStats &s : stats) {
+        if (s.name == name) {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+// Enables profiling for one test and leaves it disabled and empty afterwards.
+struct ProfileSession {
+    ProfileSession()
+    {
+        cpu::reset_profile();
+        cpu::set_profiling(true);
+    }
+
+    ~ProfileSession()
+    {
+        cpu::set_profiling(false);
+        cpu::reset_profile();
+    }
+};
+} // namespace
+
+bool RunProfileSummary()
+{
+    ProfileSession session;
+    Buffers buf(1);
+    cpu::LaunchKernel(1, [&]() { AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), 0); });
+    cpu::set_profiling(false);
+
+    const std::vector<cpu::InstrStats> stats = cpu::profile_summary();
+    const cpu::InstrStats *load = StatsOf(stats, "TLOAD");
+    const cpu::InstrStats *add = StatsOf(stats, "TADD");
+    const cpu::InstrStats *store = StatsOf(stats, "TSTORE");
+    if (!buf.Summed() || load == nullptr || add == nullptr || store == nullptr) {
+        return false;
+    }
+    uint64_t histogramCalls = 0;
+    for (uint64_t n : add->histogram) {
+        histogramCalls += n;
+    }
+    return load->calls == 2 && load->bytesRead == 2 * kTileBytes && load->bytesWritten == 2 * kTileBytes &&
+           add->calls == 1 && add->bytesRead == 2 * kTileBytes && add->bytesWritten == kTileBytes &&
+           store->calls == 1 && store->bytesRead == kTileBytes && store->bytesWritten == kTileBytes &&
+           histogramCalls == 1 && add->minNs <= add->maxNs &&
+           RecordsOf("TADD")[0].operands == " Vec:f32[16x64 valid 16x64 row] Vec:f32[16x64 valid 16x64 row]"
+                                            " Vec:f32[16x64 valid 16x64 row]";
+}
+
+bool RunProfileAsyncPipes()
+{
+    ProfileSession session;
+    Buffers buf(1);
+    cpu::set_async_pipes(true);
+    cpu::LaunchKernel(1, [&]() { AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), 0); });
+    cpu::set_async_pipes(false);
+    cpu::set_profiling(false);
+
+    const std::vector<cpu::InstrRecord> loads = RecordsOf("TLOAD");
+    const std::vector<cpu::InstrRecord> adds = RecordsOf("TADD");
+    const std::vector<cpu::InstrRecord> stores = RecordsOf("TSTORE");
+    if (!buf.Summed() || loads.size() != 2 || adds.size() != 1 || stores.size() != 1) {
+        return false;
+    }
+    // MTE2, V and MTE3 each run on their own worker; the add starts only after both loads finished.
+    const std::set<uint32_t> threads = {loads[0].thread, adds[0].thread, stores[0].thread};
+    return threads.size() == 3 && loads[1].thread == loads[0].thread &&
+           adds[0].startNs >= loads[1].startNs + loads[1].durNs;
+}
+
+bool RunProfileChromeTrace(const std::string &path)
+{
+    constexpr int kBlocks = 4;
+    ProfileSession session;
+    Buffers buf(kBlocks);
+    cpu::LaunchKernel(kBlocks, [&]() {
+        AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), static_cast<int>(get_block_idx()));
+    });
+    cpu::set_profiling(false);
+
+    std::set<int64_t> cores;
+    for (const cpu::InstrRecord &r : RecordsOf("TADD")) {
+        cores.insert(r.core);
+    }
+    if (!buf.Summed() || cores.size() != kBlocks || !cpu::write_chrome_trace(path)) {
+        return false;
+    }
+    std::ifstream in(path);
+    const std::string trace((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const std::string complete = "\"ph\":\"X\"";
+    std::size_t events = 0;
+    for (std::size_t at = trace.find(complete); at != std::string::npos; at = trace.find(complete, at + 1)) {
+        events++;
+    }
+    return trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0 &&
+           trace.find("\"name\":\"TADD\"") != std::string::npos && trace.find("\"pid\":3") != std::string::npos &&
+           events == cpu::profile_records().size() && trace.substr(trace.size() - 4) == "\n]}\n";
+}
+
+bool RunProfileDisabled()
+{
+    cpu::reset_profile();
+    Buffers buf(1);
+    cpu::LaunchKernel(1, [&]() { AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), 0); });
+    return buf.Summed() && cpu::profile_records().empty();
+}
@@ -0,0 +1,28 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#pragma once
+
+#include <string>
+
+// Instruction profiler tests. Each runs a small kernel with cpu::set_profiling(true) and returns false if the
+// collected records do not match the instructions it issued.
+
+// Test 1: TLOAD x2, TADD, TSTORE on one core; checks per-instruction calls and bytes
+bool RunProfileSummary();
+
+// Test 2: the same kernel on simulated pipes; records must come from the pipe worker threads
+bool RunProfileAsyncPipes();
+
+// Test 3: a multi-core launch written as a Chrome trace to path; one trace process per core
+bool RunProfileChromeTrace(const std::string &path);
+
+// Test 4: nothing is recorded while profiling is disabled
+bool RunProfileDisabled();
@@ -9,6 +9,7 @@ See LICENSE in the root of the software repository for the full text of the Lice
 */
 
 #include <pto/pto-inst.hpp>
+#include <atomic>
 #include <functional>
 #include "test_common.h"
 #include <gtest/gtest.h>
@@ -24,18 +25,13 @@ void testPushPop()
     using PPDataFIFO = DataFIFO<T, FIFOType::GM_FIFO, 8, 1>;
     using PPSync = TFIFOSync<0, PPDataFIFO, TSyncOpType::TSTORE_C2GM, TSyncOpType::TLOAD>;
     using PPTile = Tile<srcLoc, T, rows, cols>;
-    using PPGlobal =
-        GlobalTensor<T, Shape<1, 1, 1, rows, cols>, Stride<rows * cols, rows * cols, rows * cols, cols, 1>>;
 
     T *srcDevice;
-    aclrtMalloc((void **)&srcDevice, PPTile::Numel * PPDataFIFO::fifoDepth, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&srcDevice, PPTile::Numel * PPDataFIFO::fifoDepth * sizeof(T), ACL_MEM_MALLOC_HUGE_FIRST);
     PPDataFIFO gmFIFO(srcDevice);
     PPTile src;
     PPTile dst;
 
-    std::vector<T> srcData(PPTile::Numel, 0);
-    std::vector<T> dstData(PPTile::Numel, 0);
-
     for (int i = 0; i < src.Numel; i++) {
         src.data()[i] = std::rand() / 1000.0;
     }
@@ -43,20 +39,138 @@ void testPushPop()
         dst.data()[i] = 0;
     }
 
-    PPGlobal srcTensor(srcData.data());
-    PPGlobal dstTensor(dstData.data());
-
-    typename PPSync::Producer prod;
-    typename PPSync::Consumer cons;
+    {
+        typename PPSync::Producer prod;
+        typename PPSync::Consumer cons;
 
-    TPUSH(prod, src, gmFIFO);
-    TPOP(cons, dst, gmFIFO);
+        TPUSH(prod, src, gmFIFO);
+        TPOP(cons, dst, gmFIFO);
+    }
 
-    EXPECT_TRUE(ResultCmp(srcData, dstData.data(), 0));
+    std::vector<T> srcData(src.data(), src.data() + PPTile::Numel);
+    EXPECT_TRUE(ResultCmp(srcData, dst.data(), 0));
 
     aclrtFree(srcDevice);
 }
 
+// Cube core streams kTiles tiles through a shallow FIFO while the Vec cores of the block pop them concurrently.
+template <int depth, int period, VecCubeRatio ratio>
+void testPushPopCrossCore()
+{
+    constexpr int rows = 16;
+    constexpr int cols = 32;
+    constexpr int kTiles = depth * 4 + 1;
+    using T = float;
+    using PPDataFIFO = DataFIFO<T, FIFOType::GM_FIFO, depth, period>;
+    using PPSync = TFIFOSync<1, PPDataFIFO, TSyncOpType::TSTORE_C2GM, TSyncOpType::TLOAD>;
+    using PPTile = Tile<TileType::Vec, T, rows, cols>;
+
+    T *fifoDevice;
+    aclrtMalloc((void **)&fifoDevice, PPTile::Numel * depth * sizeof(T), ACL_MEM_MALLOC_HUGE_FIRST);
+    std::atomic<int> mismatches{0};
+    std::atomic<int> popped{0};
+
+    cpu::LaunchMixKernel(
+        1, ratio,
+        [&]() {
+            PPDataFIFO gmFIFO(fifoDevice);
+            typename PPSync::Producer prod;
+            PPTile src;
+            for (int t = 0; t < kTiles; t++) {
+                for (int i = 0; i < PPTile::Numel; i++) {
+                    src.data()[i] = static_cast<T>(t * PPTile::Numel + i);
+                }
+                TPUSH(prod, src, gmFIFO);
+            }
+        },
+        [&]() {
+            PPDataFIFO gmFIFO(fifoDevice);
+            typename PPSync::Consumer cons;
+            PPTile dst;
+            for (int t = 0; t < kTiles; t++) {
+                TPOP(cons, dst, gmFIFO);
+                for (int i = 0; i < PPTile::Numel; i++) {
+                    if (dst.data()[i] != static_cast<T>(t * PPTile::Numel + i)) {
+                        mismatches++;
+                    }
+                }
+                popped++;
+            }
+        });
+
+    const int vecNum = (ratio == VecCubeRatio::V2C1_VECS) ? 2 : 1;
+    EXPECT_EQ(popped.load(), kTiles * vecNum);
+    EXPECT_EQ(mismatches.load(), 0);
+
+    aclrtFree(fifoDevice);
+}
+
+// A launch that leaves a tile in the FIFO must not leak its counts into the next launch of the same FIFO type.
+void testPushPopFreshChannelPerLaunch()
+{
+    constexpr int depth = 2;
+    constexpr int rows = 16;
+    constexpr int cols = 32;
+    constexpr int kTiles = 5;
+    using T = float;
+    using PPDataFIFO = DataFIFO<T, FIFOType::GM_FIFO, depth, 1>;
+    using PPSync = TFIFOSync<2, PPDataFIFO, TSyncOpType::TSTORE_C2GM, TSyncOpType::TLOAD>;
+    using PPTile = Tile<TileType::Vec, T, rows, cols>;
+
+    T *fifoDevice;
+    aclrtMalloc((void **)&fifoDevice, PPTile::Numel * depth * sizeof(T), ACL_MEM_MALLOC_HUGE_FIRST);
+
+    // The Cube core pushes one tile that no Vec core pops.
+    cpu::LaunchMixKernel(
+        1, VecCubeRatio::V1C1_VEC0,
+        [&]() {
+            PPDataFIFO gmFIFO(fifoDevice);
+            typename PPSync::Producer prod;
+            PPTile src;
+            std::fill(src.data(), src.data() + PPTile::Numel, T(-1));
+            TPUSH(prod, src, gmFIFO);
+        },
+        [&]() {});
+
+    std::atomic<int> staleCounts{0};
+    std::atomic<int> mismatches{0};
+    cpu::LaunchMixKernel(
+        1, VecCubeRatio::V1C1_VEC0,
+        [&]() {
+            if (PPSync::Channel().produced[0].load() != 0) {
+                staleCounts++;
+            }
+            PPDataFIFO gmFIFO(fifoDevice);
+            typename PPSync::Producer prod;
+            PPTile src;
+            for (int t = 0; t < kTiles; t++) {
+                std::fill(src.data(), src.data() + PPTile::Numel, static_cast<T>(t));
+                TPUSH(prod, src, gmFIFO);
+            }
+        },
+        [&]() {
+            if (PPSync::Channel().consumed[0].load() != 0) {
+                staleCounts++;
+            }
+            PPDataFIFO gmFIFO(fifoDevice);
+            typename PPSync::Consumer cons;
+            PPTile dst;
+            for (int t = 0; t < kTiles; t++) {
+                TPOP(cons, dst, gmFIFO);
+                for (int i = 0; i < PPTile::Numel; i++) {
+                    if (dst.data()[i] != static_cast<T>(t)) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+
+    EXPECT_EQ(staleCounts.load(), 0);
+    EXPECT_EQ(mismatches.load(), 0);
+
+    aclrtFree(fifoDevice);
+}
+
 class TPushPopTest : public testing::Test {
 protected:
     void SetUp() override
@@ -79,3 +193,20 @@ TPUSHPOP_TEST(uint32_t, 64, 128, Vec)
 TPUSHPOP_TEST(uint32_t, 128, 128, Vec)
 TPUSHPOP_TEST(uint32_t, 64, 128, Mat)
 TPUSHPOP_TEST(uint32_t, 128, 128, Mat)
+
+TEST_F(TPushPopTest, cross_core_depth2_period1_v1c1)
+{
+    testPushPopCrossCore<2, 1, VecCubeRatio::V1C1_VEC0>();
+}
+TEST_F(TPushPopTest, cross_core_depth4_period2_v2c1)
+{
+    testPushPopCrossCore<4, 2, VecCubeRatio::V2C1_VECS>();
+}
+TEST_F(TPushPopTest, cross_core_depth1_period1_v1c1_vec1)
+{
+    testPushPopCrossCore<1, 1, VecCubeRatio::V1C1_VEC1>();
+}
+TEST_F(TPushPopTest, fresh_channel_per_launch)
+{
+    testPushPopFreshChannelPerLaunch();
+}
@@ -28,7 +28,7 @@ AICORE void runTPut(__gm__ T __out__ *out, __gm__ T __in__ *input)
     GlobalData inputGlobal(input);
     GlobalData outputGlobal(out);
 
-    comm::TPUT(inputGlobal, outputGlobal, srcTile);
+    comm::TPUT(outputGlobal, inputGlobal, srcTile);
     out = outputGlobal.data();
 }
 
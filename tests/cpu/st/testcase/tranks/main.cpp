@@ -0,0 +1,167 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+// Test comm instructions driven from several ranks at once on CPU
+
+#include <gtest/gtest.h>
+#include "tranks_kernel.h"
+
+using pto::comm::CollectiveAlgo;
+using pto::cpu::RankMode;
+
+TEST(TRanks, NotifyAll_Threads)
+{
+    ASSERT_TRUE(RunRanksNotifyAll(4, RankMode::Thread));
+}
+
+TEST(TRanks, NotifyAll_Processes)
+{
+    ASSERT_TRUE(RunRanksNotifyAll(4, RankMode::Process));
+}
+
+TEST(TRanks, PutRing_Threads)
+{
+    ASSERT_TRUE(RunRanksPutRing(4, RankMode::Thread));
+}
+
+TEST(TRanks, PutRing_Processes)
+{
+    ASSERT_TRUE(RunRanksPutRing(4, RankMode::Process));
+}
+
+TEST(TRanks, AllReduce_Threads)
+{
+    ASSERT_TRUE(RunRanksAllReduce(4, RankMode::Thread));
+}
+
+TEST(TRanks, AllReduce_Processes)
+{
+    ASSERT_TRUE(RunRanksAllReduce(3, RankMode::Process));
+}
+
+TEST(TRanks, Broadcast_Threads)
+{
+    ASSERT_TRUE(RunRanksBroadcast(4, RankMode::Thread));
+}
+
+TEST(TRanks, Broadcast_Processes)
+{
+    ASSERT_TRUE(RunRanksBroadcast(4, RankMode::Process));
+}
+
+TEST(TRanks, BroadcastTree_8Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveBroadcast(8, RankMode::Thread, CollectiveAlgo::Tree));
+}
+
+TEST(TRanks, BroadcastRing_8Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveBroadcast(8, RankMode::Thread, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, BroadcastDirect_5Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveBroadcast(5, RankMode::Thread, CollectiveAlgo::Direct));
+}
+
+TEST(TRanks, BroadcastTree_Processes)
+{
+    ASSERT_TRUE(RunRanksCollectiveBroadcast(6, RankMode::Process, CollectiveAlgo::Tree));
+}
+
+TEST(TRanks, ReduceTree_8Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveReduce(8, RankMode::Thread, CollectiveAlgo::Tree));
+}
+
+TEST(TRanks, ReduceTree_7Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveReduce(7, RankMode::Thread, CollectiveAlgo::Tree));
+}
+
+TEST(TRanks, ReduceRing_8Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveReduce(8, RankMode::Thread, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, ReduceDirect_4Threads)
+{
+    ASSERT_TRUE(RunRanksCollectiveReduce(4, RankMode::Thread, CollectiveAlgo::Direct));
+}
+
+TEST(TRanks, ReduceRing_Processes)
+{
+    ASSERT_TRUE(RunRanksCollectiveReduce(5, RankMode::Process, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, AllReduceRing_8Threads)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(8, RankMode::Thread, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, AllReduceRing_3Threads)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(3, RankMode::Thread, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, AllReduceRing_1Thread)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(1, RankMode::Thread, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, AllReduceTree_8Threads)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(8, RankMode::Thread, CollectiveAlgo::Tree));
+}
+
+TEST(TRanks, AllReduceDirect_4Threads)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(4, RankMode::Thread, CollectiveAlgo::Direct));
+}
+
+TEST(TRanks, AllReduceRing_Processes)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(8, RankMode::Process, CollectiveAlgo::Ring));
+}
+
+TEST(TRanks, AllReduceTree_Processes)
+{
+    ASSERT_TRUE(RunRanksAllReduceCollective(6, RankMode::Process, CollectiveAlgo::Tree));
+}
+
+TEST(TRanks, ScatterGather_Threads)
+{
+    ASSERT_TRUE(RunRanksScatterGather(4, RankMode::Thread));
+}
+
+TEST(TRanks, ScatterGather_Processes)
+{
+    ASSERT_TRUE(RunRanksScatterGather(3, RankMode::Process));
+}
+
+TEST(TRanks, Abort_Threads)
+{
+    ASSERT_TRUE(RunRanksAbort(4, RankMode::Thread));
+}
+
+TEST(TRanks, Abort_Processes)
+{
+    ASSERT_TRUE(RunRanksAbort(4, RankMode::Process));
+}
+
+TEST(TRanks, AtomicPut_Threads)
+{
+    ASSERT_TRUE(RunRanksAtomicPut(4, RankMode::Thread));
+}
+
+TEST(TRanks, AtomicPut_Processes)
+{
+    ASSERT_TRUE(RunRanksAtomicPut(4, RankMode::Process));
+}
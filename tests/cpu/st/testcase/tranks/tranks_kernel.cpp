@@ -0,0 +1,383 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "tranks_kernel.h"
+#include <pto/common/constants.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+
+using namespace pto;
+using namespace pto::comm;
+
+namespace {
+constexpr int kRows = 16;
+constexpr int kCols = 64;
+constexpr int kCount = kRows * kCols;
+constexpr std::size_t kWindowBytes = 1 << 20;
+
+using GShape = Shape<1, 1, 1, kRows, kCols>;
+using GStride = Stride<1, 1, 1, kCols, 1>;
+using Global = GlobalTensor<int32_t, GShape, GStride>;
+using TileData = Tile<TileType::Vec, int32_t, kRows, kCols, BLayout::RowMajor, -1, -1>;
+
+void Check(bool ok)
+{
+    if (!ok) {
+        throw std::runtime_error("rank saw wrong data");
+    }
+}
+
+// Collective tests use a shape that does not tile evenly, so the last row chunk is partial and some ring segments
+// are empty on larger groups.
+constexpr int kCollRows = 40;
+constexpr int kCollCols = 64;
+constexpr int kCollCount = kCollRows * kCollCols;
+constexpr int kMaxRanks = 16;
+using CollGlobal = GlobalTensor<int32_t, Shape<1, 1, 1, kCollRows, kCollCols>, Stride<1, 1, 1, kCollCols, 1>>;
+using CollTile = Tile<TileType::Vec, int32_t, 16, 32, BLayout::RowMajor, -1, -1>;
+using SignalBlock = GlobalTensor<int32_t, Shape<1, 1, 1, 1, 2 * kMaxRanks>, Stride<1, 1, 1, 2 * kMaxRanks, 1>>;
+
+struct CollectiveSetup {
+    CollGlobal src[kMaxRanks];
+    CollGlobal dst[kMaxRanks];
+    SignalBlock sig[kMaxRanks];
+    int32_t *srcLocal;
+    int32_t *dstLocal;
+
+    explicit CollectiveSetup(cpu::RankContext &ctx)
+    {
+        srcLocal = ctx.Alloc<int32_t>(kCollCount);
+        dstLocal = ctx.Alloc<int32_t>(kCollCount);
+        int32_t *sigLocal = ctx.Alloc<int32_t>(CollectiveSignalWords(kMaxRanks));
+        ctx.PeerTensors(src, srcLocal, [](int32_t *p) { return CollGlobal(p); });
+        ctx.PeerTensors(dst, dstLocal, [](int32_t *p) { return CollGlobal(p); });
+        ctx.PeerTensors(sig, sigLocal, [](int32_t *p) { return SignalBlock(p); });
+    }
+};
+
+template <typename Fn>
+bool Run(int nranks, cpu::RankMode mode, Fn fn)
+{
+    try {
+        cpu::LaunchRanks(nranks, kWindowBytes, mode, fn);
+    } catch (const std::exception &) {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+// ============================================================================
+// Test 1: all-to-all TNOTIFY
+// ============================================================================
+bool RunRanksNotifyAll(int nranks, cpu::RankMode mode)
+{
+    return Run(nranks, mode, [](cpu::RankContext &ctx) {
+        int32_t *flag = ctx.Alloc<int32_t>(1);
+        for (int peer = 0; peer < ctx.Size(); ++peer) {
+            Signal remote(ctx.Peer(flag, peer));
+            TNOTIFY(remote, 1, NotifyOp::AtomicAdd);
+        }
+        Signal mine(flag);
+        TWAIT(mine, ctx.Size(), WaitCmp::EQ);
+    });
+}
+
+// ============================================================================
+// Test 2: TPUT ring
+// ============================================================================
+bool RunRanksPutRing(int nranks, cpu::RankMode mode)
+{
+    return Run(nranks, mode, [](cpu::RankContext &ctx) {
+        int32_t *src = ctx.Alloc<int32_t>(kCount);
+        int32_t *recv = ctx.Alloc<int32_t>(kCount);
+        int32_t *flag = ctx.Alloc<int32_t>(1);
+        const int next = (ctx.Rank() + 1) % ctx.Size();
+        const int prev = (ctx.Rank() + ctx.Size() - 1) % ctx.Size();
+        for (int i = 0; i < kCount; ++i) {
+            src[i] = ctx.Rank() * kCount + i;
+        }
+
+        Global srcG(src);
+        Global dstG(ctx.Peer(recv, next));
+        TileData staging(kRows, kCols);
+        TPUT(dstG, srcG, staging);
+        Signal remote(ctx.Peer(flag, next));
+        TNOTIFY(remote, 1, NotifyOp::Set);
+
+        Signal mine(flag);
+        TWAIT(mine, 1, WaitCmp::EQ);
+        for (int i = 0; i < kCount; ++i) {
+            Check(recv[i] == prev * kCount + i);
+        }
+    });
+}
+
+// ============================================================================
+// Test 3: all-reduce via per-rank TREDUCE
+// ============================================================================
+bool RunRanksAllReduce(int nranks, cpu::RankMode mode)
+{
+    return Run(nranks, mode, [](cpu::RankContext &ctx) {
+        int32_t *src = ctx.Alloc<int32_t>(kCount);
+        int32_t *out = ctx.Alloc<int32_t>(kCount);
+        for (int i = 0; i < kCount; ++i) {
+            src[i] = (ctx.Rank() + 1) * i;
+        }
+        ctx.Barrier();
+
+        Global tensors[8];
+        ctx.PeerTensors(tensors, src, [](int32_t *p) { return Global(p); });
+        ParallelGroup<Global> group(tensors, ctx.Size(), ctx.Rank());
+        Global outG(out);
+        TileData acc(kRows, kCols);
+        TileData recv(kRows, kCols);
+        TREDUCE(group, outG, acc, recv, ReduceOp::Sum);
+
+        const int rankSum = ctx.Size() * (ctx.Size() + 1) / 2;
+        for (int i = 0; i < kCount; ++i) {
+            Check(out[i] == rankSum * i);
+        }
+    });
+}
+
+// ============================================================================
+// Test 4: TBROADCAST from rank 0
+// ============================================================================
+bool RunRanksBroadcast(int nranks, cpu::RankMode mode)
+{
+    return Run(nranks, mode, [](cpu::RankContext &ctx) {
+        int32_t *src = ctx.Alloc<int32_t>(kCount);
+        int32_t *dst = ctx.Alloc<int32_t>(kCount);
+        if (ctx.Rank() == 0) {
+            for (int i = 0; i < kCount; ++i) {
+                src[i] = 7 * i + 3;
+            }
+            Global tensors[8];
+            ctx.PeerTensors(tensors, dst, [](int32_t *p) { return Global(p); });
+            ParallelGroup<Global> group(tensors, ctx.Size(), 0);
+            Global srcG(src);
+            TileData staging(kRows, kCols);
+            TBROADCAST(group, srcG, staging);
+        }
+        ctx.Barrier();
+        for (int i = 0; i < kCount; ++i) {
+            Check(dst[i] == 7 * i + 3);
+        }
+        ctx.Barrier();
+        // Second round: the root broadcasts out of its own member buffer.
+        if (ctx.Rank() == 0) {
+            for (int i = 0; i < kCount; ++i) {
+                dst[i] = 5 * i + 1;
+            }
+            Global tensors[8];
+            ctx.PeerTensors(tensors, dst, [](int32_t *p) { return Global(p); });
+            ParallelGroup<Global> group(tensors, ctx.Size(), 0);
+            Global srcG(dst);
+            TileData staging(kRows, kCols);
+            TBROADCAST(group, srcG, staging);
+        }
+        ctx.Barrier();
+        for (int i = 0; i < kCount; ++i) {
+            Check(dst[i] == 5 * i + 1);
+        }
+    });
+}
+
+// ============================================================================
+// Test 5: collective TBROADCAST
+// ============================================================================
+bool RunRanksCollectiveBroadcast(int nranks, cpu::RankMode mode, CollectiveAlgo algo)
+{
+    return Run(nranks, mode, [algo](cpu::RankContext &ctx) {
+        CollectiveSetup setup(ctx);
+        ParallelGroup<SignalBlock> signals(setup.sig, ctx.Size(), ctx.Rank());
+        CollTile ping(16, 32);
+        CollTile pong(16, 32);
+        // Two rounds with different roots reuse the same signal blocks.
+        for (int round = 0; round < 2; ++round) {
+            const int root = (round * 3 + 1) % ctx.Size();
+            for (int i = 0; i < kCollCount; ++i) {
+                setup.srcLocal[i] = ctx.Rank() == root ? round * 1000 + i : -1;
+            }
+            ParallelGroup<CollGlobal> group(setup.dst, ctx.Size(), root);
+            TBROADCAST(group, setup.src[ctx.Rank()], signals, ctx.Rank(), ping, pong, algo);
+            for (int i = 0; i < kCollCount; ++i) {
+                Check(setup.dstLocal[i] == round * 1000 + i);
+            }
+        }
+    });
+}
+
+// ============================================================================
+// Test 6: collective TREDUCE
+// ============================================================================
+bool RunRanksCollectiveReduce(int nranks, cpu::RankMode mode, CollectiveAlgo algo)
+{
+    return Run(nranks, mode, [algo](cpu::RankContext &ctx) {
+        CollectiveSetup setup(ctx);
+        ParallelGroup<SignalBlock> signals(setup.sig, ctx.Size(), ctx.Rank());
+        CollTile acc(16, 32);
+        CollTile ping(16, 32);
+        CollTile pong(16, 32);
+        const int n = ctx.Size();
+        for (int round = 0; round < 2; ++round) {
+            const int root = (n - 1 + round) % n;
+            const ReduceOp op = round == 0 ? ReduceOp::Sum : ReduceOp::Max;
+            for (int i = 0; i < kCollCount; ++i) {
+                setup.srcLocal[i] = (ctx.Rank() + 1) * (i % 97) - round * ctx.Rank();
+            }
+            ParallelGroup<CollGlobal> srcGroup(setup.src, n, root);
+            ParallelGroup<CollGlobal> dstGroup(setup.dst, n, root);
+            TREDUCE(srcGroup, dstGroup, signals, ctx.Rank(), acc, ping, pong, op, algo);
+            if (ctx.Rank() != root) {
+                continue;
+            }
+            for (int i = 0; i < kCollCount; ++i) {
+                int32_t expect = 0;
+                for (int r = 0; r < n; ++r) {
+                    const int32_t v = (r + 1) * (i % 97) - round * r;
+                    expect = (r == 0) ? v : (op == ReduceOp::Sum ? expect + v : std::max(expect, v));
+                }
+                Check(setup.dstLocal[i] == expect);
+            }
+        }
+    });
+}
+
+// ============================================================================
+// Test 7: TALLREDUCE
+// ============================================================================
+bool RunRanksAllReduceCollective(int nranks, cpu::RankMode mode, CollectiveAlgo algo)
+{
+    return Run(nranks, mode, [algo](cpu::RankContext &ctx) {
+        CollectiveSetup setup(ctx);
+        ParallelGroup<SignalBlock> signals(setup.sig, ctx.Size(), ctx.Rank());
+        CollTile acc(16, 32);
+        CollTile ping(16, 32);
+        CollTile pong(16, 32);
+        const int n = ctx.Size();
+        const int rankSum = n * (n + 1) / 2;
+        for (int i = 0; i < kCollCount; ++i) {
+            setup.srcLocal[i] = (ctx.Rank() + 1) * i;
+        }
+        ParallelGroup<CollGlobal> srcGroup(setup.src, n, ctx.Rank());
+        ParallelGroup<CollGlobal> dstGroup(setup.dst, n, ctx.Rank());
+        TALLREDUCE(srcGroup, dstGroup, signals, ctx.Rank(), acc, ping, pong, ReduceOp::Sum, algo);
+        for (int i = 0; i < kCollCount; ++i) {
+            Check(setup.dstLocal[i] == rankSum * i);
+            Check(setup.srcLocal[i] == (ctx.Rank() + 1) * i);
+        }
+
+        // In place: reduce the result once more.
+        TALLREDUCE(dstGroup, dstGroup, signals, ctx.Rank(), acc, ping, pong, ReduceOp::Sum, algo);
+        for (int i = 0; i < kCollCount; ++i) {
+            Check(setup.dstLocal[i] == n * rankSum * i);
+        }
+    });
+}
+
+// ============================================================================
+// Test 8: TSCATTER then TGATHER through a root buffer whose rows are padded, so the two sides of every copy have
+// different strides
+// ============================================================================
+bool RunRanksScatterGather(int nranks, cpu::RankMode mode)
+{
+    return Run(nranks, mode, [](cpu::RankContext &ctx) {
+        constexpr int pitch = kCols + 8;
+        using WholeShape = Shape<1, 1, 1, DYNAMIC, DYNAMIC>;
+        using WholeStride = Stride<DYNAMIC, DYNAMIC, DYNAMIC, DYNAMIC, DYNAMIC>;
+        using WholeGlobal = GlobalTensor<int32_t, WholeShape, WholeStride>;
+        const int n = ctx.Size();
+        const int wholeRows = n * kRows;
+        int32_t *slice = ctx.Alloc<int32_t>(kCount);
+        int32_t *whole = ctx.Alloc<int32_t>(static_cast<std::size_t>(kMaxRanks) * kRows * pitch);
+        Global slices[kMaxRanks];
+        ctx.PeerTensors(slices, slice, [](int32_t *p) { return Global(p); });
+        ParallelGroup<Global> group(slices, n, 0);
+        WholeGlobal wholeG(whole, WholeShape(1, 1, 1, wholeRows, kCols),
+                           WholeStride(wholeRows * pitch, wholeRows * pitch, wholeRows * pitch, pitch, 1));
+        TileData staging(kRows, kCols);
+        if (ctx.Rank() == 0) {
+            for (int r = 0; r < wholeRows; ++r) {
+                for (int c = 0; c < pitch; ++c) {
+                    whole[r * pitch + c] = c < kCols ? r * 1000 + c : -7;
+                }
+            }
+            comm::TSCATTER(group, wholeG, staging);
+        }
+        ctx.Barrier();
+        for (int i = 0; i < kCount; ++i) {
+            const int row = ctx.Rank() * kRows + i / kCols;
+            Check(slice[i] == row * 1000 + i % kCols);
+            slice[i] = -slice[i];
+        }
+        ctx.Barrier();
+        if (ctx.Rank() == 0) {
+            TileData ping(kRows, kCols);
+            TileData pong(kRows, kCols);
+            comm::TGATHER(group, wholeG, ping, pong);
+            for (int r = 0; r < wholeRows; ++r) {
+                for (int c = 0; c < pitch; ++c) {
+                    Check(whole[r * pitch + c] == (c < kCols ? -(r * 1000 + c) : -7));
+                }
+            }
+        }
+    });
+}
+
+// ============================================================================
+// Test 9: rank 1 fails before the barrier; rank 0 waits on a flag only rank 1 would set, the rest in Barrier
+// ============================================================================
+bool RunRanksAbort(int nranks, cpu::RankMode mode)
+{
+    return !Run(nranks, mode, [](cpu::RankContext &ctx) {
+        int32_t *flag = ctx.Alloc<int32_t>(1);
+        if (ctx.Rank() == 1) {
+            throw std::runtime_error("rank 1 failed");
+        }
+        if (ctx.Rank() == 0) {
+            Signal mine(flag);
+            TWAIT(mine, 1, WaitCmp::EQ);
+        } else {
+            ctx.Barrier();
+        }
+    });
+}
+
+// ============================================================================
+// Test 10: every rank TPUT-adds into rank 0's buffer many times, so concurrent adds to the same words must all land
+// ============================================================================
+bool RunRanksAtomicPut(int nranks, cpu::RankMode mode)
+{
+    return Run(nranks, mode, [](cpu::RankContext &ctx) {
+        constexpr int rounds = 1000;
+        int32_t *src = ctx.Alloc<int32_t>(kCount);
+        int32_t *acc = ctx.Alloc<int32_t>(kCount);
+        for (int i = 0; i < kCount; ++i) {
+            src[i] = (ctx.Rank() + 1) * (i % 13 + 1);
+        }
+        Global srcG(src);
+        Global dstG(ctx.Peer(acc, 0));
+        TileData staging(kRows, kCols);
+        for (int round = 0; round < rounds; ++round) {
+            TPUT<AtomicType::AtomicAdd>(dstG, srcG, staging);
+        }
+        ctx.Barrier();
+        if (ctx.Rank() == 0) {
+            const int rankSum = ctx.Size() * (ctx.Size() + 1) / 2;
+            for (int i = 0; i < kCount; ++i) {
+                Check(acc[i] == rounds * rankSum * (i % 13 + 1));
+            }
+        }
+    });
+}
@@ -0,0 +1,46 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#pragma once
+
+#include <pto/pto-inst.hpp>
+
+// Multi-rank CPU tests: every rank runs the kernel at once through pto::cpu::LaunchRanks, either as threads or as
+// forked processes sharing one symmetric heap. Each returns false if any rank saw wrong data.
+
+// Test 1: every rank TNOTIFY-adds into every peer's signal, then TWAITs for its own to reach nranks
+bool RunRanksNotifyAll(int nranks, pto::cpu::RankMode mode);
+
+// Test 2: each rank TPUTs its buffer into the next rank and flags it
+bool RunRanksPutRing(int nranks, pto::cpu::RankMode mode);
+
+// Test 3: every rank runs TREDUCE rooted at itself, i.e. an all-reduce
+bool RunRanksAllReduce(int nranks, pto::cpu::RankMode mode);
+
+// Test 4: rank 0 TBROADCASTs into every rank's window, from a separate buffer and then from its own window
+bool RunRanksBroadcast(int nranks, pto::cpu::RankMode mode);
+
+// Test 5: collective TBROADCAST (every rank calls it) with the given algorithm
+bool RunRanksCollectiveBroadcast(int nranks, pto::cpu::RankMode mode, pto::comm::CollectiveAlgo algo);
+
+// Test 6: collective TREDUCE with the given algorithm
+bool RunRanksCollectiveReduce(int nranks, pto::cpu::RankMode mode, pto::comm::CollectiveAlgo algo);
+
+// Test 7: TALLREDUCE, out of place and then in place, with the given algorithm
+bool RunRanksAllReduceCollective(int nranks, pto::cpu::RankMode mode, pto::comm::CollectiveAlgo algo);
+
+// Test 8: rank 0 TSCATTERs a row-padded buffer to every rank, then TGATHERs the ranks' updates back into it
+bool RunRanksScatterGather(int nranks, pto::cpu::RankMode mode);
+
+// Test 9: one rank throws before a barrier; true if the launch reports the failure instead of hanging
+bool RunRanksAbort(int nranks, pto::cpu::RankMode mode);
+
+// Test 10: every rank repeatedly TPUT<AtomicAdd>s into rank 0's buffer; checks that no update is lost
+bool RunRanksAtomicPut(int nranks, pto::cpu::RankMode mode);
@@ -0,0 +1,56 @@
+#!/usr/bin/python3
+# coding=utf-8
+# --------------------------------------------------------------------------------
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# --------------------------------------------------------------------------------
+
+import os
+import struct
+import numpy as np
+np.random.seed(29)
+
+
+def gen_golden_data(param):
+    data_type = param.data_type
+    rows = param.row
+    cols = param.col
+
+    input_arr = np.random.uniform(low=-8, high=8, size=(rows, cols)).astype(data_type)
+    scalar = np.random.randint(low=-8, high=8)
+    # TRESHAPE shares storage, so adding through the reshaped tile updates the original one.
+    output_arr = (input_arr + data_type(scalar)).astype(data_type)
+    input_arr.tofile('input.bin')
+    with open("scalar.bin", 'wb') as f:
+        f.write(struct.pack('f', np.float32(scalar)))
+    output_arr.tofile('golden.bin')
+
+
+class TReshapeParams:
+    def __init__(self, name, data_type, row, col):
+        self.name = name
+        self.data_type = data_type
+        self.row = row
+        self.col = col
+
+
+if __name__ == "__main__":
+    case_params_list = [
+        TReshapeParams("TRESHAPETest.case1", np.float32, 16, 64),
+        TReshapeParams("TRESHAPETest.case2", np.float16, 32, 128),
+        TReshapeParams("TRESHAPETest.case3", np.int32, 8, 256),
+        TReshapeParams("TRESHAPETest.case4", np.float32, 16, 64),
+    ]
+
+    for _, case in enumerate(case_params_list):
+        if not os.path.exists(case.name):
+            os.makedirs(case.name)
+        original_dir = os.getcwd()
+        os.chdir(case.name)
+        gen_golden_data(case)
+        os.chdir(original_dir)
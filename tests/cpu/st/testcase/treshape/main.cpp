@@ -0,0 +1,112 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+#include "test_common.h"
+#include <gtest/gtest.h>
+#include <pto/pto-inst.hpp>
+
+using namespace std;
+using namespace PtoTestCommon;
+
+template <uint32_t caseId>
+void launchTRESHAPETestCase(void *out, void *src, float scalar, aclrtStream stream);
+
+class TRESHAPETest : public testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+};
+
+std::string GetGoldenDir()
+{
+    const testing::TestInfo *testInfo = testing::UnitTest::GetInstance()->current_test_info();
+    const std::string caseName = testInfo->name();
+    std::string suiteName = testInfo->test_suite_name();
+    std::string fullPath = "../" + suiteName + "." + caseName;
+    return fullPath;
+}
+
+template <uint32_t caseId, typename T, int row, int col>
+bool TReshapeTestFramework()
+{
+    aclInit(nullptr);
+    aclrtSetDevice(0);
+
+    aclrtStream stream;
+    aclrtCreateStream(&stream);
+
+    size_t byteSize = row * col * sizeof(T);
+    T *dstHost;
+    T *srcHost;
+    T *dstDevice;
+    T *srcDevice;
+    float scalar;
+
+    aclrtMallocHost((void **)(&dstHost), byteSize);
+    aclrtMallocHost((void **)(&srcHost), byteSize);
+
+    aclrtMalloc((void **)&dstDevice, byteSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&srcDevice, byteSize, ACL_MEM_MALLOC_HUGE_FIRST);
+
+    ReadFile(GetGoldenDir() + "/input.bin", byteSize, srcHost, byteSize);
+    std::ifstream file(GetGoldenDir() + "/scalar.bin", std::ios::binary);
+    file.read(reinterpret_cast<char *>(&scalar), 4);
+    file.close();
+
+    aclrtMemcpy(srcDevice, byteSize, srcHost, byteSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    launchTRESHAPETestCase<caseId>(dstDevice, srcDevice, scalar, stream);
+    aclrtSynchronizeStream(stream);
+    aclrtMemcpy(dstHost, byteSize, dstDevice, byteSize, ACL_MEMCPY_DEVICE_TO_HOST);
+
+    WriteFile(GetGoldenDir() + "/output.bin", dstHost, byteSize);
+
+    aclrtFree(dstDevice);
+    aclrtFree(srcDevice);
+
+    aclrtFreeHost(dstHost);
+    aclrtFreeHost(srcHost);
+
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(0);
+    aclFinalize();
+
+    std::vector<T> golden(row * col);
+    std::vector<T> devFinal(row * col);
+    ReadFile(GetGoldenDir() + "/golden.bin", byteSize, golden.data(), byteSize);
+    ReadFile(GetGoldenDir() + "/output.bin", byteSize, devFinal.data(), byteSize);
+
+    return ResultCmp<T>(golden, devFinal, 0.001f);
+}
+
+TEST_F(TRESHAPETest, case1)
+{
+    bool ret = TReshapeTestFramework<1, float, 16, 64>();
+    EXPECT_TRUE(ret);
+}
+
+TEST_F(TRESHAPETest, case2)
+{
+    bool ret = TReshapeTestFramework<2, aclFloat16, 32, 128>();
+    EXPECT_TRUE(ret);
+}
+
+TEST_F(TRESHAPETest, case3)
+{
+    bool ret = TReshapeTestFramework<3, int32_t, 8, 256>();
+    EXPECT_TRUE(ret);
+}
+
+TEST_F(TRESHAPETest, case4)
+{
+    bool ret = TReshapeTestFramework<4, float, 16, 64>();
+    EXPECT_TRUE(ret);
+}
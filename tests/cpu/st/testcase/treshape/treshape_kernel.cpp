@@ -0,0 +1,91 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+
+using namespace std;
+using namespace pto;
+
+// Reshapes an [row, col] tile to [row * col / 32, 32], adds scalar through the reshaped tile and stores the original
+// one: the result only carries the addition if the two tiles share their elements.
+template <typename T, int row, int col, bool assign>
+PTO_INTERNAL void runTReshape(__gm__ T *out, __gm__ T *src, T scalar)
+{
+    using GlobalData = GlobalTensor<T, Shape<1, 1, 1, row, col>, pto::Stride<1, 1, 1, col, 1>>;
+    GlobalData srcGlobal(src);
+    GlobalData dstGlobal(out);
+
+    using srcTileData = Tile<TileType::Vec, T, row, col, BLayout::RowMajor>;
+    using dstTileData = Tile<TileType::Vec, T, row * col / 32, 32, BLayout::RowMajor>;
+    srcTileData srcTile;
+    dstTileData dstTile;
+    if constexpr (assign) {
+        TASSIGN(srcTile, 0x0);
+        TASSIGN(dstTile, 0x20000);
+    }
+
+    TLOAD(srcTile, srcGlobal);
+    set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    TRESHAPE(dstTile, srcTile);
+    TADDS(dstTile, dstTile, scalar);
+    set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    TSTORE(dstGlobal, srcTile);
+    out = dstGlobal.data();
+}
+
+extern "C" __global__ AICORE void launchTRESHAPECase1(__gm__ float *out, __gm__ float *src, float scalar)
+{
+    runTReshape<float, 16, 64, true>(out, src, scalar);
+}
+extern "C" __global__ AICORE void launchTRESHAPECase2(__gm__ aclFloat16 *out, __gm__ aclFloat16 *src, float scalar)
+{
+    runTReshape<half, 32, 128, true>((__gm__ half *)out, (__gm__ half *)src, (half)scalar);
+}
+extern "C" __global__ AICORE void launchTRESHAPECase3(__gm__ int32_t *out, __gm__ int32_t *src, int32_t scalar)
+{
+    runTReshape<int32_t, 8, 256, true>(out, src, scalar);
+}
+extern "C" __global__ AICORE void launchTRESHAPECase4(__gm__ float *out, __gm__ float *src, float scalar)
+{
+    runTReshape<float, 16, 64, false>(out, src, scalar);
+}
+
+template <uint32_t caseId>
+void launchTRESHAPETestCase(void *out, void *src, float scalar, aclrtStream stream)
+{
+    switch (caseId) {
+        case 1: {
+            launchTRESHAPECase1((float *)out, (float *)src, scalar);
+            break;
+        }
+        case 2: {
+            launchTRESHAPECase2((aclFloat16 *)out, (aclFloat16 *)src, scalar);
+            break;
+        }
+        case 3: {
+            launchTRESHAPECase3((int32_t *)out, (int32_t *)src, static_cast<int32_t>(scalar));
+            break;
+        }
+        case 4: {
+            launchTRESHAPECase4((float *)out, (float *)src, scalar);
+            break;
+        }
+        default: {
+        }
+    }
+}
+
+template void launchTRESHAPETestCase<1>(void *out, void *src, float scalar, aclrtStream stream);
+template void launchTRESHAPETestCase<2>(void *out, void *src, float scalar, aclrtStream stream);
+template void launchTRESHAPETestCase<3>(void *out, void *src, float scalar, aclrtStream stream);
+template void launchTRESHAPETestCase<4>(void *out, void *src, float scalar, aclrtStream stream);
@@ -0,0 +1,61 @@
+#!/usr/bin/python3
+# coding=utf-8
+# --------------------------------------------------------------------------------
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# --------------------------------------------------------------------------------
+
+import os
+import numpy as np
+np.random.seed(19)
+
+
+def gen_golden_data_trowsoftmax(param):
+    rows, cols = param.rows, param.cols
+    input1 = np.random.uniform(low=-16, high=16, size=[rows, cols]).astype(param.dtype)
+    if param.causal:
+        # Masked scores, as a causal attention tile feeds them: everything right of the diagonal is -inf.
+        input1[np.triu_indices(rows, 1, cols)] = -np.inf
+
+    scaled = input1.astype(np.float32) * np.float32(param.scale)
+    row_max = np.max(scaled, axis=1)
+    exp = np.exp(scaled - row_max[:, None])
+    row_sum = np.sum(exp, axis=1, dtype=np.float32)
+    golden = (exp / row_sum[:, None]).astype(param.dtype)
+    stats = np.concatenate([row_max, row_sum]).astype(np.float32)
+
+    input1.tofile("input1.bin")
+    golden.tofile("golden.bin")
+    stats.tofile("golden_stats.bin")
+
+
+class TRowSoftmaxParams:
+    def __init__(self, name, dtype, rows, cols, scale, causal=False):
+        self.name = name
+        self.dtype = dtype
+        self.rows = rows
+        self.cols = cols
+        self.scale = scale
+        self.causal = causal
+
+
+if __name__ == "__main__":
+    case_params_list = [
+        TRowSoftmaxParams("TROWSOFTMAXTest.case_float_64x64_scale1", np.float32, 64, 64, 1.0),
+        TRowSoftmaxParams("TROWSOFTMAXTest.case_float_32x128_scale0125", np.float32, 32, 128, 0.125),
+        TRowSoftmaxParams("TROWSOFTMAXTest.case_half_16x256_scale05", np.float16, 16, 256, 0.5),
+        TRowSoftmaxParams("TROWSOFTMAXTest.case_float_64x64_causal", np.float32, 64, 64, 0.25, causal=True),
+    ]
+
+    for param in case_params_list:
+        if not os.path.exists(param.name):
+            os.makedirs(param.name)
+        original_dir = os.getcwd()
+        os.chdir(param.name)
+        gen_golden_data_trowsoftmax(param)
+        os.chdir(original_dir)
@@ -0,0 +1,113 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "test_common.h"
+#include <pto/pto-inst.hpp>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace PtoTestCommon;
+
+class TROWSOFTMAXTest : public testing::Test {
+protected:
+    void SetUp() override
+    {}
+    void TearDown() override
+    {}
+};
+
+std::string GetGoldenDir()
+{
+    const testing::TestInfo *testInfo = testing::UnitTest::GetInstance()->current_test_info();
+    const std::string caseName = testInfo->name();
+    std::string suiteName = testInfo->test_suite_name();
+    std::string fullPath = "../" + suiteName + "." + caseName;
+    return fullPath;
+}
+
+template <typename T, int kTRows_, int kTCols_, float kScale>
+void LaunchTROWSOFTMAX(T *out, float *stats, T *src, void *stream);
+
+template <typename T, int kTRows_, int kTCols_, float kScale>
+void test_trowsoftmax()
+{
+    size_t dataFileSize = kTRows_ * kTCols_ * sizeof(T);
+    size_t statsFileSize = 2 * kTRows_ * sizeof(float);
+
+    aclInit(nullptr);
+    aclrtSetDevice(0);
+    aclrtStream stream;
+    aclrtCreateStream(&stream);
+
+    T *dstHost, *srcHost;
+    T *dstDevice, *srcDevice;
+    float *statsHost, *statsDevice;
+
+    aclrtMallocHost((void **)(&dstHost), dataFileSize);
+    aclrtMallocHost((void **)(&srcHost), dataFileSize);
+    aclrtMallocHost((void **)(&statsHost), statsFileSize);
+
+    aclrtMalloc((void **)&dstDevice, dataFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&srcDevice, dataFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&statsDevice, statsFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/input1.bin", dataFileSize, srcHost, dataFileSize));
+
+    aclrtMemcpy(srcDevice, dataFileSize, srcHost, dataFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    LaunchTROWSOFTMAX<T, kTRows_, kTCols_, kScale>(dstDevice, statsDevice, srcDevice, stream);
+
+    aclrtSynchronizeStream(stream);
+    aclrtMemcpy(dstHost, dataFileSize, dstDevice, dataFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
+    aclrtMemcpy(statsHost, statsFileSize, statsDevice, statsFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
+
+    WriteFile(GetGoldenDir() + "/output.bin", dstHost, dataFileSize);
+    WriteFile(GetGoldenDir() + "/output_stats.bin", statsHost, statsFileSize);
+
+    aclrtFree(dstDevice);
+    aclrtFree(srcDevice);
+    aclrtFree(statsDevice);
+
+    aclrtFreeHost(dstHost);
+    aclrtFreeHost(srcHost);
+    aclrtFreeHost(statsHost);
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(0);
+    aclFinalize();
+
+    std::vector<T> golden(kTRows_ * kTCols_);
+    std::vector<T> devFinal(kTRows_ * kTCols_);
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/golden.bin", dataFileSize, golden.data(), dataFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/output.bin", dataFileSize, devFinal.data(), dataFileSize));
+    std::vector<float> goldenStats(2 * kTRows_);
+    std::vector<float> devStats(2 * kTRows_);
+    CHECK_RESULT_GTEST(
+        ReadFile(GetGoldenDir() + "/golden_stats.bin", statsFileSize, goldenStats.data(), statsFileSize));
+    CHECK_RESULT_GTEST(ReadFile(GetGoldenDir() + "/output_stats.bin", statsFileSize, devStats.data(), statsFileSize));
+
+    EXPECT_TRUE(ResultCmp<T>(golden, devFinal, 0.001f));
+    EXPECT_TRUE(ResultCmp<float>(goldenStats, devStats, 0.001f));
+}
+
+TEST_F(TROWSOFTMAXTest, case_float_64x64_scale1)
+{
+    test_trowsoftmax<float, 64, 64, 1.0f>();
+}
+TEST_F(TROWSOFTMAXTest, case_float_32x128_scale0125)
+{
+    test_trowsoftmax<float, 32, 128, 0.125f>();
+}
+TEST_F(TROWSOFTMAXTest, case_half_16x256_scale05)
+{
+    test_trowsoftmax<aclFloat16, 16, 256, 0.5f>();
+}
+TEST_F(TROWSOFTMAXTest, case_float_64x64_causal)
+{
+    test_trowsoftmax<float, 64, 64, 0.25f>();
+}
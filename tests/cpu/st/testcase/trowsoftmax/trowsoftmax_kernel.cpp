@@ -0,0 +1,61 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+
+using namespace pto;
+
+template <typename T, int kTRows_, int kTCols_, float kScale>
+AICORE void runTROWSOFTMAX(__gm__ T __out__ *out, __gm__ float __out__ *stats, __gm__ T __in__ *src)
+{
+    using DynShapeDim5 = Shape<1, 1, 1, -1, -1>;
+    using DynStridDim5 = Stride<1, 1, -1, -1, 1>;
+    using GlobalData = GlobalTensor<T, DynShapeDim5, DynStridDim5>;
+    using GlobalStats = GlobalTensor<float, DynShapeDim5, DynStridDim5>;
+
+    using TileData = Tile<TileType::Vec, T, kTRows_, kTCols_, BLayout::RowMajor, -1, -1>;
+    using ReduceTileData = Tile<TileType::Vec, float, kTRows_, 16, BLayout::RowMajor, -1, -1>;
+
+    TileData srcTile(kTRows_, kTCols_);
+    TileData dstTile(kTRows_, kTCols_);
+    ReduceTileData maxTile(kTRows_, 1);
+    ReduceTileData sumTile(kTRows_, 1);
+
+    GlobalData srcGlobal(src, DynShapeDim5(kTRows_, kTCols_), DynStridDim5(kTRows_, kTCols_));
+    GlobalData dstGlobal(out, DynShapeDim5(kTRows_, kTCols_), DynStridDim5(kTRows_, kTCols_));
+    GlobalStats maxGlobal(stats, DynShapeDim5(kTRows_, 1), DynStridDim5(kTRows_, 1));
+    GlobalStats sumGlobal(stats + kTRows_, DynShapeDim5(kTRows_, 1), DynStridDim5(kTRows_, 1));
+
+    TLOAD(srcTile, srcGlobal);
+    set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    cpu::RowSoftmax(dstTile, srcTile, maxTile, sumTile, kScale);
+    set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    TSTORE(dstGlobal, dstTile);
+    TSTORE(maxGlobal, maxTile);
+    TSTORE(sumGlobal, sumTile);
+}
+
+template <typename T, int kTRows_, int kTCols_, float kScale>
+void LaunchTROWSOFTMAX(T *out, float *stats, T *src, void *stream)
+{
+    if constexpr (std::is_same_v<T, aclFloat16>)
+        runTROWSOFTMAX<half, kTRows_, kTCols_, kScale>((half *)(out), stats, (half *)(src));
+    else
+        runTROWSOFTMAX<T, kTRows_, kTCols_, kScale>(out, stats, src);
+}
+
+template void LaunchTROWSOFTMAX<float, 64, 64, 1.0f>(float *out, float *stats, float *src, void *stream);
+template void LaunchTROWSOFTMAX<float, 32, 128, 0.125f>(float *out, float *stats, float *src, void *stream);
+template void LaunchTROWSOFTMAX<aclFloat16, 16, 256, 0.5f>(aclFloat16 *out, float *stats, aclFloat16 *src,
+                                                           void *stream);
+template void LaunchTROWSOFTMAX<float, 64, 64, 0.25f>(float *out, float *stats, float *src, void *stream);
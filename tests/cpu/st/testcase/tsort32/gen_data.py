@@ -29,6 +29,9 @@ def gen_golden_data(param):
     # 生成随机数据
     total_elements = row * col
     input_arr = np.random.rand(row, col) * 10
+    if param.ties:
+        # Coarse scores so many pairs tie and the index tie-break decides their order.
+        input_arr = np.round(input_arr * 2) / 2
     input_arr = input_arr.astype(data_type)
     index_arr = np.random.rand(row, col) * 10
     index_arr = index_arr.astype(np.uint32)
@@ -61,11 +64,12 @@ def gen_golden_data(param):
 
 
 class TestParams:
-    def __init__(self, name, data_type, row, col):
+    def __init__(self, name, data_type, row, col, ties=False):
         self.name = name
         self.data_type = data_type
         self.row = row
         self.col = col
+        self.ties = ties
 
 
 if __name__ == "__main__":
@@ -74,6 +78,7 @@ if __name__ == "__main__":
         TestParams('TSORT32Test.test1', np.float32, 8, 32),
         TestParams('TSORT32Test.test2', np.int32, 7, 32),
         TestParams('TSORT32Test.test3', np.float16, 32, 16),
+        TestParams('TSORT32Test.test4', np.float32, 4, 80, ties=True),
     ]
 
     for case in case_params_list:
@@ -117,4 +117,10 @@ TEST_F(TSORT32Test, test3)
 {
     bool res = TSort32Test<aclFloat16, uint32_t, 32, 16, 32, 16, 32, 16>();
     EXPECT_TRUE(res);
-}
\ No newline at end of file
+}
+
+TEST_F(TSORT32Test, test4)
+{
+    bool res = TSort32Test<float, uint32_t, 4, 80, 4, 80, 4, 80>();
+    EXPECT_TRUE(res);
+}
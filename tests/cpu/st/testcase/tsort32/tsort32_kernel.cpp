@@ -66,3 +66,5 @@ template void launchTSort32<int32_t, uint32_t, 7, 32, 7, 32, 7, 32>(int32_t *out
                                                                     aclrtStream stream);
 template void launchTSort32<aclFloat16, uint32_t, 32, 16, 32, 16, 32, 16>(aclFloat16 *out, aclFloat16 *src,
                                                                           uint32_t *idx, aclrtStream stream);
+template void launchTSort32<float, uint32_t, 4, 80, 4, 80, 4, 80>(float *out, float *src, uint32_t *idx,
+                                                                  aclrtStream stream);
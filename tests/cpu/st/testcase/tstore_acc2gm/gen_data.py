@@ -0,0 +1,90 @@
+#!/usr/bin/python3
+# coding=utf-8
+# --------------------------------------------------------------------------------
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# --------------------------------------------------------------------------------
+
+import os
+import struct
+import numpy as np
+np.random.seed(19)
+
+
+def quant_word(scale, int8_signed):
+    """QUANT_PRE word: M1 = top 19 bits of the fp32 scale, offset 0, bit 46 selects int8 (vs uint8) output."""
+    word = struct.unpack('<I', struct.pack('<f', scale))[0] & 0xFFFFE000
+    if int8_signed:
+        word |= 1 << 46
+    return word
+
+
+def fixpipe(acc, scales, relu, dst_type):
+    val = acc.astype(np.float32) * scales[None, :].astype(np.float32)
+    if relu:
+        val = np.maximum(val, 0)
+    if dst_type == np.int8:
+        return np.clip(np.clip(np.round(val), -256, 255), -128, 127).astype(np.int8)
+    if dst_type == np.float16:
+        return np.clip(val, -65504, 65504).astype(np.float16)
+    return val.astype(dst_type)
+
+
+def gen_golden_data(param):
+    m, k, n = param.m, param.k, param.n
+    x1_gm = np.random.randint(-4, 5, [m, k]).astype(param.src_type)
+    x2_gm = np.random.randint(-4, 5, [k, n]).astype(param.src_type)
+    acc_type = np.int32 if param.src_type == np.int8 else np.float32
+    acc = x1_gm.astype(acc_type) @ x2_gm.astype(acc_type)
+
+    if param.mode == "vector":
+        scales = np.random.choice([0.25, 0.5, 1.0, 2.0, 3.0], n).astype(np.float32)
+    else:
+        scales = np.full(n, param.scale, dtype=np.float32)
+    words = np.array([quant_word(s, param.dst_type == np.int8) for s in scales], dtype=np.uint64)
+
+    golden = fixpipe(acc, scales, param.relu, param.dst_type)
+
+    x1_gm.tofile("./x1_gm.bin")
+    x2_gm.tofile("./x2_gm.bin")
+    words.tofile("./quant_gm.bin")
+    golden.tofile("./golden.bin")
+
+
+class TStoreAcc2gmParams:
+    def __init__(self, name, src_type, dst_type, m, k, n, mode, scale=1.0, relu=False):
+        self.name = name
+        self.src_type = src_type
+        self.dst_type = dst_type
+        self.m = m
+        self.k = k
+        self.n = n
+        self.mode = mode
+        self.scale = scale
+        self.relu = relu
+
+
+if __name__ == "__main__":
+    case_params_list = [
+        TStoreAcc2gmParams("TSTOREACC2GMTest.case_scalar_s32_to_s8", np.int8, np.int8, 30, 50, 60, "scalar", 0.5),
+        TStoreAcc2gmParams("TSTOREACC2GMTest.case_scalar_relu_s32_to_s8", np.int8, np.int8, 30, 50, 60, "scalar",
+                           3.0, relu=True),
+        TStoreAcc2gmParams("TSTOREACC2GMTest.case_vector_s32_to_f16", np.int8, np.float16, 32, 64, 64, "vector"),
+        TStoreAcc2gmParams("TSTOREACC2GMTest.case_cast_f32_to_f16", np.float16, np.float16, 40, 50, 60, "cast"),
+        TStoreAcc2gmParams("TSTOREACC2GMTest.case_relu_f32", np.float32, np.float32, 31, 16, 33, "cast", relu=True),
+        TStoreAcc2gmParams("TSTOREACC2GMTest.case_tmov_vec_scalar_relu_s32_to_s8", np.int8, np.int8, 32, 64, 64,
+                           "scalar", 0.25, relu=True),
+    ]
+
+    for param in case_params_list:
+        if not os.path.exists(param.name):
+            os.makedirs(param.name)
+        original_dir = os.getcwd()
+        os.chdir(param.name)
+        gen_golden_data(param)
+        os.chdir(original_dir)
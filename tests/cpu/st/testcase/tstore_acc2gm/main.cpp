@@ -0,0 +1,129 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "test_common.h"
+#include <pto/pto-inst.hpp>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace PtoTestCommon;
+
+template <int32_t tilingKey>
+void LaunchTStoreAcc2gm(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
+
+class TSTOREACC2GMTest : public testing::Test {
+protected:
+    void SetUp() override
+    {}
+    void TearDown() override
+    {}
+};
+
+std::string GetGoldenDir()
+{
+    const testing::TestInfo *testInfo = testing::UnitTest::GetInstance()->current_test_info();
+    const std::string caseName = testInfo->name();
+    std::string suiteName = testInfo->test_suite_name();
+    std::string fullPath = "../" + suiteName + "." + caseName;
+    return fullPath;
+}
+
+template <typename OutT, typename InT, int32_t key>
+void tstore_acc2gm_test(uint32_t M, uint32_t K, uint32_t N)
+{
+    size_t aFileSize = M * K * sizeof(InT);
+    size_t bFileSize = K * N * sizeof(InT);
+    size_t quantFileSize = N * sizeof(uint64_t);
+    size_t cFileSize = M * N * sizeof(OutT);
+
+    aclInit(nullptr);
+    aclrtSetDevice(0);
+    aclrtStream stream;
+    aclrtCreateStream(&stream);
+
+    uint8_t *dstHost, *src0Host, *src1Host, *quantHost;
+    uint8_t *dstDevice, *src0Device, *src1Device, *quantDevice;
+
+    aclrtMallocHost((void **)(&dstHost), cFileSize);
+    aclrtMallocHost((void **)(&src0Host), aFileSize);
+    aclrtMallocHost((void **)(&src1Host), bFileSize);
+    aclrtMallocHost((void **)(&quantHost), quantFileSize);
+
+    aclrtMalloc((void **)&dstDevice, cFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src0Device, aFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&src1Device, bFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    aclrtMalloc((void **)&quantDevice, quantFileSize, ACL_MEM_MALLOC_HUGE_FIRST);
+
+    ReadFile(GetGoldenDir() + "/x1_gm.bin", aFileSize, src0Host, aFileSize);
+    ReadFile(GetGoldenDir() + "/x2_gm.bin", bFileSize, src1Host, bFileSize);
+    ReadFile(GetGoldenDir() + "/quant_gm.bin", quantFileSize, quantHost, quantFileSize);
+
+    aclrtMemcpy(src0Device, aFileSize, src0Host, aFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(src1Device, bFileSize, src1Host, bFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    aclrtMemcpy(quantDevice, quantFileSize, quantHost, quantFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
+    LaunchTStoreAcc2gm<key>(dstDevice, src0Device, src1Device, quantDevice, stream);
+
+    aclrtSynchronizeStream(stream);
+    aclrtMemcpy(dstHost, cFileSize, dstDevice, cFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
+
+    WriteFile(GetGoldenDir() + "/output_z.bin", dstHost, cFileSize);
+
+    aclrtFree(dstDevice);
+    aclrtFree(src0Device);
+    aclrtFree(src1Device);
+    aclrtFree(quantDevice);
+
+    aclrtFreeHost(dstHost);
+    aclrtFreeHost(src0Host);
+    aclrtFreeHost(src1Host);
+    aclrtFreeHost(quantHost);
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(0);
+    aclFinalize();
+
+    std::vector<OutT> golden(M * N);
+    std::vector<OutT> devFinal(M * N);
+    ReadFile(GetGoldenDir() + "/golden.bin", cFileSize, golden.data(), cFileSize);
+    ReadFile(GetGoldenDir() + "/output_z.bin", cFileSize, devFinal.data(), cFileSize);
+
+    bool ret = ResultCmp(golden, devFinal, 0.001f);
+
+    EXPECT_TRUE(ret);
+}
+
+TEST_F(TSTOREACC2GMTest, case_scalar_s32_to_s8)
+{
+    tstore_acc2gm_test<int8_t, int8_t, 1>(30, 50, 60);
+}
+
+TEST_F(TSTOREACC2GMTest, case_scalar_relu_s32_to_s8)
+{
+    tstore_acc2gm_test<int8_t, int8_t, 2>(30, 50, 60);
+}
+
+TEST_F(TSTOREACC2GMTest, case_vector_s32_to_f16)
+{
+    tstore_acc2gm_test<aclFloat16, int8_t, 3>(32, 64, 64);
+}
+
+TEST_F(TSTOREACC2GMTest, case_cast_f32_to_f16)
+{
+    tstore_acc2gm_test<aclFloat16, aclFloat16, 4>(40, 50, 60);
+}
+
+TEST_F(TSTOREACC2GMTest, case_relu_f32)
+{
+    tstore_acc2gm_test<float, float, 5>(31, 16, 33);
+}
+
+TEST_F(TSTOREACC2GMTest, case_tmov_vec_scalar_relu_s32_to_s8)
+{
+    tstore_acc2gm_test<int8_t, int8_t, 6>(32, 64, 64);
+}
@@ -0,0 +1,143 @@
+/**
+Copyright (c) 2025 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+
+using namespace pto;
+
+template <typename T>
+AICORE constexpr inline T CeilAlign(T num_1, T num_2)
+{
+    if (num_2 == 0) {
+        return 0;
+    }
+    return (num_1 + num_2 - 1) / num_2 * num_2;
+}
+
+enum class StoreMode
+{
+    Cast,        // plain TSTORE, the fixpipe only converts the type
+    ScalarQuant, // TSTORE with a per-tensor QUANT_PRE word
+    VectorQuant, // TSTORE_FP with one QUANT_PRE word per column
+    MovToVec,    // TMOV Acc -> Vec with a per-tensor QUANT_PRE word, then TSTORE of the Vec tile
+};
+
+template <typename OutT, typename InT, typename AccT, int validM, int validK, int validN, StoreMode mode,
+          ReluPreMode relu>
+AICORE void RunTStoreAcc2gm(__gm__ OutT *out, __gm__ InT *src0, __gm__ InT *src1, __gm__ uint64_t *quant)
+{
+    constexpr int blockAlign = (sizeof(InT) == 1) ? 32 : 16;
+    constexpr int M = CeilAlign<int>(validM, 16);
+    constexpr int N = CeilAlign<int>(validN, blockAlign);
+    constexpr int K = CeilAlign<int>(validK, blockAlign);
+
+    using GlobalDataSrc0 = GlobalTensor<InT, Shape<1, 1, 1, validM, validK>,
+                                        Stride<validM * validK, validM * validK, validM * validK, validK, 1>>;
+    using GlobalDataSrc1 = GlobalTensor<InT, Shape<1, 1, 1, validK, validN>,
+                                        Stride<validK * validN, validK * validN, validK * validN, validN, 1>>;
+    using GlobalDataQuant =
+        GlobalTensor<uint64_t, Shape<1, 1, 1, 1, validN>, Stride<validN, validN, validN, validN, 1>>;
+    using GlobalDataOut = GlobalTensor<OutT, Shape<1, 1, 1, validM, validN>,
+                                       Stride<validM * validN, validM * validN, validM * validN, validN, 1>>;
+
+    using TileMatAData = Tile<TileType::Mat, InT, M, K, BLayout::ColMajor, validM, validK, SLayout::RowMajor, 512>;
+    using TileMatBData = Tile<TileType::Mat, InT, K, N, BLayout::ColMajor, validK, validN, SLayout::RowMajor, 512>;
+    using LeftTile = TileLeft<InT, M, K, validM, validK>;
+    using RightTile = TileRight<InT, K, N, validK, validN>;
+    using AccTile = TileAcc<AccT, M, N, validM, validN>;
+    using ScalingTile = Tile<TileType::Scaling, uint64_t, 1, N, BLayout::RowMajor, 1, validN>;
+    using VecTile = Tile<TileType::Vec, OutT, M, N, BLayout::RowMajor, validM, validN>;
+
+    GlobalDataSrc0 src0Global(src0);
+    GlobalDataSrc1 src1Global(src1);
+    GlobalDataOut dstGlobal(out);
+
+    TileMatAData aMatTile;
+    TileMatBData bMatTile;
+    LeftTile aTile;
+    RightTile bTile;
+    AccTile cTile;
+    TASSIGN(aMatTile, 0x0);
+    TASSIGN(bMatTile, 0x10000);
+    TASSIGN(aTile, 0x0);
+    TASSIGN(bTile, 0x0);
+    TASSIGN(cTile, 0x0);
+
+    TLOAD(aMatTile, src0Global);
+    TLOAD(bMatTile, src1Global);
+    set_flag(PIPE_MTE2, PIPE_MTE1, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_MTE1, EVENT_ID0);
+    TMOV(aTile, aMatTile);
+    TMOV(bTile, bMatTile);
+    set_flag(PIPE_MTE1, PIPE_M, EVENT_ID0);
+    wait_flag(PIPE_MTE1, PIPE_M, EVENT_ID0);
+    TMATMUL(cTile, aTile, bTile);
+    set_flag(PIPE_M, PIPE_FIX, EVENT_ID0);
+    wait_flag(PIPE_M, PIPE_FIX, EVENT_ID0);
+
+    if constexpr (mode == StoreMode::Cast) {
+        TSTORE<AccTile, GlobalDataOut, AtomicType::AtomicNone, relu>(dstGlobal, cTile);
+    } else if constexpr (mode == StoreMode::ScalarQuant) {
+        TSTORE<AccTile, GlobalDataOut, AtomicType::AtomicNone, relu>(dstGlobal, cTile, quant[0]);
+    } else if constexpr (mode == StoreMode::VectorQuant) {
+        GlobalDataQuant quantGlobal(quant);
+        ScalingTile scalingTile;
+        TASSIGN(scalingTile, 0x0);
+        TLOAD(scalingTile, quantGlobal);
+        TSTORE_FP<AccTile, GlobalDataOut, ScalingTile, AtomicType::AtomicNone, relu>(dstGlobal, cTile, scalingTile);
+    } else {
+        VecTile vecTile;
+        TASSIGN(vecTile, 0x0);
+        TMOV<VecTile, AccTile, AccToVecMode::SingleModeVec0, relu>(vecTile, cTile, quant[0]);
+        set_flag(PIPE_FIX, PIPE_MTE3, EVENT_ID0);
+        wait_flag(PIPE_FIX, PIPE_MTE3, EVENT_ID0);
+        TSTORE(dstGlobal, vecTile);
+    }
+}
+
+template <int32_t tilingKey>
+void LaunchTStoreAcc2gm(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream)
+{
+    (void)stream;
+    auto *quantWords = reinterpret_cast<uint64_t *>(quant);
+    if constexpr (tilingKey == 1) {
+        RunTStoreAcc2gm<int8_t, int8_t, int32_t, 30, 50, 60, StoreMode::ScalarQuant, ReluPreMode::NoRelu>(
+            reinterpret_cast<int8_t *>(out), reinterpret_cast<int8_t *>(src0), reinterpret_cast<int8_t *>(src1),
+            quantWords);
+    } else if constexpr (tilingKey == 2) {
+        RunTStoreAcc2gm<int8_t, int8_t, int32_t, 30, 50, 60, StoreMode::ScalarQuant, ReluPreMode::NormalRelu>(
+            reinterpret_cast<int8_t *>(out), reinterpret_cast<int8_t *>(src0), reinterpret_cast<int8_t *>(src1),
+            quantWords);
+    } else if constexpr (tilingKey == 3) {
+        RunTStoreAcc2gm<half, int8_t, int32_t, 32, 64, 64, StoreMode::VectorQuant, ReluPreMode::NoRelu>(
+            reinterpret_cast<half *>(out), reinterpret_cast<int8_t *>(src0), reinterpret_cast<int8_t *>(src1),
+            quantWords);
+    } else if constexpr (tilingKey == 4) {
+        RunTStoreAcc2gm<half, half, float, 40, 50, 60, StoreMode::Cast, ReluPreMode::NoRelu>(
+            reinterpret_cast<half *>(out), reinterpret_cast<half *>(src0), reinterpret_cast<half *>(src1),
+            quantWords);
+    } else if constexpr (tilingKey == 5) {
+        RunTStoreAcc2gm<float, float, float, 31, 16, 33, StoreMode::Cast, ReluPreMode::NormalRelu>(
+            reinterpret_cast<float *>(out), reinterpret_cast<float *>(src0), reinterpret_cast<float *>(src1),
+            quantWords);
+    } else if constexpr (tilingKey == 6) {
+        RunTStoreAcc2gm<int8_t, int8_t, int32_t, 32, 64, 64, StoreMode::MovToVec, ReluPreMode::NormalRelu>(
+            reinterpret_cast<int8_t *>(out), reinterpret_cast<int8_t *>(src0), reinterpret_cast<int8_t *>(src1),
+            quantWords);
+    }
+}
+
+template void LaunchTStoreAcc2gm<1>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
+template void LaunchTStoreAcc2gm<2>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
+template void LaunchTStoreAcc2gm<3>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
+template void LaunchTStoreAcc2gm<4>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
+template void LaunchTStoreAcc2gm<5>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
+template void LaunchTStoreAcc2gm<6>(uint8_t *out, uint8_t *src0, uint8_t *src1, uint8_t *quant, void *stream);
@@ -0,0 +1,42 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include <gtest/gtest.h>
+#include "ttimeline_kernel.h"
+
+TEST(TTimeline, SerialChain)
+{
+    ASSERT_TRUE(RunTimelineSerialChain());
+}
+
+TEST(TTimeline, DoubleBuffering)
+{
+    ASSERT_TRUE(RunTimelineDoubleBuffering());
+}
+
+TEST(TTimeline, CostModels)
+{
+    ASSERT_TRUE(RunTimelineCostModels());
+}
+
+TEST(TTimeline, AsyncPipes)
+{
+    ASSERT_TRUE(RunTimelineAsyncPipes());
+}
+
+TEST(TTimeline, PipelineLogs)
+{
+    ASSERT_TRUE(RunTimelinePipelineLogs("ttimeline_logs"));
+}
+
+TEST(TTimeline, Disabled)
+{
+    ASSERT_TRUE(RunTimelineDisabled());
+}
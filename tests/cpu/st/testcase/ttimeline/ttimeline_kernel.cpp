@@ -0,0 +1,361 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#include "ttimeline_kernel.h"
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using namespace pto;
+
+namespace {
+constexpr int kRows = 16;
+constexpr int kCols = 64;
+constexpr int kCount = kRows * kCols;
+constexpr uint64_t kTileBytes = kCount * sizeof(float);
+
+using GlobalData = GlobalTensor<float, Shape<1, 1, 1, kRows, kCols>, Stride<1, 1, 1, kCols, 1>>;
+using TileData = Tile<TileType::Vec, float, kRows, kCols>;
+
+// out[slice] = a[slice] + b[slice]
+void AddSlice(float *out, float *a, float *b, int slice)
+{
+    TileData aTile;
+    TileData bTile;
+    TileData outTile;
+    GlobalData aGlobal(a + slice * kCount);
+    GlobalData bGlobal(b + slice * kCount);
+    GlobalData outGlobal(out + slice * kCount);
+    TLOAD(aTile, aGlobal);
+    TLOAD(bTile, bGlobal);
+    set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    TADD(outTile, aTile, bTile);
+    set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    TSTORE(outGlobal, outTile);
+}
+
+// out[s] = in[s] + 1 for every slice. Pipelined loops keep two slices in flight on ping-pong buffers; serialized
+// loops finish each slice before loading the next.
+void AddOneSlices(float *out, float *in, int slices, bool pipelined)
+{
+    TileData src[2];
+    TileData dst[2];
+    for (int s = 0; s < slices; ++s) {
+        const int buf = pipelined ? s % 2 : 0;
+        GlobalData inGlobal(in + s * kCount);
+        GlobalData outGlobal(out + s * kCount);
+        if (pipelined && s >= 2) {
+            wait_flag(PIPE_V, PIPE_MTE2, buf);
+            wait_flag(PIPE_MTE3, PIPE_V, buf);
+        }
+        TLOAD(src[buf], inGlobal);
+        set_flag(PIPE_MTE2, PIPE_V, buf);
+        wait_flag(PIPE_MTE2, PIPE_V, buf);
+        TADDS(dst[buf], src[buf], 1.0f);
+        set_flag(PIPE_V, PIPE_MTE3, buf);
+        if (pipelined) {
+            set_flag(PIPE_V, PIPE_MTE2, buf);
+        }
+        wait_flag(PIPE_V, PIPE_MTE3, buf);
+        TSTORE(outGlobal, dst[buf]);
+        if (pipelined) {
+            set_flag(PIPE_MTE3, PIPE_V, buf);
+        } else {
+            pipe_barrier(PIPE_ALL);
+        }
+    }
+    if (pipelined) {
+        for (int buf = 0; buf < 2 && buf < slices; ++buf) {
+            wait_flag(PIPE_V, PIPE_MTE2, buf);
+            wait_flag(PIPE_MTE3, PIPE_V, buf);
+        }
+    }
+}
+
+struct Buffers {
+    explicit Buffers(int slices) : a(slices * kCount, 1.0f), b(slices * kCount, 2.0f), out(slices * kCount, 0.0f)
+    {}
+
+    bool Summed() const
+    {
+        for (float v : out) {
+            if (v != 3.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<float> a;
+    std::vector<float> b;
+    std::vector<float> out;
+};
+
+// Instruction events of core 0, in issue order.
+std::vector<cpu::TimelineEvent> Instrs()
+{
+    std::vector<cpu::TimelineEvent> instrs;
+    for (cpu::TimelineEvent &e : cpu::timeline_events()) {
+        if (!e.sync && e.core == 0) {
+            instrs.push_back(std::move(e));
+        }
+    }
+    std::sort(instrs.begin(), instrs.end(),
+              [](const cpu::TimelineEvent &a, const cpu::TimelineEvent &b) { return a.id < b.id; });
+    return instrs;
+}
+
+uint64_t SpanCycles()
+{
+    uint64_t span = 0;
+    for (const cpu::TimelineEvent &e : cpu::timeline_events()) {
+        span = std::max(span, e.endCycle);
+    }
+    return span;
+}
+
+const cpu::PipeUtilization *UtilizationOf(const std::vector<cpu::PipeUtilization> &all, pipe_t pipe)
+{
+    for (const cpu::PipeUtilization &u : all) {
+        if (u.pipe == pipe && u.core == 0) {
+            return &u;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t TransferCycles(uint32_t latency, double bytesPerCycle)
+{
+    return latency + static_cast<uint64_t>(std::ceil(kTileBytes / bytesPerCycle));
+}
+
+// Enables the timeline for one test, on the A5 model, and leaves it disabled and empty afterwards.
+struct TimelineSession {
+    TimelineSession() : saved(cpu::cost_model())
+    {
+        cpu::reset_timeline();
+        cpu::set_cost_model(cpu::CostModelA5());
+        cpu::set_timeline(true);
+    }
+
+    ~TimelineSession()
+    {
+        cpu::set_timeline(false);
+        cpu::set_cost_model(saved);
+        cpu::reset_timeline();
+    }
+
+    cpu::PipeCostModel saved;
+};
+} // namespace
+
+bool RunTimelineSerialChain()
+{
+    TimelineSession session;
+    Buffers buf(1);
+    cpu::LaunchKernel(1, [&]() { AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), 0); });
+
+    const cpu::PipeCostModel &m = cpu::cost_model();
+    const std::vector<cpu::TimelineEvent> instrs = Instrs();
+    if (!buf.Summed() || instrs.size() != 4) {
+        return false;
+    }
+    const cpu::TimelineEvent &loadA = instrs[0];
+    const cpu::TimelineEvent &loadB = instrs[1];
+    const cpu::TimelineEvent &add = instrs[2];
+    const cpu::TimelineEvent &store = instrs[3];
+    const uint64_t load = TransferCycles(m.mte2Latency, m.mte2BytesPerCycle);
+    // MTE2 runs the loads back to back; the add waits for both through the flag, the store for the add.
+    return loadA.pipe == PIPE_MTE2 && loadA.mnemonic == "MOV_OUT_TO_UB" && loadA.startCycle == m.issueCycles &&
+           loadA.endCycle == loadA.startCycle + load && loadB.startCycle == loadA.endCycle &&
+           loadB.endCycle == loadB.startCycle + load && add.pipe == PIPE_V && add.mnemonic == "VADD" &&
+           add.startCycle == loadB.endCycle &&
+           add.endCycle == add.startCycle + TransferCycles(m.vectorLatency, m.vectorBytesPerCycle) &&
+           store.pipe == PIPE_MTE3 && store.mnemonic == "MOV_UB_TO_OUT" && store.startCycle == add.endCycle &&
+           store.endCycle == store.startCycle + TransferCycles(m.mte3Latency, m.mte3BytesPerCycle) &&
+           loadA.bytes == kTileBytes && store.dst == reinterpret_cast<uintptr_t>(buf.out.data());
+}
+
+bool RunTimelineDoubleBuffering()
+{
+    constexpr int kSlices = 8;
+    std::vector<float> in(kSlices * kCount, 1.0f);
+    uint64_t spans[2] = {};
+    double mte2Utilization[2] = {};
+    for (int pipelined = 0; pipelined < 2; ++pipelined) {
+        TimelineSession session;
+        std::vector<float> out(kSlices * kCount, 0.0f);
+        cpu::LaunchKernel(1, [&]() { AddOneSlices(out.data(), in.data(), kSlices, pipelined != 0); });
+        for (float v : out) {
+            if (v != 2.0f) {
+                return false;
+            }
+        }
+        const std::vector<cpu::PipeUtilization> utilization = cpu::timeline_utilization();
+        const cpu::PipeUtilization *mte2 = UtilizationOf(utilization, PIPE_MTE2);
+        if (mte2 == nullptr || mte2->instrs != kSlices || mte2->spanCycles != SpanCycles()) {
+            return false;
+        }
+        spans[pipelined] = SpanCycles();
+        mte2Utilization[pipelined] = static_cast<double>(mte2->busyCycles) / static_cast<double>(mte2->spanCycles);
+    }
+    // Serialized, every slice pays load + add + store; pipelined, the loads hide the rest.
+    const cpu::PipeCostModel &m = cpu::cost_model();
+    const uint64_t load = TransferCycles(m.mte2Latency, m.mte2BytesPerCycle);
+    return spans[1] * 4 < spans[0] * 3 && spans[1] >= kSlices * load && mte2Utilization[1] > 0.8 &&
+           mte2Utilization[0] < 0.65;
+}
+
+bool RunTimelineCostModels()
+{
+    using LeftTile = TileLeft<half, 16, 32, 16, 32>;
+    using RightTile = TileRight<half, 32, 16, 32, 16>;
+    using AccTile = TileAcc<float, 16, 16, 16, 16>;
+    const cpu::PipeCostModel models[] = {cpu::CostModelA2A3(), cpu::CostModelA5()};
+    for (const cpu::PipeCostModel &m : models) {
+        TimelineSession session;
+        cpu::set_cost_model(m);
+        std::vector<float> in(kCount, 1.0f);
+        cpu::LaunchKernel(1, [&]() {
+            TileData tile;
+            GlobalData inGlobal(in.data());
+            TLOAD(tile, inGlobal);
+            LeftTile left;
+            RightTile right;
+            AccTile acc;
+            TMATMUL(acc, left, right);
+        });
+        const std::vector<cpu::TimelineEvent> instrs = Instrs();
+        if (instrs.size() != 2 || std::strcmp(cpu::cost_model().name, m.name) != 0) {
+            return false;
+        }
+        const uint64_t macs = 16 * 32 * 16;
+        const uint64_t mmad = m.cubeLatency + static_cast<uint64_t>(std::ceil(macs / m.cubeMacsPerCycle[1]));
+        if (instrs[0].endCycle - instrs[0].startCycle != TransferCycles(m.mte2Latency, m.mte2BytesPerCycle) ||
+            instrs[1].pipe != PIPE_M || instrs[1].mnemonic != "MMAD" ||
+            instrs[1].endCycle - instrs[1].startCycle != mmad) {
+            return false;
+        }
+    }
+    return cpu::CostModelA2A3().mte2BytesPerCycle != cpu::CostModelA5().mte2BytesPerCycle;
+}
+
+bool RunTimelineAsyncPipes()
+{
+    constexpr int kSlices = 4;
+    std::vector<float> in(kSlices * kCount, 1.0f);
+    std::vector<std::vector<uint64_t>> cycles(2);
+    for (int async = 0; async < 2; ++async) {
+        TimelineSession session;
+        std::vector<float> out(kSlices * kCount, 0.0f);
+        cpu::set_async_pipes(async != 0);
+        cpu::LaunchKernel(1, [&]() { AddOneSlices(out.data(), in.data(), kSlices, true); });
+        cpu::set_async_pipes(false);
+        for (const cpu::TimelineEvent &e : Instrs()) {
+            cycles[async].push_back(e.startCycle);
+            cycles[async].push_back(e.endCycle);
+        }
+    }
+    return !cycles[0].empty() && cycles[0] == cycles[1];
+}
+
+bool RunTimelinePipelineLogs(const std::string &dir)
+{
+    constexpr int kBlocks = 2;
+    TimelineSession session;
+    Buffers buf(kBlocks);
+    cpu::timeline_register_buffer("a_device", buf.a.data(), buf.a.size() * sizeof(float));
+    cpu::timeline_register_buffer("out_device", buf.out.data(), buf.out.size() * sizeof(float));
+    cpu::LaunchKernel(kBlocks, [&]() {
+        AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), static_cast<int>(get_block_idx()));
+    });
+    if (!buf.Summed() || !cpu::write_pipeline_logs(dir)) {
+        return false;
+    }
+
+    // The expressions pipeline_log_analysis.py matches every line with.
+    const std::regex ts(R"(\[(\d+)\])");
+    const std::regex pipeline(R"(\)\s*([A-Z0-9_]+))");
+    const std::regex opcode(R"(\)\s*[A-Z0-9_]+\s*:\s*\([^)]*\)\s*([A-Z][A-Z0-9_]+))");
+    const std::regex id(R"(\b(?:id|instr_id)\s*[:=]\s*(\d+)\b)");
+    const std::regex src(R"(Src:0x([0-9a-fA-F]+))");
+    const std::regex dst(R"(Dst:0x([0-9a-fA-F]+))");
+    const auto a = reinterpret_cast<uintptr_t>(buf.a.data());
+    const auto out = reinterpret_cast<uintptr_t>(buf.out.data());
+    for (int block = 0; block < kBlocks; ++block) {
+        const std::string core = dir + "/core" + std::to_string(block) + ".veccore0";
+        std::map<uint64_t, uint64_t> starts;
+        std::map<uint64_t, uint64_t> ends;
+        std::set<std::string> opcodes;
+        for (int end = 0; end < 2; ++end) {
+            std::ifstream log(core + (end ? ".instr_log.dump" : ".instr_popped_log.dump"));
+            uint64_t last = 0;
+            for (std::string line; std::getline(log, line);) {
+                std::smatch t, p, o, i;
+                if (!std::regex_search(line, t, ts) || !std::regex_search(line, p, pipeline) ||
+                    !std::regex_search(line, o, opcode) || !std::regex_search(line, i, id) ||
+                    line.find("BAR") != std::string::npos) {
+                    return false;
+                }
+                const uint64_t cycle = std::stoull(t[1]);
+                if (cycle < last) {
+                    return false;
+                }
+                last = cycle;
+                (end ? ends : starts)[std::stoull(i[1])] = cycle;
+                opcodes.insert(p[1].str() + " " + o[1].str());
+                std::smatch s, d;
+                if (o[1] == "MOV_OUT_TO_UB" && std::regex_search(line, s, src) &&
+                    std::stoull(s[1], nullptr, 16) < a) {
+                    return false;
+                }
+                if (o[1] == "MOV_UB_TO_OUT" &&
+                    (!std::regex_search(line, d, dst) || std::stoull(d[1], nullptr, 16) != out + block * kTileBytes)) {
+                    return false;
+                }
+            }
+        }
+        if (starts.size() != 8 || starts.size() != ends.size() || opcodes.count("MTE2 MOV_OUT_TO_UB") == 0 ||
+            opcodes.count("VEC VADD") == 0 || opcodes.count("MTE3 MOV_UB_TO_OUT") == 0 ||
+            opcodes.count("MTE2 SET_FLAG") == 0 || opcodes.count("VEC WAIT_FLAG") == 0) {
+            return false;
+        }
+        for (const auto &[instr, start] : starts) {
+            if (ends.count(instr) == 0 || ends[instr] < start) {
+                return false;
+            }
+        }
+    }
+    std::ifstream addrsFile(dir + "/device_addrs.toml");
+    const std::string addrs((std::istreambuf_iterator<char>(addrsFile)), std::istreambuf_iterator<char>());
+    std::ostringstream aEntry;
+    aEntry << "[\"a_device\"]\naddr = \"0x" << std::hex << a << std::dec << "\"\nsize_bytes = "
+           << buf.a.size() * sizeof(float) << '\n';
+    return addrs.find(aEntry.str()) != std::string::npos && addrs.find("[\"out_device\"]") != std::string::npos;
+}
+
+bool RunTimelineDisabled()
+{
+    cpu::reset_timeline();
+    Buffers buf(1);
+    cpu::LaunchKernel(1, [&]() { AddSlice(buf.out.data(), buf.a.data(), buf.b.data(), 0); });
+    return buf.Summed() && cpu::timeline_events().empty();
+}
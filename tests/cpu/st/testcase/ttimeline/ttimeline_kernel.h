@@ -0,0 +1,34 @@
+/**
+Copyright (c) 2026 Huawei Technologies Co., Ltd.
+This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+CANN Open Software License Agreement Version 2.0 (the "License").
+Please refer to the License for details. You may not use this file except in compliance with the License.
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+See LICENSE in the root of the software repository for the full text of the License.
+*/
+
+#pragma once
+
+#include <string>
+
+// Pipe timeline tests. Each runs a small kernel with cpu::set_timeline(true) and returns false if the predicted
+// schedule does not follow the cost model and the kernel's flags.
+
+// Test 1: TLOAD x2, TADD, TSTORE chained by flags; checks every start and end cycle
+bool RunTimelineSerialChain();
+
+// Test 2: a double-buffered loop overlaps MTE2, V and MTE3; the same loop with PIPE_ALL barriers does not
+bool RunTimelineDoubleBuffering();
+
+// Test 3: transfer and TMATMUL cycles follow the selected architecture
+bool RunTimelineCostModels();
+
+// Test 4: the predicted schedule does not depend on whether the pipes run asynchronously on the host
+bool RunTimelineAsyncPipes();
+
+// Test 5: a two-core launch written as pipeline logs to dir, in the format pipeline_log_analysis.py parses
+bool RunTimelinePipelineLogs(const std::string &dir);
+
+// Test 6: nothing is modelled while the timeline is disabled
+bool RunTimelineDisabled();
@@ -36,10 +36,18 @@ class TTransParams:
 if __name__ == "__main__":
     case_name_list = [
         "TTRANSTest.case1",
+        "TTRANSTest.case2",
+        "TTRANSTest.case3",
+        "TTRANSTest.case4",
+        "TTRANSTest.case5",
     ]
 
     case_params_list = [
         TTransParams(np.float32, 128 , 128),
+        TTransParams(np.float16, 64, 128),
+        TTransParams(np.float32, 40, 96),
+        TTransParams(np.float32, 40, 96),
+        TTransParams(np.float16, 64, 128),
     ]
 
     for i, case_name in enumerate(case_name_list):
@@ -35,13 +35,11 @@ std::string GetGoldenDir()
     return fullPath;
 }
 
-TEST_F(TTRANSTest, case1)
+template <typename T, int32_t tilingKey>
+void RunTTrans(uint32_t M, uint32_t N)
 {
-    uint32_t M = 128;
-    uint32_t N = 128;
-
-    size_t srcFileSize = M * N * sizeof(float);
-    size_t dstFileSize = M * N * sizeof(float);
+    size_t srcFileSize = M * N * sizeof(T);
+    size_t dstFileSize = M * N * sizeof(T);
 
     aclInit(nullptr);
     aclrtSetDevice(0);
@@ -60,7 +58,7 @@ TEST_F(TTRANSTest, case1)
     ReadFile(GetGoldenDir() + "/x1_gm.bin", srcFileSize, srcHost, srcFileSize);
 
     aclrtMemcpy(srcDevice, srcFileSize, srcHost, srcFileSize, ACL_MEMCPY_HOST_TO_DEVICE);
-    launchTTRANS<1>(dstDevice, srcDevice, stream);
+    launchTTRANS<tilingKey>(dstDevice, srcDevice, stream);
 
     aclrtSynchronizeStream(stream);
     aclrtMemcpy(dstHost, dstFileSize, dstDevice, dstFileSize, ACL_MEMCPY_DEVICE_TO_HOST);
@@ -77,12 +75,37 @@ TEST_F(TTRANSTest, case1)
     aclrtResetDevice(0);
     aclFinalize();
 
-    std::vector<float> golden(dstFileSize);
-    std::vector<float> devFinal(dstFileSize);
+    std::vector<T> golden(dstFileSize);
+    std::vector<T> devFinal(dstFileSize);
     ReadFile(GetGoldenDir() + "/golden.bin", dstFileSize, golden.data(), dstFileSize);
     ReadFile(GetGoldenDir() + "/output_z.bin", dstFileSize, devFinal.data(), dstFileSize);
 
     bool ret = ResultCmp(golden, devFinal, 0.001f);
 
     EXPECT_TRUE(ret);
-}
\ No newline at end of file
+}
+
+TEST_F(TTRANSTest, case1)
+{
+    RunTTrans<float, 1>(128, 128);
+}
+
+TEST_F(TTRANSTest, case2)
+{
+    RunTTrans<aclFloat16, 2>(64, 128);
+}
+
+TEST_F(TTRANSTest, case3)
+{
+    RunTTrans<float, 3>(40, 96);
+}
+
+TEST_F(TTRANSTest, case4)
+{
+    RunTTrans<float, 4>(40, 96);
+}
+
+TEST_F(TTRANSTest, case5)
+{
+    RunTTrans<aclFloat16, 5>(64, 128);
+}
@@ -15,7 +15,8 @@ See LICENSE in the root of the software repository for the full text of the Lice
 using namespace std;
 using namespace pto;
 
-template <typename T, int kGRows_, int kGCols_, int kTRows_, int kTCols_>
+template <typename T, int kGRows_, int kGCols_, int kTRows_, int kTCols_, BLayout srcBLayout = BLayout::RowMajor,
+          SLayout srcSLayout = SLayout::NoneBox>
 inline AICORE void runTTRANS(__gm__ T __out__ *out, __gm__ T __in__ *src)
 {
     using DynShapeDim4 = pto::Shape<-1, -1, -1, -1, -1>;
@@ -25,7 +26,8 @@ inline AICORE void runTTRANS(__gm__ T __out__ *out, __gm__ T __in__ *src)
     constexpr uint16_t aligned_Rows = ((kTRows_ * sizeof(T) + 31) / 32) * (32 / sizeof(T));
     constexpr uint16_t aligned_Cols = ((kTCols_ * sizeof(T) + 31) / 32) * (32 / sizeof(T));
 
-    using TileDataSrc = Tile<TileType::Vec, T, kTRows_, aligned_Cols, BLayout::RowMajor>;
+    using TileDataSrc =
+        Tile<TileType::Vec, T, kTRows_, aligned_Cols, srcBLayout, kTRows_, aligned_Cols, srcSLayout>;
     using TileDataDst = Tile<TileType::Vec, T, kTCols_, aligned_Rows, BLayout::RowMajor>;
     using TileDataTmp = Tile<TileType::Vec, T, kTCols_, aligned_Rows, BLayout::RowMajor>;
 
@@ -67,12 +69,56 @@ extern "C" __global__ AICORE void launchTTRANS_1(__gm__ uint8_t *out, __gm__ uin
     runTTRANS<float, M, N, K, L>(reinterpret_cast<__gm__ float *>(out), reinterpret_cast<__gm__ float *>(src));
 }
 
+extern "C" __global__ AICORE void launchTTRANS_2(__gm__ uint8_t *out, __gm__ uint8_t *src)
+{
+    constexpr uint32_t M = 64;
+    constexpr uint32_t N = 128;
+    runTTRANS<half, M, N, M, N>(reinterpret_cast<__gm__ half *>(out), reinterpret_cast<__gm__ half *>(src));
+}
+
+extern "C" __global__ AICORE void launchTTRANS_3(__gm__ uint8_t *out, __gm__ uint8_t *src)
+{
+    constexpr uint32_t M = 40;
+    constexpr uint32_t N = 96;
+    runTTRANS<float, M, N, M, N>(reinterpret_cast<__gm__ float *>(out), reinterpret_cast<__gm__ float *>(src));
+}
+
+// DN source: src and dst are laid out along different axes.
+extern "C" __global__ AICORE void launchTTRANS_4(__gm__ uint8_t *out, __gm__ uint8_t *src)
+{
+    constexpr uint32_t M = 40;
+    constexpr uint32_t N = 96;
+    runTTRANS<float, M, N, M, N, BLayout::ColMajor>(reinterpret_cast<__gm__ float *>(out),
+                                                    reinterpret_cast<__gm__ float *>(src));
+}
+
+// Nz source
+extern "C" __global__ AICORE void launchTTRANS_5(__gm__ uint8_t *out, __gm__ uint8_t *src)
+{
+    constexpr uint32_t M = 64;
+    constexpr uint32_t N = 128;
+    runTTRANS<half, M, N, M, N, BLayout::ColMajor, SLayout::RowMajor>(reinterpret_cast<__gm__ half *>(out),
+                                                                      reinterpret_cast<__gm__ half *>(src));
+}
+
 template <int32_t tilingKey>
 void launchTTRANS(uint8_t *out, uint8_t *src, void *stream)
 {
     if constexpr (tilingKey == 1) {
         launchTTRANS_1(out, src);
+    } else if constexpr (tilingKey == 2) {
+        launchTTRANS_2(out, src);
+    } else if constexpr (tilingKey == 3) {
+        launchTTRANS_3(out, src);
+    } else if constexpr (tilingKey == 4) {
+        launchTTRANS_4(out, src);
+    } else if constexpr (tilingKey == 5) {
+        launchTTRANS_5(out, src);
     }
 }
 
-template void launchTTRANS<1>(uint8_t *out, uint8_t *src, void *stream);
\ No newline at end of file
+template void launchTTRANS<1>(uint8_t *out, uint8_t *src, void *stream);
+template void launchTTRANS<2>(uint8_t *out, uint8_t *src, void *stream);
+template void launchTTRANS<3>(uint8_t *out, uint8_t *src, void *stream);
+template void launchTTRANS<4>(uint8_t *out, uint8_t *src, void *stream);
+template void launchTTRANS<5>(uint8_t *out, uint8_t *src, void *stream);
\ No newline at end of file
@@ -69,3 +69,15 @@ TEST(TWait, SubRegion_4x8_of_16cols)
 {
     ASSERT_TRUE((RunTWaitSubRegion<16, 4, 8>()));
 }
+
+// Concurrent TNOTIFY AtomicAdd must not lose updates
+TEST(TWait, NotifyAtomicAdd_8Threads)
+{
+    ASSERT_TRUE(RunTNotifyAtomicAdd(8));
+}
+
+// Round trips through TNOTIFY/TWAIT
+TEST(TWait, PingPong)
+{
+    ASSERT_TRUE(RunTWaitPingPong(10000));
+}
@@ -250,6 +250,63 @@ bool RunTWaitSubRegion()
     return success;
 }
 
+// ============================================================================
+// Test 7: Concurrent TNOTIFY AtomicAdd
+// ============================================================================
+bool RunTNotifyAtomicAdd(int numThreads)
+{
+    alignas(64) int32_t counter = 0;
+    Signal sig(&counter);
+
+    constexpr int kAddsPerThread = 10000;
+    const int kExpectedTotal = numThreads * kAddsPerThread;
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < numThreads; ++i) {
+        workers.emplace_back([&]() {
+            Signal mine(&counter);
+            for (int j = 0; j < kAddsPerThread; ++j) {
+                TNOTIFY(mine, 1, NotifyOp::AtomicAdd);
+            }
+        });
+    }
+
+    TWAIT(sig, kExpectedTotal, WaitCmp::GE);
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    return std::atomic_ref<int32_t>(counter).load() == kExpectedTotal;
+}
+
+// ============================================================================
+// Test 8: TNOTIFY/TWAIT ping-pong
+// ============================================================================
+bool RunTWaitPingPong(int rounds)
+{
+    alignas(64) int32_t ping = 0;
+    alignas(64) int32_t pong = 0;
+
+    std::thread peer([&]() {
+        Signal pingSig(&ping);
+        Signal pongSig(&pong);
+        for (int i = 1; i <= rounds; ++i) {
+            TWAIT(pingSig, i, WaitCmp::EQ);
+            TNOTIFY(pongSig, i, NotifyOp::Set);
+        }
+    });
+
+    Signal pingSig(&ping);
+    Signal pongSig(&pong);
+    for (int i = 1; i <= rounds; ++i) {
+        TNOTIFY(pingSig, 1, NotifyOp::AtomicAdd);
+        TWAIT(pongSig, i, WaitCmp::EQ);
+    }
+
+    peer.join();
+    return std::atomic_ref<int32_t>(ping).load() == rounds && std::atomic_ref<int32_t>(pong).load() == rounds;
+}
+
 // Template instantiations
 template bool RunTWaitMatrix<4, 8>();
 template bool RunTWaitMatrix<7, 13>();
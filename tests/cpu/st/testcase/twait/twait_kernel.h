@@ -34,3 +34,9 @@ bool RunTWaitMultiPhase();
 // Test 6: 2D Sub-region with stride
 template <int FullCols, int SubRows, int SubCols>
 bool RunTWaitSubRegion();
+
+// Test 7: Concurrent TNOTIFY AtomicAdd from many threads
+bool RunTNotifyAtomicAdd(int numThreads);
+
+// Test 8: TNOTIFY/TWAIT ping-pong between two threads
+bool RunTWaitPingPong(int rounds);